@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  BenchBulkExtraction.cpp
+ *
+ * @brief Benchmark of the reading of the data interface element by element, against its reading into columns
+ *
+ * Usage: BenchBulkExtraction network.iidm [nbRuns]
+ *
+ * The Dynawo environment variables (IIDM_XML_XSD_PATH, DYNAWO_IIDM_EXTENSION, ...) must be set as for the network manager tests.
+ * The element by element walk reproduces the accesses of the previous extraction: a copy of the id of each element and the interning
+ * of the id of its bus, looked up among the nodes of its voltage level. The share of the building of the node tree spent in the data
+ * interface accessors is reported against the time of a whole network manager, parsing of the network file included.
+ *
+ */
+
+#include "NetworkColumns.h"
+#include "NetworkManager.h"
+#include "SymbolIndex.h"
+
+#include <DYNBusInterface.h>
+#include <DYNDataInterfaceFactory.h>
+#include <DYNLineInterface.h>
+#include <DYNLoadInterface.h>
+#include <DYNShuntCompensatorInterface.h>
+#include <DYNSwitchInterface.h>
+#include <DYNTwoWTransformerInterface.h>
+#include <DYNVoltageLevelInterface.h>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Walk the elements of a network through the data interface accessors, element by element
+ *
+ * @param network the network in the data interface
+ * @returns a value depending on the elements read, so that the walk is not optimized away
+ */
+static std::size_t
+walkAccessors(const DYN::NetworkInterface& network) {
+  std::size_t checksum = 0;
+  for (const auto& networkVL : network.getVoltageLevels()) {
+    dfl::common::SymbolIndex nodes;
+    for (const auto& bus : networkVL->getBuses()) {
+      nodes.insert(bus->getID(), static_cast<dfl::common::SymbolIndex::Position>(nodes.size()));
+    }
+    auto lookup = [&nodes](const boost::shared_ptr<DYN::BusInterface>& bus) { return nodes.find(bus->getID()); };
+    for (const auto& load : networkVL->getLoads()) {
+      if (load->getInitialConnected()) {
+        checksum += load->getID().size() + lookup(load->getBusInterface());
+      }
+    }
+    for (const auto& shunt : networkVL->getShuntCompensators()) {
+      checksum += shunt->getID().size() + lookup(shunt->getBusInterface());
+    }
+    for (const auto& sw : networkVL->getSwitches()) {
+      checksum += sw->getID().size() + lookup(sw->getBusInterface1()) + lookup(sw->getBusInterface2());
+    }
+    for (const auto& generator : networkVL->getGenerators()) {
+      if (generator->getInitialConnected()) {
+        checksum += generator->getID().size() + lookup(generator->getBusInterface());
+      }
+    }
+  }
+  for (const auto& line : network.getLines()) {
+    if (line->getInitialConnected1() && line->getInitialConnected2()) {
+      checksum += line->getID().size() + line->getBusInterface1()->getID().size() + line->getBusInterface2()->getID().size();
+    }
+  }
+  for (const auto& transfo : network.getTwoWTransformers()) {
+    if (transfo->getInitialConnected1() && transfo->getInitialConnected2()) {
+      checksum += transfo->getID().size() + transfo->getBusInterface1()->getID().size() + transfo->getBusInterface2()->getID().size();
+    }
+  }
+  return checksum;
+}
+
+/**
+ * @brief Time the best of several runs of a function
+ *
+ * @param nbRuns the number of runs
+ * @param function the function to run
+ * @returns the best wall time in milliseconds
+ */
+static double
+bestTime(unsigned int nbRuns, const std::function<void()>& function) {
+  double best = 0.;
+  for (unsigned int run = 0; run < nbRuns; ++run) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    if (run == 0 || elapsed.count() < best) {
+      best = elapsed.count();
+    }
+  }
+  return best;
+}
+
+int
+main(int argc, char* argv[]) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " network.iidm [nbRuns]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const boost::filesystem::path filepath(argv[1]);
+  const unsigned int nbRuns = (argc > 2) ? std::stoul(argv[2]) : 5;
+
+  const auto dataInterface = DYN::DataInterfaceFactory::build(DYN::DataInterfaceFactory::DATAINTERFACE_IIDM, filepath.generic_string());
+  const auto& network = *dataInterface->getNetwork();
+
+  std::size_t checksum = 0;
+  const auto accessorsTime = bestTime(nbRuns, [&network, &checksum]() { checksum += walkAccessors(network); });
+  const auto columnsTime = bestTime(nbRuns, [&network, &checksum]() { checksum += dfl::inputs::NetworkColumns::extract(network).nbVoltageLevels(); });
+  const auto managerTime = bestTime(nbRuns, [&filepath, &checksum]() { checksum += dfl::inputs::NetworkManager(filepath).getIslands().nbIslands(); });
+
+  std::cout << "Element by element accessors: " << accessorsTime << " ms (" << 100. * accessorsTime / managerTime << "% of the network manager)"
+            << std::endl;
+  std::cout << "Columns: " << columnsTime << " ms" << std::endl;
+  std::cout << "Network manager, parsing included: " << managerTime << " ms (checksum " << checksum << ")" << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  BenchCompressedNetwork.cpp
+ *
+ * @brief Benchmark of the loading of a network file, compressed and uncompressed
+ *
+ * Usage: BenchCompressedNetwork network.iidm compressedNetwork [nbRuns]
+ *
+ * The Dynawo environment variables (IIDM_XML_XSD_PATH, DYNAWO_IIDM_EXTENSION, ...) must be set as for the network manager tests
+ *
+ */
+
+#include "DecompressedFile.h"
+#include "NetworkManager.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Measure the best wall time of the loading of a network file
+ *
+ * @param filepath the network file
+ * @param nbRuns the number of runs
+ * @returns the best time in milliseconds
+ */
+static double
+benchLoad(const boost::filesystem::path& filepath, unsigned int nbRuns) {
+  double bestTime = 0.;
+  for (unsigned int run = 0; run < nbRuns; ++run) {
+    auto start = std::chrono::steady_clock::now();
+    dfl::inputs::NetworkManager manager(filepath);
+    manager.dataInterface();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    if (run == 0 || elapsed.count() < bestTime) {
+      bestTime = elapsed.count();
+    }
+  }
+  return bestTime;
+}
+
+int
+main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " network.iidm compressedNetwork [nbRuns]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const boost::filesystem::path filepath(argv[1]);
+  const boost::filesystem::path compressedFilepath(argv[2]);
+  const unsigned int nbRuns = (argc > 3) ? std::stoul(argv[3]) : 5;
+  if (!dfl::inputs::DecompressedFile::isCompressed(compressedFilepath)) {
+    std::cerr << compressedFilepath.generic_string() << " is not compressed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Uncompressed: " << boost::filesystem::file_size(filepath) << " bytes, compressed: " << boost::filesystem::file_size(compressedFilepath)
+            << " bytes" << std::endl;
+
+  double decompressionTime = 0.;
+  for (unsigned int run = 0; run < nbRuns; ++run) {
+    auto start = std::chrono::steady_clock::now();
+    dfl::inputs::DecompressedFile::read(compressedFilepath, [](const char*, std::size_t) {});
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    if (run == 0 || elapsed.count() < decompressionTime) {
+      decompressionTime = elapsed.count();
+    }
+  }
+
+  const auto uncompressedTime = benchLoad(filepath, nbRuns);
+  const auto compressedTime = benchLoad(compressedFilepath, nbRuns);
+  std::cout << "Decompression only: " << decompressionTime << " ms" << std::endl;
+  std::cout << "Uncompressed input: " << uncompressedTime << " ms" << std::endl;
+  std::cout << "Compressed input: " << compressedTime << " ms (ratio " << compressedTime / uncompressedTime << ")" << std::endl;
+
+  return EXIT_SUCCESS;
+}
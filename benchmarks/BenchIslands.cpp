@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  BenchIslands.cpp
+ *
+ * @brief Benchmark of the topological islands computation with respect to the number of threads
+ *
+ * Usage: BenchIslands [nbNodes [maxThreads]]
+ *
+ */
+
+#include "Islands.h"
+#include "Node.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Build a meshed grid network with a few open branches, giving a large main island and some small islands
+ *
+ * @param nbNodes the approximate number of nodes
+ * @returns the graph
+ */
+static dfl::inputs::Graph
+buildGrid(unsigned int nbNodes) {
+  const auto side = static_cast<unsigned int>(std::sqrt(static_cast<double>(nbNodes)));
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < side * side; ++i) {
+    builder.addNode(dfl::inputs::Node::build("BUS_" + std::to_string(i), vl, 400., {}));
+  }
+
+  std::uint32_t seed = 42;
+  for (unsigned int row = 0; row < side; ++row) {
+    for (unsigned int col = 0; col < side; ++col) {
+      auto index = row * side + col;
+      seed = seed * 1664525u + 1013904223u;
+      if (col + 1 < side && seed % 100 > 30) {
+        builder.addEdge(index, index + 1, dfl::inputs::Graph::EdgeType::LINE);
+      }
+      seed = seed * 1664525u + 1013904223u;
+      if (row + 1 < side && seed % 100 > 30) {
+        builder.addEdge(index, index + side, dfl::inputs::Graph::EdgeType::TFO);
+      }
+    }
+  }
+  return builder.build();
+}
+
+int
+main(int argc, char* argv[]) {
+  const unsigned int nbNodes = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+  const unsigned int maxThreads = (argc > 2) ? std::stoul(argv[2]) : std::max(1u, std::thread::hardware_concurrency());
+  const unsigned int nbRuns = 5;
+
+  auto graph = buildGrid(nbNodes);
+  std::cout << "Graph: " << graph.nbNodes() << " nodes, " << graph.nbEdges() << " edges" << std::endl;
+
+  auto reference = dfl::inputs::Islands::compute(graph);
+  std::cout << "Islands: " << reference.nbIslands() << ", main island size: " << reference.size(reference.mainIsland()) << std::endl;
+
+  double sequentialTime = 0.;
+  for (unsigned int nbThreads = 1; nbThreads <= maxThreads; ++nbThreads) {
+    double bestTime = 0.;
+    for (unsigned int run = 0; run < nbRuns; ++run) {
+      auto start = std::chrono::steady_clock::now();
+      auto islands = dfl::inputs::Islands::compute(graph, nbThreads);
+      std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+      if (islands.mainIsland() != reference.mainIsland() || islands.labels() != reference.labels()) {
+        std::cerr << "Islands computed with " << nbThreads << " threads differ from the sequential ones" << std::endl;
+        return EXIT_FAILURE;
+      }
+      if (run == 0 || elapsed.count() < bestTime) {
+        bestTime = elapsed.count();
+      }
+    }
+    if (nbThreads == 1) {
+      sequentialTime = bestTime;
+    }
+    std::cout << nbThreads << " thread(s): " << bestTime << " ms (speedup " << sequentialTime / bestTime << ")" << std::endl;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,286 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  BenchNodeOrdering.cpp
+ *
+ * @brief Benchmark of the walk of the nodes in the order of their ids, against the walk in the locality-aware order of Graph::Builder::renumber
+ *
+ * Usage: BenchNodeOrdering [nbVoltageLevels] [nbRuns]
+ *
+ * The network is a square grid of voltage levels of three nodes, the nodes of a voltage level being linked by transformers
+ * and the voltage levels by lines. Both the order of the network and the ids of the nodes are shuffled, as in a real network file.
+ * The cache misses are read from the hardware counters, which are not available everywhere (virtual machines, containers, ...).
+ *
+ */
+
+#include "Graph.h"
+#include "Node.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/// @brief Counter of the cache misses of the calling thread
+class CacheMissCounter {
+ public:
+  /// @brief Constructor: opens the hardware counter if available
+  CacheMissCounter() : fd_{-1} {
+#ifdef __linux__
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+
+  /// @brief Destructor: closes the hardware counter
+  ~CacheMissCounter() {
+#ifdef __linux__
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+#endif
+  }
+
+  CacheMissCounter(const CacheMissCounter&) = delete;
+  CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+  /**
+   * @brief Determines if the hardware counter is available
+   * @returns @b true if the cache misses can be counted, @b false if not
+   */
+  bool isAvailable() const {
+    return fd_ >= 0;
+  }
+
+  /// @brief Reset and start the counting
+  void start() {
+#ifdef __linux__
+    if (isAvailable()) {
+      ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  /**
+   * @brief Stop the counting
+   * @returns the number of cache misses since the start, zero if the counter is not available
+   */
+  std::uint64_t stop() {
+    std::uint64_t count = 0;
+#ifdef __linux__
+    if (isAvailable()) {
+      ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd_, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) {
+        count = 0;
+      }
+    }
+#endif
+    return count;
+  }
+
+ private:
+  int fd_;  ///< file descriptor of the hardware counter, negative if not available
+};
+
+/// @brief Synthetic network: nodes in the order of the network file, and the edges between them
+struct Network {
+  std::vector<std::shared_ptr<dfl::inputs::VoltageLevel>> voltageLevels;  ///< voltage levels
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes;                  ///< nodes, in network order
+  std::vector<std::pair<std::size_t, std::size_t>> transformers;          ///< positions of the extremities of the transformers
+  std::vector<std::pair<std::size_t, std::size_t>> lines;                 ///< positions of the extremities of the lines
+};
+
+/**
+ * @brief Build a square grid of voltage levels, shuffled
+ *
+ * @param nbVoltageLevels the number of voltage levels, rounded down to a square
+ * @returns the network
+ */
+static Network
+buildNetwork(unsigned int nbVoltageLevels) {
+  static constexpr unsigned int nbNodesByVoltageLevel = 3;
+  static const double nominalVoltages[nbNodesByVoltageLevel] = {400., 225., 63.};
+  const auto side = static_cast<unsigned int>(std::sqrt(static_cast<double>(nbVoltageLevels)));
+  const unsigned int nbNodes = side * side * nbNodesByVoltageLevel;
+  std::mt19937 random(42);
+
+  // ids and network positions are both shuffled, so that neither follows the grid
+  std::vector<unsigned int> ids(nbNodes);
+  std::iota(ids.begin(), ids.end(), 0);
+  std::shuffle(ids.begin(), ids.end(), random);
+  std::vector<std::size_t> positions(nbNodes);
+  std::iota(positions.begin(), positions.end(), 0);
+  std::shuffle(positions.begin(), positions.end(), random);
+  std::vector<unsigned int> nodeAtPosition(nbNodes);
+  for (unsigned int node = 0; node < nbNodes; ++node) {
+    nodeAtPosition[positions[node]] = node;
+  }
+
+  Network network;
+  network.voltageLevels.reserve(side * side);
+  for (unsigned int vl = 0; vl < side * side; ++vl) {
+    network.voltageLevels.push_back(std::make_shared<dfl::inputs::VoltageLevel>("VL_" + std::to_string(vl)));
+  }
+  network.nodes.reserve(nbNodes);
+  for (auto node : nodeAtPosition) {
+    const auto& vl = network.voltageLevels[node / nbNodesByVoltageLevel];
+    network.nodes.push_back(dfl::inputs::Node::build("BUS_" + std::to_string(ids[node]), vl, nominalVoltages[node % nbNodesByVoltageLevel], {}));
+  }
+
+  for (unsigned int vl = 0; vl < side * side; ++vl) {
+    const unsigned int first = vl * nbNodesByVoltageLevel;
+    for (unsigned int i = 1; i < nbNodesByVoltageLevel; ++i) {
+      network.transformers.emplace_back(positions[first], positions[first + i]);
+    }
+    const unsigned int row = vl / side;
+    const unsigned int column = vl % side;
+    if (column + 1 < side) {
+      network.lines.emplace_back(positions[first], positions[first + nbNodesByVoltageLevel]);
+    }
+    if (row + 1 < side) {
+      network.lines.emplace_back(positions[first], positions[first + side * nbNodesByVoltageLevel]);
+    }
+  }
+  return network;
+}
+
+/**
+ * @brief Build the graph of the network
+ *
+ * @param network the network
+ * @param renumber whether the nodes are renumbered in the locality-aware order
+ * @returns the graph
+ */
+static dfl::inputs::Graph
+buildGraph(const Network& network, bool renumber) {
+  dfl::inputs::Graph::Builder builder;
+  for (const auto& node : network.nodes) {
+    builder.addNode(node);
+  }
+  for (const auto& tfo : network.transformers) {
+    builder.addEdge(tfo.first, tfo.second, dfl::inputs::Graph::EdgeType::TFO);
+  }
+  for (const auto& line : network.lines) {
+    builder.addEdge(line.first, line.second, dfl::inputs::Graph::EdgeType::LINE);
+  }
+  if (renumber) {
+    builder.renumber();
+  }
+  return builder.build();
+}
+
+/**
+ * @brief Visit a node as the node algorithms do, reading its neighbours
+ *
+ * @param graph the graph
+ * @param index the index of the node
+ * @returns a value depending on the neighbours, so that the visit is not optimized away
+ */
+static double
+visit(const dfl::inputs::Graph& graph, dfl::inputs::Graph::NodeIndex index) {
+  double sum = graph.node(index)->nominalVoltage;
+  for (auto neighbour : graph.neighbours(index)) {
+    sum += graph.node(neighbour)->nominalVoltage * static_cast<double>(graph.degree(neighbour));
+  }
+  return sum;
+}
+
+/**
+ * @brief Walk the nodes of a graph in a given order, reporting the best time and the cache misses of the best run
+ *
+ * @param name the name of the walk
+ * @param graph the graph
+ * @param order the indexes of the nodes, in the order of the walk
+ * @param nbRuns the number of runs
+ * @param counter the cache miss counter
+ */
+static void
+run(const std::string& name, const dfl::inputs::Graph& graph, const std::vector<dfl::inputs::Graph::NodeIndex>& order, unsigned int nbRuns,
+    CacheMissCounter& counter) {
+  double bestTime = 0.;
+  std::uint64_t bestMisses = 0;
+  double checksum = 0.;
+  for (unsigned int i = 0; i < nbRuns; ++i) {
+    counter.start();
+    auto start = std::chrono::steady_clock::now();
+    for (auto index : order) {
+      checksum += visit(graph, index);
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    auto misses = counter.stop();
+    if (i == 0 || elapsed.count() < bestTime) {
+      bestTime = elapsed.count();
+      bestMisses = misses;
+    }
+  }
+  std::cout << name << ": " << bestTime << " ms, ";
+  if (counter.isAvailable()) {
+    std::cout << bestMisses << " cache misses";
+  } else {
+    std::cout << "n/a cache misses";
+  }
+  std::cout << " (checksum " << checksum / nbRuns << ")" << std::endl;
+}
+
+int
+main(int argc, char* argv[]) {
+  const unsigned int nbVoltageLevels = (argc > 1) ? std::stoul(argv[1]) : 250000;
+  const unsigned int nbRuns = (argc > 2) ? std::stoul(argv[2]) : 10;
+
+  const auto network = buildNetwork(nbVoltageLevels);
+  CacheMissCounter counter;
+
+  // previous behaviour: nodes stored in network order, walked in the order of their ids
+  const auto networkOrderGraph = buildGraph(network, false);
+  std::vector<dfl::inputs::Graph::NodeIndex> idOrder(networkOrderGraph.nbNodes());
+  std::iota(idOrder.begin(), idOrder.end(), 0);
+  std::sort(idOrder.begin(), idOrder.end(), [&networkOrderGraph](dfl::inputs::Graph::NodeIndex lhs, dfl::inputs::Graph::NodeIndex rhs) {
+    return networkOrderGraph.node(lhs)->id < networkOrderGraph.node(rhs)->id;
+  });
+  run("id order            ", networkOrderGraph, idOrder, nbRuns, counter);
+
+  // walk of the network manager in storage order: nodes stored and walked in the locality-aware order
+  const auto renumberedGraph = buildGraph(network, true);
+  std::vector<dfl::inputs::Graph::NodeIndex> storageOrder(renumberedGraph.nbNodes());
+  std::iota(storageOrder.begin(), storageOrder.end(), 0);
+  run("renumbered order    ", renumberedGraph, storageOrder, nbRuns, counter);
+
+  // walk of the network manager by id, for the algorithms whose results depend on the walk order: nodes stored in the locality-aware order
+  std::vector<dfl::inputs::Graph::NodeIndex> renumberedIdOrder(storageOrder);
+  std::sort(renumberedIdOrder.begin(), renumberedIdOrder.end(), [&renumberedGraph](dfl::inputs::Graph::NodeIndex lhs, dfl::inputs::Graph::NodeIndex rhs) {
+    return renumberedGraph.node(lhs)->id < renumberedGraph.node(rhs)->id;
+  });
+  run("renumbered, id order", renumberedGraph, renumberedIdOrder, nbRuns, counter);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  BenchNodePipeline.cpp
+ *
+ * @brief Benchmark of the node algorithms applied through a list of std::function callbacks, against their application through a node pipeline
+ *
+ * Usage: BenchNodePipeline [nbNodes] [nbRuns]
+ *
+ * The network is a chain of nodes, grouped by voltage levels of ten nodes, with a shunt on one node out of four, a load on one node out of two
+ * and a static var compensator on one node out of eight. The algorithms are the ones of the walks of the context that need no data interface.
+ *
+ */
+
+#include "Algo.h"
+#include "Graph.h"
+#include "Islands.h"
+#include "Node.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/// @brief Synthetic network: nodes and their graph
+struct Network {
+  std::vector<std::shared_ptr<dfl::inputs::VoltageLevel>> voltageLevels;  ///< voltage levels
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes;                  ///< nodes
+  dfl::inputs::Graph graph;                                               ///< graph of the nodes
+  dfl::inputs::Islands islands;                                           ///< islands of the graph
+};
+
+/**
+ * @brief Build a chain of nodes
+ *
+ * @param nbNodes the number of nodes
+ * @returns the network
+ */
+static Network
+buildNetwork(unsigned int nbNodes) {
+  static constexpr unsigned int nbNodesByVoltageLevel = 10;
+  Network network;
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < nbNodes; ++i) {
+    if (i % nbNodesByVoltageLevel == 0) {
+      network.voltageLevels.push_back(std::make_shared<dfl::inputs::VoltageLevel>("VL_" + std::to_string(i / nbNodesByVoltageLevel)));
+    }
+    std::vector<dfl::inputs::Shunt> shunts;
+    if (i % 4 == 0) {
+      shunts.emplace_back("SHUNT_" + std::to_string(i));
+    }
+    auto node = dfl::inputs::Node::build("BUS_" + std::to_string(i), network.voltageLevels.back(), (i % 3 == 0) ? 400. : 63., shunts);
+    if (i % 2 == 0) {
+      node->loads.emplace_back("LOAD_" + std::to_string(i));
+    }
+    if (i % 8 == 0) {
+      node->svarcs.emplace_back("SVARC_" + std::to_string(i), 0., 10., 100, 230, 215, 230, 235, 245, 10., 10.);
+    }
+    network.nodes.push_back(node);
+    builder.addNode(node);
+    if (i > 0) {
+      builder.addEdge(i - 1, i, dfl::inputs::Graph::EdgeType::LINE);
+    }
+  }
+  network.graph = builder.build();
+  network.islands = dfl::inputs::Islands::compute(network.graph);
+  return network;
+}
+
+/// @brief Definitions updated by the algorithms of a walk
+struct Definitions {
+  std::shared_ptr<dfl::inputs::Node> slackNode;                    ///< slack node
+  dfl::algo::MainConnexComponentAlgorithm::ConnexGroup mainNodes;  ///< main connex component
+  dfl::algo::ShuntCounterDefinitions counters;                     ///< shunt counters
+  dfl::algo::LoadDefinitionAlgorithm::Loads loads;                 ///< loads
+  dfl::algo::StaticVarCompensatorDefinitions svarcs;               ///< static var compensators
+
+  /**
+   * @brief Compute a value depending on the definitions, so that the walk is not optimized away
+   * @returns the value
+   */
+  std::size_t checksum() const {
+    return mainNodes.size() + counters.nbShunts.size() + loads.size() + svarcs.svarcs.size() + (slackNode ? 1 : 0);
+  }
+};
+
+/**
+ * @brief Walk the nodes with the algorithms registered as std::function callbacks, as the previous walk of the network manager
+ *
+ * @param network the network
+ * @param definitions the definitions to update
+ */
+static void
+walkCallbacks(const Network& network, Definitions& definitions) {
+  using Callback = std::function<void(const std::shared_ptr<dfl::inputs::Node>&)>;
+  std::vector<Callback> callbacks;
+  callbacks.push_back(dfl::algo::SlackNodeAlgorithm(definitions.slackNode, network.graph));
+  callbacks.push_back(dfl::algo::MainConnexComponentAlgorithm(definitions.mainNodes, network.graph, network.islands));
+  callbacks.push_back(dfl::algo::ShuntCounterAlgorithm(definitions.counters));
+  callbacks.push_back(dfl::algo::LoadDefinitionAlgorithm(definitions.loads, 45.));
+  callbacks.push_back(dfl::algo::StaticVarCompensatorAlgorithm(definitions.svarcs));
+  for (const auto& node : network.nodes) {
+    for (const auto& cbk : callbacks) {
+      cbk(node);
+    }
+  }
+}
+
+/**
+ * @brief Walk the nodes with the algorithms in a node pipeline
+ *
+ * @param network the network
+ * @param definitions the definitions to update
+ */
+static void
+walkPipeline(const Network& network, Definitions& definitions) {
+  auto pipeline = dfl::algo::makeNodePipeline(dfl::algo::SlackNodeAlgorithm(definitions.slackNode, network.graph),
+                                              dfl::algo::MainConnexComponentAlgorithm(definitions.mainNodes, network.graph, network.islands),
+                                              dfl::algo::ShuntCounterAlgorithm(definitions.counters),
+                                              dfl::algo::LoadDefinitionAlgorithm(definitions.loads, 45.),
+                                              dfl::algo::StaticVarCompensatorAlgorithm(definitions.svarcs));
+  for (const auto& node : network.nodes) {
+    pipeline(node);
+  }
+}
+
+/**
+ * @brief Run a walk several times, reporting the best time
+ *
+ * @param name the name of the walk
+ * @param network the network
+ * @param nbRuns the number of runs
+ * @param walk the walk to run
+ * @returns the best wall time in milliseconds
+ */
+static double
+run(const std::string& name, const Network& network, unsigned int nbRuns, void (*walk)(const Network&, Definitions&)) {
+  double bestTime = 0.;
+  std::size_t checksum = 0;
+  for (unsigned int i = 0; i < nbRuns; ++i) {
+    Definitions definitions;
+    auto start = std::chrono::steady_clock::now();
+    walk(network, definitions);
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    if (i == 0 || elapsed.count() < bestTime) {
+      bestTime = elapsed.count();
+    }
+    checksum = definitions.checksum();
+  }
+  std::cout << name << ": " << bestTime << " ms (checksum " << checksum << ")" << std::endl;
+  return bestTime;
+}
+
+int
+main(int argc, char* argv[]) {
+  const unsigned int nbNodes = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+  const unsigned int nbRuns = (argc > 2) ? std::stoul(argv[2]) : 10;
+
+  const auto network = buildNetwork(nbNodes);
+
+  const auto callbacksTime = run("std::function callbacks", network, nbRuns, &walkCallbacks);
+  const auto pipelineTime = run("node pipeline          ", network, nbRuns, &walkPipeline);
+  std::cout << "Saved: " << callbacksTime - pipelineTime << " ms" << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  BenchPendingEquipment.cpp
+ *
+ * @brief Benchmark of the extraction of the equipment detail for the main island only, against its extraction for all the islands
+ *
+ * Usage: BenchPendingEquipment network.iidm [nbRuns]
+ *
+ * The Dynawo environment variables (IIDM_XML_XSD_PATH, DYNAWO_IIDM_EXTENSION, ...) must be set as for the network manager tests.
+ * The savings are only significant on networks with a large part of their equipment outside the main island.
+ *
+ */
+
+#include "MemoryFootprint.h"
+#include "NetworkManager.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+/// @brief Measures of the building of a node tree
+struct Measure {
+  double time;                     ///< best wall time in milliseconds
+  std::size_t bytes;               ///< bytes retained by the node tree
+  std::size_t nbPendingEquipment;  ///< number of equipment whose detail is not extracted
+};
+
+/**
+ * @brief Measure the building of the node tree of a network file
+ *
+ * The parsing of the network file is part of both measures, so that their difference is the extraction of the pending equipment
+ *
+ * @param filepath the network file
+ * @param nbRuns the number of runs
+ * @param all whether the equipment of all the islands is extracted
+ * @returns the measures of the building
+ */
+static Measure
+benchBuild(const boost::filesystem::path& filepath, unsigned int nbRuns, bool all) {
+  Measure measure{0., 0, 0};
+  for (unsigned int run = 0; run < nbRuns; ++run) {
+    auto start = std::chrono::steady_clock::now();
+    dfl::inputs::NetworkManager manager(filepath);
+    if (all) {
+      manager.extractAllEquipment();
+    }
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    if (run == 0 || elapsed.count() < measure.time) {
+      measure.time = elapsed.count();
+    }
+    dfl::common::MemoryFootprint footprint;
+    manager.addMemoryFootprint(footprint);
+    measure.bytes = footprint.totalBytes();
+    measure.nbPendingEquipment = manager.nbPendingEquipment();
+  }
+  return measure;
+}
+
+int
+main(int argc, char* argv[]) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " network.iidm [nbRuns]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const boost::filesystem::path filepath(argv[1]);
+  const unsigned int nbRuns = (argc > 2) ? std::stoul(argv[2]) : 5;
+
+  const auto mainIsland = benchBuild(filepath, nbRuns, false);
+  const auto allIslands = benchBuild(filepath, nbRuns, true);
+  std::cout << "Main island only: " << mainIsland.time << " ms, " << mainIsland.bytes << " bytes, " << mainIsland.nbPendingEquipment
+            << " equipment not extracted" << std::endl;
+  std::cout << "All islands: " << allIslands.time << " ms, " << allIslands.bytes << " bytes" << std::endl;
+  std::cout << "Saved: " << allIslands.time - mainIsland.time << " ms, " << static_cast<double>(allIslands.bytes) - static_cast<double>(mainIsland.bytes)
+            << " bytes" << std::endl;
+
+  return EXIT_SUCCESS;
+}
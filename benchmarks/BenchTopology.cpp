@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  BenchTopology.cpp
+ *
+ * @brief Benchmark of the allocation of the topology objects, on the heap and on an arena, and of their memory per bus
+ *
+ * Usage: BenchTopology [nbNodes]
+ *
+ */
+
+#include "Node.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+static std::size_t nbHeapAllocations = 0;  ///< number of calls to the global operator new
+static std::size_t nbHeapBytes = 0;        ///< number of bytes requested to the global operator new
+
+void*
+operator new(std::size_t size) {
+  ++nbHeapAllocations;
+  nbHeapBytes += size;
+  if (void* memory = std::malloc(size)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void
+operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+/// @brief Topology objects, as owned by the network manager
+struct Topology {
+  std::vector<std::shared_ptr<dfl::inputs::VoltageLevel>> voltageLevels;  ///< voltage levels
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes;                  ///< nodes
+  std::vector<std::shared_ptr<dfl::inputs::Line>> lines;                  ///< lines
+  std::vector<std::shared_ptr<dfl::inputs::Tfo>> tfos;                    ///< transformers
+};
+
+/**
+ * @brief Build a chain of voltage levels of two nodes, linked by transformers inside the voltage levels and by lines between them
+ *
+ * Each node holds a load and the first node of each voltage level holds a shunt
+ *
+ * @param topology the topology to fill
+ * @param nbNodes the number of nodes
+ * @param arena the arena to allocate from, or a null pointer to allocate on the heap
+ */
+static void
+build(Topology& topology, unsigned int nbNodes, const std::shared_ptr<dfl::common::Arena>& arena) {
+  topology.voltageLevels.reserve(nbNodes / 2);
+  topology.nodes.reserve(nbNodes);
+  topology.lines.reserve(nbNodes / 2);
+  topology.tfos.reserve(nbNodes / 2);
+  for (unsigned int i = 0; i + 1 < nbNodes; i += 2) {
+    auto vl = dfl::common::makeShared<dfl::inputs::VoltageLevel>(arena, "VL_" + std::to_string(i));
+    topology.voltageLevels.push_back(vl);
+    topology.nodes.push_back(dfl::inputs::Node::build("BUS_" + std::to_string(i), vl, 400., {dfl::inputs::Shunt("SHUNT_" + std::to_string(i))}, arena));
+    topology.nodes.push_back(dfl::inputs::Node::build("BUS_" + std::to_string(i + 1), vl, 225., {}, arena));
+    topology.nodes[i]->loads.emplace_back("LOAD_" + std::to_string(i), 100.);
+    topology.nodes[i + 1]->loads.emplace_back("LOAD_" + std::to_string(i + 1), 50.);
+    topology.tfos.push_back(dfl::inputs::Tfo::build("TFO_" + std::to_string(i), topology.nodes[i], topology.nodes[i + 1], arena));
+    if (i > 0) {
+      topology.lines.push_back(dfl::inputs::Line::build("LINE_" + std::to_string(i), topology.nodes[i - 2], topology.nodes[i], "UNDEFINED", arena));
+    }
+  }
+}
+
+/**
+ * @brief Build and destroy the topology, reporting the time spent, the heap allocations and the heap memory per bus
+ *
+ * @param name the name of the run
+ * @param nbNodes the number of nodes
+ * @param useArena whether the objects are allocated on an arena
+ */
+static void
+run(const std::string& name, unsigned int nbNodes, bool useArena) {
+  Topology topology;
+  auto start = std::chrono::steady_clock::now();
+  auto startAllocations = nbHeapAllocations;
+  auto startBytes = nbHeapBytes;
+  {
+    auto arena = useArena ? std::make_shared<dfl::common::Arena>() : nullptr;
+    build(topology, nbNodes, arena);
+  }
+  std::chrono::duration<double, std::milli> buildTime = std::chrono::steady_clock::now() - start;
+  auto buildAllocations = nbHeapAllocations - startAllocations;
+  auto buildBytes = nbHeapBytes - startBytes;
+
+  start = std::chrono::steady_clock::now();
+  topology = Topology();
+  std::chrono::duration<double, std::milli> teardownTime = std::chrono::steady_clock::now() - start;
+
+  std::cout << name << ": " << buildAllocations << " heap allocations, " << buildBytes / nbNodes << " bytes per bus, build " << buildTime.count()
+            << " ms, teardown " << teardownTime.count() << " ms" << std::endl;
+}
+
+int
+main(int argc, char* argv[]) {
+  const unsigned int nbNodes = (argc > 1) ? std::stoul(argv[1]) : 500000;
+
+  // warm-up run: interns the ids so that the measured runs perform the same string allocations
+  {
+    Topology warmup;
+    build(warmup, nbNodes, nullptr);
+  }
+  run("heap ", nbNodes, false);
+  run("arena", nbNodes, true);
+
+  return EXIT_SUCCESS;
+}
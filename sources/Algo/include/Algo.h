@@ -18,7 +18,9 @@
 #pragma once
 
 #include "DynamicDataBaseManager.h"
+#include "Graph.h"
 #include "HvdcLine.h"
+#include "Islands.h"
 #include "NetworkManager.h"
 #include "Node.h"
 
@@ -30,8 +32,11 @@
 #include <functional>
 #include <map>
 #include <set>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace dfl {
@@ -50,6 +55,70 @@ struct NodeAlgorithm {
   using NodePtr = std::shared_ptr<inputs::Node>;  ///< Alias for pointer to node
 };
 
+/**
+ * @brief Node algorithms applied one after the other to each node, in a single walk
+ *
+ * The algorithms are stored by value in a tuple and called directly, in the order they are given, so that the walk
+ * makes no type-erased call and the compiler sees the whole sequence of algorithms applied to a node.
+ * Applying the pipeline to the nodes is equivalent to applying each of its algorithms to the node, in the same order.
+ *
+ * @tparam Algorithms the node algorithms, callable as algorithm(const NodePtr&)
+ */
+template<class... Algorithms>
+class NodePipeline : public NodeAlgorithm {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param algorithms the algorithms to apply, in order
+   */
+  explicit NodePipeline(Algorithms... algorithms) : algorithms_(std::move(algorithms)...) {}
+
+  /**
+   * @brief Apply all the algorithms to a node
+   *
+   * @param node the node to process
+   */
+  void operator()(const NodePtr& node) {
+    apply<0>(node);
+  }
+
+ private:
+  /**
+   * @brief Apply the algorithms from a position of the tuple to a node
+   *
+   * @param node the node to process
+   */
+  template<std::size_t I>
+  typename std::enable_if<(I < sizeof...(Algorithms))>::type apply(const NodePtr& node) {
+    std::get<I>(algorithms_)(node);
+    apply<I + 1>(node);
+  }
+
+  /**
+   * @brief End of the application of the algorithms
+   */
+  template<std::size_t I>
+  typename std::enable_if<(I == sizeof...(Algorithms))>::type apply(const NodePtr&) {}
+
+ private:
+  std::tuple<Algorithms...> algorithms_;  ///< the algorithms to apply, in order
+};
+
+/**
+ * @brief Build a node pipeline from its algorithms
+ *
+ * To share an algorithm with another walk, pass it with std::ref: the pipeline then calls it through the reference.
+ *
+ * @param algorithms the algorithms to apply, in order
+ * @returns the pipeline
+ */
+template<class... Algorithms>
+NodePipeline<typename std::decay<Algorithms>::type...>
+makeNodePipeline(Algorithms&&... algorithms) {
+  return NodePipeline<typename std::decay<Algorithms>::type...>(std::forward<Algorithms>(algorithms)...);
+}
+
 /**
  * @brief Algorithm to perform on nodes to find the slack node
  */
@@ -59,20 +128,23 @@ class SlackNodeAlgorithm : public NodeAlgorithm {
    * @brief Constructor
    *
    * @param slackNode the slack node to update with the algorithm
+   * @param graph the topological graph containing the nodes
    */
-  explicit SlackNodeAlgorithm(NodePtr& slackNode);
+  SlackNodeAlgorithm(NodePtr& slackNode, const inputs::Graph& graph);
 
   /**
   * @brief Perform elementary step to determine the slack node
   *
-  * The used criteria: the slack node is the node which has the higher voltage level then the higher number of connected nodes (in that order)
+  * The used criteria: the slack node is the node which has the higher voltage level then the higher number of connected nodes (in that order),
+  * then the lowest id so that the result does not depend on the order of the walk
   *
   * @param node the node to process
   */
   void operator()(const NodePtr& node);
 
  private:
-  NodePtr& slackNode_;  ///< The slack node to update
+  NodePtr& slackNode_;          ///< The slack node to update
+  const inputs::Graph& graph_;  ///< The topological graph
 };
 
 /**
@@ -87,14 +159,16 @@ class MainConnexComponentAlgorithm : public NodeAlgorithm {
    * @brief Constructor
    *
    * @param mainConnexity main connex component to update
+   * @param graph the topological graph containing the nodes
+   * @param islands the topological islands of the nodes
    */
-  explicit MainConnexComponentAlgorithm(ConnexGroup& mainConnexity);
+  MainConnexComponentAlgorithm(ConnexGroup& mainConnexity, const inputs::Graph& graph, const inputs::Islands& islands);
 
   /**
    * @brief Perform algorithm
    *
-   * For each node, we determine, by going through its neighbours, which other nodes are connexs
-   * and we mark the ones we already processed to avoid processing them again.
+   * Islands are labelled beforehand: the main connex component is collected from the first node of the main island
+   * that is processed, the other nodes being skipped
    *
    *  @brief node the node to process
    */
@@ -102,44 +176,28 @@ class MainConnexComponentAlgorithm : public NodeAlgorithm {
 
  private:
   /**
-  * @brief Equality Comparator for nodes
-  */
-  struct EqualCompareNode {
-    /**
-     * @brief invocable operator
-     *
-     * performs @p lhs == @p rhs by relying on Node equality operator
-     *
-     * @param lhs first node
-     * @param rhs second node
-     *
-     * @returns comparaison status
-     */
-    bool operator()(const NodePtr& lhs, const NodePtr& rhs) const {
-      return (*lhs) == (*rhs);
-    }
-  };
-
- private:
-  /**
-  * @brief Update connexity group recursively
-  *
-  * Update group with all nodes in inputs and their neighbours
-  *
-  * @param group the group to update
-  * @param nodes the nodes to add to the group
-  */
-  void updateConnexGroup(ConnexGroup& group, const std::vector<NodePtr>& nodes);
+   * @brief Collect the main connex component
+   *
+   * Add to the main connex component all nodes reachable from the root node through closed edges, using an explicit depth-first search stack.
+   * Nodes are added in the order of their discovery, which is the order of the component found by walking the graph.
+   *
+   * @param root index of the first node of the main island
+   */
+  void collectMainConnexity(inputs::Graph::NodeIndex root);
 
  private:
-  std::unordered_set<NodePtr, std::hash<NodePtr>, EqualCompareNode> markedNodes_;  ///< the set of marked nodes for the algorithm
-  ConnexGroup& mainConnexity_;                                                     ///< the main connex component to update
+  const inputs::Graph& graph_;      ///< the topological graph
+  const inputs::Islands& islands_;  ///< the topological islands
+  ConnexGroup& mainConnexity_;      ///< the main connex component to update
 };
 
 /**
- * @brief Generation definition for algorithm
+ * @brief Generator definitions for algorithm
+ *
+ * Generators kept for the simulation, stored by columns: the row of each generator in the generator table of the network
+ * and the model to use for it. Other fields are read from the generator table, without copying them.
  */
-struct GeneratorDefinition {
+struct GeneratorDefinitions {
   /**
    * @brief Generator model type
    */
@@ -151,56 +209,60 @@ struct GeneratorDefinition {
     PROP_SIGNALN,               ///< Use GeneratorPQPropSignalN
     PROP_DIAGRAM_PQ_SIGNALN     ///< Use GeneratorPQPropDiagramPQSignalN
   };
-  using ReactiveCurvePoint = DYN::GeneratorInterface::ReactiveCurvePoint;  ///< Alias for reactive curve point
-  using BusId = std::string;                                               ///< alias of BusId
 
   /**
-   * @brief test if the model used is a diagram
+   * @brief test if a model uses a diagram
    *
+   * @param model the model to test
    * @return boolean indicating if the model uses a diagram
    */
-  bool isUsingDiagram() const {
+  static bool isUsingDiagram(ModelType model) {
     return model == ModelType::DIAGRAM_PQ_SIGNALN || model == ModelType::REMOTE_DIAGRAM_PQ_SIGNALN || model == ModelType::PROP_DIAGRAM_PQ_SIGNALN;
   }
 
   /**
    * @brief Constructor
    *
-   * @param genId generator id
-   * @param type the model to use
-   * @param nodeId the node id connected to the generator
-   * @param curvePoints the list of reactive capabilities curve points
-   * @param qmin minimum reactive power for the generator
-   * @param qmax maximum reactive power for the generator
-   * @param pmin minimum active power for the generator
-   * @param pmax maximum active power for the generator
-   * @param targetP target active power of the generator
-   * @param regulatedBusId the Bus Id this generator is regulating
-   */
-  GeneratorDefinition(const inputs::Generator::GeneratorId& genId, ModelType type, const inputs::Node::NodeId& nodeId,
-                      const std::vector<ReactiveCurvePoint>& curvePoints, double qmin, double qmax, double pmin, double pmax, double targetP,
-                      const BusId& regulatedBusId) :
-      id{genId},
-      model{type},
-      nodeId{nodeId},
-      points(curvePoints),
-      qmin{qmin},
-      qmax{qmax},
-      pmin{pmin},
-      pmax{pmax},
-      targetP{targetP},
-      regulatedBusId{regulatedBusId} {}
-
-  inputs::Generator::GeneratorId id;       ///< generator id
-  ModelType model;                         ///< model
-  inputs::Node::NodeId nodeId;             ///< connected node id
-  std::vector<ReactiveCurvePoint> points;  ///< curve points
-  double qmin;                             ///< minimum reactive power
-  double qmax;                             ///< maximum reactive power
-  double pmin;                             ///< minimum active power
-  double pmax;                             ///< maximum active power
-  double targetP;                          ///< target active power of the generator
-  const BusId regulatedBusId;              ///< regulated Bus Id
+   * @param table the generator table the definitions refer to
+   */
+  explicit GeneratorDefinitions(const inputs::GeneratorTable& table) : table(table) {}
+
+  /**
+   * @brief Add a generator
+   *
+   * @param row the row of the generator in the generator table
+   * @param model the model to use
+   */
+  void add(inputs::GeneratorTable::Index row, ModelType model) {
+    rows.push_back(row);
+    models.push_back(model);
+  }
+
+  /**
+   * @brief Retrieve the number of generators
+   * @returns number of generators
+   */
+  std::size_t size() const {
+    return rows.size();
+  }
+
+  /**
+   * @brief Determines if there is no generator
+   * @returns @b true if there is no generator, @b false if not
+   */
+  bool empty() const {
+    return rows.empty();
+  }
+
+  /// @brief Remove all the generators
+  void clear() {
+    rows.clear();
+    models.clear();
+  }
+
+  const inputs::GeneratorTable& table;              ///< generator table
+  std::vector<inputs::GeneratorTable::Index> rows;  ///< rows of the generators in the generator table
+  std::vector<ModelType> models;                    ///< model of each generator
 };
 
 /**
@@ -208,21 +270,20 @@ struct GeneratorDefinition {
  */
 class GeneratorDefinitionAlgorithm : public NodeAlgorithm {
  public:
-  using Generators = std::vector<GeneratorDefinition>;  ///< alias for list of generators
-  using BusId = std::string;                            ///< alias for bus id
-  using GenId = std::string;                            ///< alias for generator id
-  using BusGenMap = std::unordered_map<BusId, GenId>;   ///< alias for map of bus id to generator id
+  using BusId = common::Symbol;                        ///< alias for bus id
+  using GenId = common::Symbol;                        ///< alias for generator id
+  using BusGenMap = std::unordered_map<BusId, GenId>;  ///< alias for map of bus id to generator id
 
   /**
    * @brief Constructor
    *
-   * @param gens generators list to update
+   * @param gens generator definitions to update
    * @param busesWithDynamicModel map of bus ids to a generator that regulates them
    * @param busMap mapping of busId and the number of generators that regulates them
    * @param infinitereactivelimits parameter to determine if infinite reactive limits are used
    * @param serviceManager dynawo service manager in order to use Dynawo extra algorithms
    */
-  GeneratorDefinitionAlgorithm(Generators& gens, BusGenMap& busesWithDynamicModel, const inputs::NetworkManager::BusMapRegulating& busMap,
+  GeneratorDefinitionAlgorithm(GeneratorDefinitions& gens, BusGenMap& busesWithDynamicModel, const inputs::NetworkManager::BusMapRegulating& busMap,
                                bool infinitereactivelimits, const boost::shared_ptr<DYN::ServiceManagerInterface>& serviceManager);
 
   /**
@@ -236,7 +297,8 @@ class GeneratorDefinitionAlgorithm : public NodeAlgorithm {
    * regulates the bus in local or not. Otherwise we use the prop model.
    * In order to create later on in the dyd and the par specific models based on the buses that are regulated by multiples
    * generators, we fill the busesWithDynamicModel_ map. Each time we found a bus regulated by multiples generators we add in the
-   * busesWithDynamicModel_ map an element mapping the regulated bus to a generator id that regulates that bus.
+   * busesWithDynamicModel_ map an element mapping the regulated bus to a generator id that regulates that bus: the generator
+   * connected to the node with the lowest id is kept, whatever the order of the walk.
    * @param node the node to process
    */
   void operator()(const NodePtr& node);
@@ -245,27 +307,40 @@ class GeneratorDefinitionAlgorithm : public NodeAlgorithm {
   /**
    * @brief Checks for diagram validity according to the list of points associated with the generator
    *
-   * @param generator The generator with it list of points
+   * @param table the generator table
+   * @param row the row of the generator in the table
    * @return Boolean indicating if the diagram is valid
    */
-  static bool isDiagramValid(const inputs::Generator& generator);
+  static bool isDiagramValid(const inputs::GeneratorTable& table, inputs::GeneratorTable::Index row);
 
   /**
    * @brief Determines if a node is connected to another generator node through a switch network path
    *
-   * Uses the dynawo service manager
+   * Uses the switch groups of the voltage level of the node, computed on first use
    *
    * @param node the generator node to check
    *
    * @returns @b true if another generator is connected, @b false if not
    */
-  bool IsOtherGeneratorConnectedBySwitches(const NodePtr& node) const;
+  bool IsOtherGeneratorConnectedBySwitches(const NodePtr& node);
 
-  Generators& generators_;                                          ///< the generators list to update
-  BusGenMap& busesWithDynamicModel_;                                ///< map of bus ids to a generator that regulates them
-  const inputs::NetworkManager::BusMapRegulating& busMap_;          ///< mapping of busId and the number of generators that regulates them
-  bool useInfiniteReactivelimits_;                                  ///< determine if infinite reactive limits are used
-  boost::shared_ptr<DYN::ServiceManagerInterface> serviceManager_;  ///< dynawo service manager
+  /**
+   * @brief Compute the groups of nodes of a voltage level connected together by switches
+   *
+   * Uses the dynawo service manager once for each group, and counts the nodes with generators of each group
+   *
+   * @param vl the voltage level to process
+   */
+  void computeSwitchGroups(const inputs::VoltageLevel& vl);
+
+  GeneratorDefinitions& generators_;                                            ///< the generator definitions to update
+  BusGenMap& busesWithDynamicModel_;                                            ///< map of bus ids to a generator that regulates them
+  const inputs::NetworkManager::BusMapRegulating& busMap_;                      ///< mapping of busId and the number of generators that regulates them
+  bool useInfiniteReactivelimits_;                                              ///< determine if infinite reactive limits are used
+  boost::shared_ptr<DYN::ServiceManagerInterface> serviceManager_;              ///< dynawo service manager
+  std::unordered_map<BusId, inputs::Node::NodeId> busesWithDynamicModelNodes_;  ///< node of the generator kept in busesWithDynamicModel_ for each bus
+  std::unordered_map<const inputs::Node*, std::size_t> switchGroups_;           ///< switch group of each node of the voltage levels already processed
+  std::vector<unsigned int> nbGeneratorNodesBySwitchGroup_;                     ///< number of nodes with generators in each switch group
 };
 
 /**
@@ -317,8 +392,8 @@ class LoadDefinitionAlgorithm : public NodeAlgorithm {
 /// @brief VSC definition
 class VSCDefinition {
  public:
-  using VSCId = std::string;                                            ///< Alias for VSC component id
-  using ReactiveCurvePoint = inputs::VSCConverter::ReactiveCurvePoint;  ///< point type
+  using VSCId = common::Symbol;                          ///< Alias for VSC component id
+  using CurveId = inputs::ReactiveCurveStore::CurveId;  ///< Alias for curve id
 
   /**
    * @brief Constructor
@@ -326,15 +401,15 @@ class VSCDefinition {
    * @param qMax the maximum reactive power capability value of the converter
    * @param qMin the minimum reactive power capability value of the converter
    * @param pMax the maximum active power capability value of the converter
-   * @param points the reactive curve points of the converter, if any
+   * @param curve the reactive capability curve of the converter in the curve store
    */
-  VSCDefinition(const VSCId& id, double qMax, double qMin, double pMax, const std::vector<ReactiveCurvePoint>& points) :
+  VSCDefinition(const VSCId& id, double qMax, double qMin, double pMax, CurveId curve) :
       id(id),
       qmax{qMax},
       qmin{qMin},
       pmax(pMax),
       pmin(-pMax),
-      points(points) {}
+      curve{curve} {}
 
   /**
    * @brief Equality operator for VSCDefinition
@@ -342,36 +417,24 @@ class VSCDefinition {
    * @returns true if current definition equals to @a other, false if not
    */
   bool operator==(const dfl::algo::VSCDefinition& other) const {
-    return id == other.id && pmax == other.pmax && pmin == other.pmin && points.size() == other.points.size() &&
-           std::equal(points.begin(), points.end(), other.points.begin(), comparePoints) && qmax == other.qmax && qmin == other.qmin;
+    return id == other.id && pmax == other.pmax && pmin == other.pmin && curve == other.curve && qmax == other.qmax && qmin == other.qmin;
   }
 
-  VSCId id;                                ///< id of the converter
-  double qmax;                             ///< maximum reactive power capability value
-  double qmin;                             ///< minimum reactive power capability value
-  double pmax;                             ///< maximum active power capability value
-  double pmin;                             ///< minimum active power capability value, equals to -pmax
-  std::vector<ReactiveCurvePoint> points;  ///< reactive curve points
-
- private:
-  /**
-   * @brief Compare function for reactive curve points
-   * @param lhs first element
-   * @param rhs second element
-   * @returns true of lhs == rhs, false if not
-   */
-  static bool comparePoints(const ReactiveCurvePoint& lhs, const ReactiveCurvePoint& rhs) {
-    return lhs.p == rhs.p && lhs.qmax == rhs.qmax && lhs.qmin == rhs.qmin;
-  }
+  VSCId id;       ///< id of the converter
+  double qmax;    ///< maximum reactive power capability value
+  double qmin;    ///< minimum reactive power capability value
+  double pmax;    ///< maximum active power capability value
+  double pmin;    ///< minimum active power capability value, equals to -pmax
+  CurveId curve;  ///< reactive capability curve, the curves being deduplicated by content in the store
 };
 
 /**
  * @brief Hvdc line definition for algorithms
  */
 struct HVDCDefinition {
-  using ConverterId = std::string;                        ///< alias for converter id
-  using BusId = std::string;                              ///< alias for bus id
-  using HvdcLineId = std::string;                         ///< HvdcLine id definition
+  using ConverterId = common::Symbol;                     ///< alias for converter id
+  using BusId = common::Symbol;                           ///< alias for bus id
+  using HvdcLineId = common::Symbol;                      ///< HvdcLine id definition
   using ConverterType = inputs::HvdcLine::ConverterType;  ///< Alias for type of converter
 
   /** @brief Enum Position that indicates how the converters of this hvdcLine are positioned.
@@ -501,7 +564,7 @@ struct HVDCDefinition {
 
 /// @brief HVDC line definitions
 struct HVDCLineDefinitions {
-  using HvdcLineId = std::string;  ///< HvdcLine id definition
+  using HvdcLineId = common::Symbol;  ///< HvdcLine id definition
 
   using HvdcLineMap = std::unordered_map<HvdcLineId, HVDCDefinition>;  ///< Alias for map of hvdc line definition
 
@@ -594,9 +657,10 @@ class HVDCDefinitionAlgorithm : public NodeAlgorithm {
   std::pair<std::reference_wrapper<HVDCDefinition>, bool> getOrCreateHvdcLineDefinition(const inputs::HvdcLine& hvdcLine);
 
  private:
-  HVDCLineDefinitions& hvdcLinesDefinitions_;                                 ///< The HVDC lines definitions to update
-  const bool infiniteReactiveLimits_;                                         ///< whether we use infinite reactive limits
-  const inputs::NetworkManager::BusMapRegulating& mapBusVSCConvertersBusId_;  ///< the map of buses and the number of VSC converters regulating them
+  HVDCLineDefinitions& hvdcLinesDefinitions_;                                    ///< The HVDC lines definitions to update
+  const bool infiniteReactiveLimits_;                                            ///< whether we use infinite reactive limits
+  const inputs::NetworkManager::BusMapRegulating& mapBusVSCConvertersBusId_;     ///< the map of buses and the number of VSC converters regulating them
+  std::unordered_map<common::Symbol, inputs::Node::NodeId> vscDefinitionNodes_;  ///< node of the VSC definition kept for each bus
 };
 
 /**
@@ -611,8 +675,8 @@ struct DynamicModelDefinition {
    * @brief Macro connection definition
    */
   struct MacroConnection {
-    using MacroId = std::string;    ///< alias for macro connector id
-    using ElementId = std::string;  ///< alias for connected element id
+    using MacroId = std::string;       ///< alias for macro connector id
+    using ElementId = common::Symbol;  ///< alias for connected element id
 
     /// @brief Connected element type
     enum class ElementType {
@@ -829,13 +893,13 @@ class DynModelAlgorithm : public NodeAlgorithm {
    * @brief Process node in case of dynamic automaton line connection
    * @param line line to process
    */
-  void connectMacroConnectionForLine(const std::shared_ptr<inputs::Line>& line);
+  void connectMacroConnectionForLine(const inputs::Line& line);
 
   /**
    * @brief Process node in case of dynamic automaton transformer connection
    * @param tfo transformer to process
    */
-  void connectMacroConnectionForTfo(const std::shared_ptr<inputs::Tfo>& tfo);
+  void connectMacroConnectionForTfo(const inputs::Tfo& tfo);
 
   /**
    * @brief Add macro connection to the dynamic model definition
@@ -19,6 +19,7 @@
 #include "HvdcLine.h"
 #include "Log.h"
 #include "Message.hpp"
+#include "SymbolIndex.h"
 
 #include <DYNCommon.h>
 #include <DYNExecUtils.h>
@@ -29,15 +30,43 @@
 namespace dfl {
 namespace algo {
 
-SlackNodeAlgorithm::SlackNodeAlgorithm(NodePtr& slackNode) : NodeAlgorithm(), slackNode_(slackNode) {}
+/**
+ * @brief Insert an element in a map, unless it already contains an element inserted from a node with a lower or equal id
+ *
+ * The element kept for a key then does not depend on the order in which the nodes are walked
+ *
+ * @param map the map to update
+ * @param nodeIds the ids of the nodes the elements of the map were inserted from
+ * @param key the key of the element
+ * @param value the value of the element
+ * @param nodeId the id of the node the element is inserted from
+ */
+template<class Map>
+static void
+insertFromLowestNode(Map& map, std::unordered_map<typename Map::key_type, inputs::Node::NodeId>& nodeIds, const typename Map::key_type& key,
+                     const typename Map::mapped_type& value, const inputs::Node::NodeId& nodeId) {
+  auto inserted = nodeIds.emplace(key, nodeId);
+  if (inserted.second) {
+    map.emplace(key, value);
+  } else if (nodeId < inserted.first->second) {
+    inserted.first->second = nodeId;
+    auto it = map.find(key);
+    if (it != map.end()) {
+      it->second = value;
+    }
+  }
+}
+
+SlackNodeAlgorithm::SlackNodeAlgorithm(NodePtr& slackNode, const inputs::Graph& graph) : NodeAlgorithm(), slackNode_(slackNode), graph_(graph) {}
 
 void
 SlackNodeAlgorithm::operator()(const NodePtr& node) {
   if (!slackNode_) {
     slackNode_ = node;
   } else {
-    if (std::forward_as_tuple(slackNode_->nominalVoltage, slackNode_->neighbours.size()) <
-        std::forward_as_tuple(node->nominalVoltage, node->neighbours.size())) {
+    // on equal voltage and degree, the node with the lowest id is kept, whatever the walk order
+    if (std::forward_as_tuple(slackNode_->nominalVoltage, graph_.degree(slackNode_->index), node->id) <
+        std::forward_as_tuple(node->nominalVoltage, graph_.degree(node->index), slackNode_->id)) {
       slackNode_ = node;
     }
   }
@@ -45,39 +74,54 @@ SlackNodeAlgorithm::operator()(const NodePtr& node) {
 
 /////////////////////////////////////////////////////////
 
-MainConnexComponentAlgorithm::MainConnexComponentAlgorithm(ConnexGroup& mainConnexity) : NodeAlgorithm(), markedNodes_{}, mainConnexity_(mainConnexity) {}
+MainConnexComponentAlgorithm::MainConnexComponentAlgorithm(ConnexGroup& mainConnexity, const inputs::Graph& graph, const inputs::Islands& islands) :
+    NodeAlgorithm(),
+    graph_(graph),
+    islands_(islands),
+    mainConnexity_(mainConnexity) {}
 
 void
-MainConnexComponentAlgorithm::updateConnexGroup(ConnexGroup& group, const std::vector<NodePtr>& nodes) {
-  for (const auto& node : nodes) {
-    if (markedNodes_.count(node) == 0) {
-      markedNodes_.insert(node);
-      group.push_back(node);
-      updateConnexGroup(group, (node)->neighbours);
+MainConnexComponentAlgorithm::collectMainConnexity(inputs::Graph::NodeIndex root) {
+  // Each element of the stack is a node and the position of the next neighbour to explore
+  std::vector<std::pair<inputs::Graph::NodeIndex, std::size_t>> stack;
+  std::vector<bool> markedNodes(graph_.nbNodes(), false);
+  markedNodes[root] = true;
+  mainConnexity_.push_back(graph_.node(root));
+  stack.emplace_back(root, 0);
+  while (!stack.empty()) {
+    auto& current = stack.back();
+    auto neighbours = graph_.neighbours(current.first);
+    if (current.second == neighbours.size()) {
+      stack.pop_back();
+      continue;
+    }
+    auto next = neighbours[current.second];
+    auto edge = graph_.incidentEdges(current.first)[current.second];
+    ++current.second;
+    if (graph_.isEdgeOpen(edge)) {
+      // open switches and disconnected branches do not connect their nodes
+      continue;
+    }
+    if (!markedNodes[next]) {
+      markedNodes[next] = true;
+      mainConnexity_.push_back(graph_.node(next));
+      stack.emplace_back(next, 0);
     }
   }
 }
 
 void
 MainConnexComponentAlgorithm::operator()(const NodePtr& node) {
-  if (markedNodes_.count(node) > 0) {
-    // already processed
+  if (!mainConnexity_.empty() || !islands_.isInMainIsland(node->index)) {
+    // main connex component already collected, or node outside of it
     return;
   }
-
-  ConnexGroup group;
-  markedNodes_.insert(node);
-  group.push_back(node);
-  updateConnexGroup(group, node->neighbours);
-
-  if (mainConnexity_.size() < group.size()) {
-    mainConnexity_.swap(group);
-  }
+  collectMainConnexity(node->index);
 }
 
 ////////////////////////////////////////////////////////////////
 
-GeneratorDefinitionAlgorithm::GeneratorDefinitionAlgorithm(Generators& gens, BusGenMap& busesWithDynamicModel,
+GeneratorDefinitionAlgorithm::GeneratorDefinitionAlgorithm(GeneratorDefinitions& gens, BusGenMap& busesWithDynamicModel,
                                                            const inputs::NetworkManager::BusMapRegulating& busMap, bool infinitereactivelimits,
                                                            const boost::shared_ptr<DYN::ServiceManagerInterface>& serviceManager) :
     NodeAlgorithm(),
@@ -85,82 +129,88 @@ GeneratorDefinitionAlgorithm::GeneratorDefinitionAlgorithm(Generators& gens, Bus
     busesWithDynamicModel_(busesWithDynamicModel),
     busMap_(busMap),
     useInfiniteReactivelimits_{infinitereactivelimits},
-    serviceManager_(serviceManager) {}
+    serviceManager_(serviceManager),
+    busesWithDynamicModelNodes_{},
+    switchGroups_{},
+    nbGeneratorNodesBySwitchGroup_{} {}
 
 void
 GeneratorDefinitionAlgorithm::operator()(const NodePtr& node) {
-  auto& node_generators = node->generators;
+  const auto& table = generators_.table;
+  const auto& ids = table.ids();
+  const auto& regulatedBusIds = table.regulatedBusIds();
+  const auto& connectedBusIds = table.connectedBusIds();
 
-  auto isModelWithInvalidDiagram = [](GeneratorDefinition::ModelType model, inputs::Generator generator) {
-    return (model == GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN || model == GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN ||
-            model == GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN) &&
-           !isDiagramValid(generator);
+  auto isModelWithInvalidDiagram = [&table](GeneratorDefinitions::ModelType model, inputs::GeneratorTable::Index row) {
+    return GeneratorDefinitions::isUsingDiagram(model) && !isDiagramValid(table, row);
   };
 
-  for (const auto& generator : node_generators) {
-    auto it = busMap_.find(generator.regulatedBusId);
+  const bool isConnectedToOtherGenerator = node->generators.size() == 1 && IsOtherGeneratorConnectedBySwitches(node);
+  for (auto row : node->generators) {
+    auto it = busMap_.find(regulatedBusIds[row]);
     assert(it != busMap_.end());
     auto nbOfRegulatingGenerators = it->second;
-    GeneratorDefinition::ModelType model = GeneratorDefinition::ModelType::SIGNALN;
-    if (node_generators.size() == 1 && IsOtherGeneratorConnectedBySwitches(node)) {
-      model = useInfiniteReactivelimits_ ? GeneratorDefinition::ModelType::PROP_SIGNALN : GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN;
-      if (!isModelWithInvalidDiagram(model, generator)) {
-        busesWithDynamicModel_.insert({generator.regulatedBusId, generator.id});
+    GeneratorDefinitions::ModelType model = GeneratorDefinitions::ModelType::SIGNALN;
+    if (isConnectedToOtherGenerator) {
+      model = useInfiniteReactivelimits_ ? GeneratorDefinitions::ModelType::PROP_SIGNALN : GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN;
+      if (!isModelWithInvalidDiagram(model, row)) {
+        insertFromLowestNode(busesWithDynamicModel_, busesWithDynamicModelNodes_, regulatedBusIds[row], ids[row], node->id);
       }
     } else {
       switch (nbOfRegulatingGenerators) {
       case dfl::inputs::NetworkManager::NbOfRegulating::ONE:
-        if (generator.regulatedBusId == generator.connectedBusId) {
-          model = useInfiniteReactivelimits_ ? GeneratorDefinition::ModelType::SIGNALN : GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN;
+        if (regulatedBusIds[row] == connectedBusIds[row]) {
+          model = useInfiniteReactivelimits_ ? GeneratorDefinitions::ModelType::SIGNALN : GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN;
         } else {
-          model = useInfiniteReactivelimits_ ? GeneratorDefinition::ModelType::REMOTE_SIGNALN : GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN;
+          model = useInfiniteReactivelimits_ ? GeneratorDefinitions::ModelType::REMOTE_SIGNALN : GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN;
         }
         break;
       case dfl::inputs::NetworkManager::NbOfRegulating::MULTIPLES:
-        model = useInfiniteReactivelimits_ ? GeneratorDefinition::ModelType::PROP_SIGNALN : GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN;
-        if (!isModelWithInvalidDiagram(model, generator)) {
-          busesWithDynamicModel_.insert({generator.regulatedBusId, generator.id});
+        model = useInfiniteReactivelimits_ ? GeneratorDefinitions::ModelType::PROP_SIGNALN : GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN;
+        if (!isModelWithInvalidDiagram(model, row)) {
+          insertFromLowestNode(busesWithDynamicModel_, busesWithDynamicModelNodes_, regulatedBusIds[row], ids[row], node->id);
         }
         break;
       default:  //  impossible by definition of the enum
         break;
       }
     }
-    if (isModelWithInvalidDiagram(model, generator)) {
+    if (isModelWithInvalidDiagram(model, row)) {
       continue;
     }
-    generators_.emplace_back(generator.id, model, node->id, generator.points, generator.qmin, generator.qmax, generator.pmin, generator.pmax, generator.targetP,
-                             generator.regulatedBusId);
+    generators_.add(row, model);
   }
 }
 
 bool
-GeneratorDefinitionAlgorithm::isDiagramValid(const inputs::Generator& generator) {
+GeneratorDefinitionAlgorithm::isDiagramValid(const inputs::GeneratorTable& table, inputs::GeneratorTable::Index row) {
+  const auto& id = table.ids()[row];
+  const auto points = table.points(row);
   // If there are no points, the diagram will be constructed from the pmin, pmax, qmin and qmax values.
   // We check the validity of pmin,pmax and qmin,qmax values
-  if (generator.points.empty()) {
-    if (DYN::doubleEquals(generator.pmin, generator.pmax)) {
-      LOG(warn) << MESS(InvalidDiagramAllPEqual, generator.id) << LOG_ENDL;
+  if (points.empty()) {
+    if (DYN::doubleEquals(table.pmin()[row], table.pmax()[row])) {
+      LOG(warn) << MESS(InvalidDiagramAllPEqual, id) << LOG_ENDL;
       return false;
     }
-    if (DYN::doubleEquals(generator.qmin, generator.qmax)) {
-      LOG(warn) << MESS(InvalidDiagramQminsEqualQmaxs, generator.id) << LOG_ENDL;
+    if (DYN::doubleEquals(table.qmin()[row], table.qmax()[row])) {
+      LOG(warn) << MESS(InvalidDiagramQminsEqualQmaxs, id) << LOG_ENDL;
       return false;
     }
     return true;
   }
 
   // If there is only one point, the diagram is not valid
-  if (generator.points.size() == 1) {
-    LOG(warn) << MESS(InvalidDiagramOnePoint, generator.id) << LOG_ENDL;
+  if (points.size() == 1) {
+    LOG(warn) << MESS(InvalidDiagramOnePoint, id) << LOG_ENDL;
     return false;
   }
 
-  auto firstP = generator.points.front().p;
+  auto firstP = points.front().p;
   bool allQminEqualQmax = true;
   bool allPEqual = true;
-  auto it = generator.points.begin();
-  while ((allQminEqualQmax || allPEqual) && it != generator.points.end()) {
+  auto it = points.begin();
+  while ((allQminEqualQmax || allPEqual) && it != points.end()) {
     allQminEqualQmax = allQminEqualQmax && it->qmin == it->qmax;
     allPEqual = allPEqual && it->p == firstP;
     ++it;
@@ -169,37 +219,64 @@ GeneratorDefinitionAlgorithm::isDiagramValid(const inputs::Generator& generator)
 
   if (!valid) {
     if (allQminEqualQmax && allPEqual) {
-      LOG(warn) << MESS(InvalidDiagramBothError, generator.id) << LOG_ENDL;
+      LOG(warn) << MESS(InvalidDiagramBothError, id) << LOG_ENDL;
     } else if (allQminEqualQmax) {
-      LOG(warn) << MESS(InvalidDiagramQminsEqualQmaxs, generator.id) << LOG_ENDL;
+      LOG(warn) << MESS(InvalidDiagramQminsEqualQmaxs, id) << LOG_ENDL;
     } else if (allPEqual) {
-      LOG(warn) << MESS(InvalidDiagramAllPEqual, generator.id) << LOG_ENDL;
+      LOG(warn) << MESS(InvalidDiagramAllPEqual, id) << LOG_ENDL;
     }
   }
   return valid;
 }
 
 bool
-GeneratorDefinitionAlgorithm::IsOtherGeneratorConnectedBySwitches(const NodePtr& node) const {
-  auto vl = node->voltageLevel.lock();
-  auto buses = serviceManager_->getBusesConnectedBySwitch(node->id, vl->id);
+GeneratorDefinitionAlgorithm::IsOtherGeneratorConnectedBySwitches(const NodePtr& node) {
+  auto found = switchGroups_.find(node.get());
+  if (found == switchGroups_.end()) {
+    computeSwitchGroups(*node->voltageLevel);
+    found = switchGroups_.find(node.get());
+#ifdef _DEBUG_
+    // shouldn't happen by construction of the elements
+    assert(found != switchGroups_.end());
+#endif
+  }
 
-  if (buses.size() == 0) {
-    return false;
+  // the node itself is counted in its group if it has generators
+  return nbGeneratorNodesBySwitchGroup_[found->second] > (node->generators.empty() ? 0U : 1U);
+}
+
+void
+GeneratorDefinitionAlgorithm::computeSwitchGroups(const inputs::VoltageLevel& vl) {
+  common::SymbolIndex nodesIndex;
+  nodesIndex.reserve(vl.nodes.size());
+  for (std::size_t i = 0; i < vl.nodes.size(); ++i) {
+    nodesIndex.insert(vl.nodes[i]->id, static_cast<common::SymbolIndex::Position>(i));
   }
 
-  for (const auto& id : buses) {
-    auto found = std::find_if(vl->nodes.begin(), vl->nodes.end(), [&id](const NodePtr& node) { return node->id == id; });
+  // being connected by switches is an equivalence relation: the buses connected to a node form its whole group
+  for (const auto* node : vl.nodes) {
+    if (switchGroups_.count(node) > 0) {
+      continue;
+    }
+    const auto group = nbGeneratorNodesBySwitchGroup_.size();
+    switchGroups_[node] = group;
+    unsigned int nbGeneratorNodes = node->generators.empty() ? 0 : 1;
+    for (const auto& id : serviceManager_->getBusesConnectedBySwitch(node->id.str(), vl.id.str())) {
+      auto position = nodesIndex.find(id);
 #ifdef _DEBUG_
-    // shouldn't happen by construction of the elements
-    assert(found != vl->nodes.end());
+      // shouldn't happen by construction of the elements
+      assert(position != common::SymbolIndex::npos);
 #endif
-    if ((*found)->generators.size() != 0) {
-      return true;
+      if (position == common::SymbolIndex::npos) {
+        continue;
+      }
+      const auto* connectedNode = vl.nodes[position];
+      if (switchGroups_.insert({connectedNode, group}).second && !connectedNode->generators.empty()) {
+        ++nbGeneratorNodes;
+      }
     }
+    nbGeneratorNodesBySwitchGroup_.push_back(nbGeneratorNodes);
   }
-
-  return false;
 }
 
 /////////////////////////////////////////////////////////////////
@@ -222,7 +299,8 @@ HVDCDefinitionAlgorithm::HVDCDefinitionAlgorithm(HVDCLineDefinitions& hvdcLinesD
                                                  const inputs::NetworkManager::BusMapRegulating& mapBusVSCConvertersBusId) :
     hvdcLinesDefinitions_(hvdcLinesDefinitions),
     infiniteReactiveLimits_(infiniteReactiveLimits),
-    mapBusVSCConvertersBusId_(mapBusVSCConvertersBusId) {}
+    mapBusVSCConvertersBusId_(mapBusVSCConvertersBusId),
+    vscDefinitionNodes_{} {}
 
 auto
 HVDCDefinitionAlgorithm::getBusRegulatedByMultipleVSC(const inputs::HvdcLine& hvdcLine, HVDCDefinition::Position position) const
@@ -315,18 +393,22 @@ HVDCDefinitionAlgorithm::getOrCreateHvdcLineDefinition(const inputs::HvdcLine& h
     boost::optional<VSCDefinition> def2;
     boost::optional<bool> voltageRegulation1;
     boost::optional<bool> voltageRegulation2;
-    if (hvdcLine.converterType == inputs::HvdcLine::ConverterType::LCC) {
-      auto converterLCC1 = std::dynamic_pointer_cast<inputs::LCCConverter>(hvdcLine.converter1);
-      auto converterLCC2 = std::dynamic_pointer_cast<inputs::LCCConverter>(hvdcLine.converter2);
-      powerFactors.at(0) = converterLCC1->powerFactor;
-      powerFactors.at(1) = converterLCC2->powerFactor;
-    } else {
-      auto converterVSC1 = std::dynamic_pointer_cast<inputs::VSCConverter>(hvdcLine.converter1);
-      auto converterVSC2 = std::dynamic_pointer_cast<inputs::VSCConverter>(hvdcLine.converter2);
-      def1 = VSCDefinition(converterVSC1->converterId, converterVSC1->qMax, converterVSC1->qMin, hvdcLine.pMax, converterVSC1->points);
-      def2 = VSCDefinition(converterVSC2->converterId, converterVSC2->qMax, converterVSC2->qMin, hvdcLine.pMax, converterVSC2->points);
-      voltageRegulation1 = converterVSC1->voltageRegulationOn;
-      voltageRegulation2 = converterVSC2->voltageRegulationOn;
+    switch (hvdcLine.converterType) {
+    case inputs::HvdcLine::ConverterType::LCC:
+      powerFactors.at(0) = hvdcLine.converter1->lcc().powerFactor;
+      powerFactors.at(1) = hvdcLine.converter2->lcc().powerFactor;
+      break;
+    case inputs::HvdcLine::ConverterType::VSC: {
+      const auto& converterVSC1 = hvdcLine.converter1->vsc();
+      const auto& converterVSC2 = hvdcLine.converter2->vsc();
+      def1 = VSCDefinition(hvdcLine.converter1->converterId, converterVSC1.qMax, converterVSC1.qMin, hvdcLine.pMax, converterVSC1.curve);
+      def2 = VSCDefinition(hvdcLine.converter2->converterId, converterVSC2.qMax, converterVSC2.qMin, hvdcLine.pMax, converterVSC2.curve);
+      voltageRegulation1 = converterVSC1.voltageRegulationOn;
+      voltageRegulation2 = converterVSC2.voltageRegulationOn;
+      break;
+    }
+    default:  // impossible case by definition of the enum
+      break;
     }
 
     boost::optional<double> droop = (hvdcLine.activePowerControl) ? hvdcLine.activePowerControl->droop : boost::optional<double>();
@@ -341,8 +423,7 @@ HVDCDefinitionAlgorithm::getOrCreateHvdcLineDefinition(const inputs::HvdcLine& h
 
 void
 HVDCDefinitionAlgorithm::operator()(const NodePtr& node) {
-  for (const auto& converterPtr : node->converters) {
-    auto converter = converterPtr.lock();
+  for (const auto& converter : node->converters) {
     const auto& hvdcLine = converter->hvdcLine;
     auto hvdcLineDefPair = getOrCreateHvdcLineDefinition(*hvdcLine);
     auto& hvdcLineDefinition = hvdcLineDefPair.first.get();
@@ -363,15 +444,15 @@ HVDCDefinitionAlgorithm::operator()(const NodePtr& node) {
     auto modelDef = computeModel(*hvdcLine, hvdcLineDefinition.position, hvdcLineDefinition.converterType);
     hvdcLineDefinition.model = modelDef.model;
 
-    // If VSC bus definitions map is defined, it means that the converter is a VSC and we can cast it. If not defined, the dynamic cast
-    // returns a null pointer and the transform has no effect since the bus map is empty
-    auto vscConverter = std::dynamic_pointer_cast<inputs::VSCConverter>(converter);
-    std::transform(modelDef.vscBusIdsMultipleRegulated.begin(), modelDef.vscBusIdsMultipleRegulated.end(),
-                   std::inserter(hvdcLinesDefinitions_.vscBusVSCDefinitionsMap, hvdcLinesDefinitions_.vscBusVSCDefinitionsMap.end()),
-                   [&vscConverter, &hvdcLine](const HVDCModelDefinition::VSCBusPair& pair) {
-                     return std::make_pair(pair.first,
-                                           VSCDefinition(pair.second, vscConverter->qMax, vscConverter->qMin, hvdcLine->pMax, vscConverter->points));
-                   });
+    // The VSC bus definitions map is only filled for VSC converters
+    if (converter->type != inputs::Converter::Type::VSC) {
+      continue;
+    }
+    const auto& vscConverter = converter->vsc();
+    for (const auto& pair : modelDef.vscBusIdsMultipleRegulated) {
+      insertFromLowestNode(hvdcLinesDefinitions_.vscBusVSCDefinitionsMap, vscDefinitionNodes_, pair.first,
+                           VSCDefinition(pair.second, vscConverter.qMax, vscConverter.qMin, hvdcLine->pMax, vscConverter.curve), node->id);
+    }
   }
 }
 
@@ -516,8 +597,8 @@ DynamicModelDefinition::MacroConnection::operator!=(const MacroConnection& other
 
 bool
 DynamicModelDefinition::MacroConnection::operator<(const MacroConnection& other) const {
-  return (id + std::to_string(static_cast<unsigned int>(elementType)) + connectedElementId) <
-         (other.id + std::to_string(static_cast<unsigned int>(other.elementType)) + other.connectedElementId);
+  return (id + std::to_string(static_cast<unsigned int>(elementType)) + connectedElementId.str()) <
+         (other.id + std::to_string(static_cast<unsigned int>(other.elementType)) + other.connectedElementId.str());
 }
 
 bool
@@ -538,7 +619,7 @@ DynamicModelDefinition::MacroConnection::operator>=(const MacroConnection& other
 void
 DynModelAlgorithm::connectMacroConnectionForShunt(const NodePtr& node) {
   // Connect all nodes of voltage level
-  auto vl = node->voltageLevel.lock();
+  const auto& vl = node->voltageLevel;
   const auto& macroConnections = macroConnectByVlForShuntsId_.at(vl->id);
 
   for (const auto& macroConnection : macroConnections) {
@@ -556,21 +637,21 @@ DynModelAlgorithm::connectMacroConnectionForShunt(const NodePtr& node) {
 }
 
 void
-DynModelAlgorithm::connectMacroConnectionForLine(const std::shared_ptr<inputs::Line>& line) {
-  const auto& macroConnections = macroConnectByLineName_.at(line->id);
+DynModelAlgorithm::connectMacroConnectionForLine(const inputs::Line& line) {
+  const auto& macroConnections = macroConnectByLineName_.at(line.id);
   for (const auto& macroConnection : macroConnections) {
     dynamicModels_.usedMacroConnections.insert(macroConnection.macroConnectionId);
     const auto& automaton = dynamicAutomatonsById_.at(macroConnection.dynModelId);
 
     addMacroConnectionToModelDefinitions(
         automaton,
-        DynamicModelDefinition::MacroConnection(macroConnection.macroConnectionId, DynamicModelDefinition::MacroConnection::ElementType::LINE, line->id));
+        DynamicModelDefinition::MacroConnection(macroConnection.macroConnectionId, DynamicModelDefinition::MacroConnection::ElementType::LINE, line.id));
   }
 }
 
 void
 DynModelAlgorithm::connectMacroConnectionForBus(const NodePtr& node) {
-  auto vl = node->voltageLevel.lock();
+  const auto& vl = node->voltageLevel;
   const auto& macroConnections = macroConnectByVlForBusesId_.at(vl->id);
 
   for (const auto& macroConnection : macroConnections) {
@@ -586,14 +667,14 @@ DynModelAlgorithm::connectMacroConnectionForBus(const NodePtr& node) {
 }
 
 void
-DynModelAlgorithm::connectMacroConnectionForTfo(const std::shared_ptr<inputs::Tfo>& tfo) {
-  const auto& macroConnections = macroConnectByTfoName_.at(tfo->id);
+DynModelAlgorithm::connectMacroConnectionForTfo(const inputs::Tfo& tfo) {
+  const auto& macroConnections = macroConnectByTfoName_.at(tfo.id);
   for (const auto& macroConnection : macroConnections) {
     dynamicModels_.usedMacroConnections.insert(macroConnection.macroConnectionId);
     const auto& automaton = dynamicAutomatonsById_.at(macroConnection.dynModelId);
 
     addMacroConnectionToModelDefinitions(automaton, DynamicModelDefinition::MacroConnection(
-                                                        macroConnection.macroConnectionId, DynamicModelDefinition::MacroConnection::ElementType::TFO, tfo->id));
+                                                        macroConnection.macroConnectionId, DynamicModelDefinition::MacroConnection::ElementType::TFO, tfo.id));
   }
 }
 
@@ -613,23 +694,21 @@ DynModelAlgorithm::addMacroConnectionToModelDefinitions(const dfl::inputs::Assem
 
 void
 DynModelAlgorithm::operator()(const NodePtr& node) {
-  auto vl = node->voltageLevel.lock();
+  const auto& vl = node->voltageLevel;
   if (macroConnectByVlForBusesId_.count(vl->id) > 0) {
     connectMacroConnectionForBus(node);
   }
   if (macroConnectByVlForShuntsId_.count(vl->id) > 0) {
     connectMacroConnectionForShunt(node);
   }
-  for (const auto& line_ptr : node->lines) {
-    auto line = line_ptr.lock();
+  for (const auto& line : node->lines) {
     if (macroConnectByLineName_.count(line->id) > 0) {
-      connectMacroConnectionForLine(line);
+      connectMacroConnectionForLine(*line);
     }
   }
-  for (const auto& tfo_ptr : node->tfos) {
-    auto tfo = tfo_ptr.lock();
+  for (const auto& tfo : node->tfos) {
     if (macroConnectByTfoName_.count(tfo->id) > 0) {
-      connectMacroConnectionForTfo(tfo);
+      connectMacroConnectionForTfo(*tfo);
     }
   }
 }
@@ -648,7 +727,7 @@ ShuntCounterAlgorithm::ShuntCounterAlgorithm(ShuntCounterDefinitions& defs) : sh
 
 void
 ShuntCounterAlgorithm::operator()(const NodePtr& node) {
-  auto vl = node->voltageLevel.lock();
+  const auto& vl = node->voltageLevel;
   shuntCounterDefs_.nbShunts[vl->id] += node->shunts.size();
 }
 
@@ -659,8 +738,7 @@ LinesByIdAlgorithm::LinesByIdAlgorithm(LinesByIdDefinitions& linesByIdDefinition
 void
 LinesByIdAlgorithm::operator()(const NodePtr& node) {
   const auto& lines = node->lines;
-  for (const auto& line_ptr : lines) {
-    auto line = line_ptr.lock();
+  for (const auto& line : lines) {
     if (linesByIdDefinition_.linesMap.count(line->id) > 0) {
       continue;
     }
@@ -0,0 +1,242 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Arena.h
+ *
+ * @brief Monotonic memory arena header file
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Monotonic memory arena
+ *
+ * Memory is carved out of large blocks and is only given back when the arena is destroyed, all blocks being freed together.
+ * Addresses of the allocated objects are stable for the whole life of the arena.
+ *
+ * The arena is not thread-safe.
+ */
+class Arena {
+ public:
+  static constexpr std::size_t defaultBlockSize = 64 * 1024;  ///< Default size of the blocks, in bytes
+
+  /**
+   * @brief Constructor
+   *
+   * @param blockSize the size of the blocks to allocate, in bytes
+   */
+  explicit Arena(std::size_t blockSize = defaultBlockSize);
+
+  /// @brief Deleted copy constructor
+  Arena(const Arena&) = delete;
+  /// @brief Deleted copy assignment operator
+  Arena& operator=(const Arena&) = delete;
+
+  /**
+   * @brief Allocate memory
+   *
+   * Requests larger than the block size get their own block. Alignments larger than the one of fundamental types are not supported.
+   *
+   * @param size the number of bytes to allocate
+   * @param alignment the alignment of the memory to allocate
+   * @returns the allocated memory
+   */
+  void* allocate(std::size_t size, std::size_t alignment);
+
+  /**
+   * @brief Retrieve the number of allocations served by the arena
+   *
+   * @returns number of calls to allocate
+   */
+  std::size_t nbAllocations() const {
+    return nbAllocations_;
+  }
+
+  /**
+   * @brief Retrieve the number of blocks allocated on the heap by the arena
+   *
+   * @returns number of blocks
+   */
+  std::size_t nbBlocks() const {
+    return blocks_.size();
+  }
+
+  /**
+   * @brief Retrieve the number of bytes allocated from the arena, without alignment padding
+   *
+   * @returns number of bytes
+   */
+  std::size_t size() const {
+    return size_;
+  }
+
+ private:
+  const std::size_t blockSize_;                  ///< size of the blocks
+  std::vector<std::unique_ptr<char[]>> blocks_;  ///< allocated blocks
+  char* current_;                                ///< first free byte of the current block
+  std::size_t remaining_;                        ///< number of free bytes in the current block
+  std::size_t nbAllocations_;                    ///< number of allocations served
+  std::size_t size_;                             ///< number of bytes allocated
+};
+
+/**
+ * @brief Standard allocator on an arena
+ *
+ * Deallocation does nothing: memory is given back when the arena is destroyed. The allocator shares the ownership of
+ * the arena so that objects allocated from it can outlive their builder.
+ */
+template<class T>
+class ArenaAllocator {
+ public:
+  using value_type = T;  ///< Alias for allocated type
+
+  /**
+   * @brief Constructor
+   *
+   * @param arena the arena to allocate from
+   */
+  explicit ArenaAllocator(const std::shared_ptr<Arena>& arena) : arena_(arena) {}
+
+  /**
+   * @brief Converting constructor
+   *
+   * @param other the allocator to copy the arena of
+   */
+  template<class U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.arena()) {}  // NOLINT(runtime/explicit)
+
+  /**
+   * @brief Allocate memory for objects
+   *
+   * @param n the number of objects
+   * @returns the allocated memory
+   */
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  /// @brief Deallocate memory: no operation
+  void deallocate(T*, std::size_t) {}
+
+  /**
+   * @brief Retrieve the arena
+   *
+   * @returns the arena used by the allocator
+   */
+  const std::shared_ptr<Arena>& arena() const {
+    return arena_;
+  }
+
+ private:
+  std::shared_ptr<Arena> arena_;  ///< arena to allocate from
+};
+
+/**
+ * @brief Determines if two arena allocators are equal
+ *
+ * @param lhs first allocator
+ * @param rhs second allocator
+ *
+ * @returns @b true if both allocate from the same arena, @b false if not
+ */
+template<class T, class U>
+bool
+operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) {
+  return lhs.arena() == rhs.arena();
+}
+
+/**
+ * @brief Determines if two arena allocators are different
+ *
+ * @param lhs first allocator
+ * @param rhs second allocator
+ *
+ * @returns @b true if they allocate from different arenas, @b false if not
+ */
+template<class T, class U>
+bool
+operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) {
+  return !(lhs == rhs);
+}
+
+/**
+ * @brief Deleter of objects allocated on an arena: only calls the destructor
+ */
+template<class T>
+struct ArenaDestroyer {
+  /**
+   * @brief Action operator
+   *
+   * @param object the object to destroy
+   */
+  void operator()(T* object) const {
+    object->~T();
+  }
+};
+
+/**
+ * @brief Build an object shared through a shared pointer
+ *
+ * The object and its control block are allocated together, on the arena if any or on the heap if not.
+ *
+ * @param arena the arena to allocate from, or a null pointer to allocate on the heap
+ * @param args the arguments of the constructor of the object
+ * @returns the built object
+ */
+template<class T, class... Args>
+std::shared_ptr<T>
+makeShared(const std::shared_ptr<Arena>& arena, Args&&... args) {
+  if (!arena) {
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  }
+  return std::allocate_shared<T>(ArenaAllocator<T>(arena), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Build an object shared through a shared pointer, using a construction function
+ *
+ * Used for objects whose constructor is not accessible from this function: the construction function is called with
+ * the memory to build the object in, and must return the object built in it with a placement new.
+ *
+ * @param arena the arena to allocate from, or a null pointer to allocate on the heap
+ * @param construct the construction function
+ * @returns the built object
+ */
+template<class T, class Construct>
+std::shared_ptr<T>
+makeSharedWith(const std::shared_ptr<Arena>& arena, const Construct& construct) {
+  if (!arena) {
+    void* memory = ::operator new(sizeof(T));
+    T* object = nullptr;
+    try {
+      object = construct(memory);
+    } catch (...) {
+      ::operator delete(memory);
+      throw;
+    }
+    return std::shared_ptr<T>(object);
+  }
+  T* object = construct(arena->allocate(sizeof(T), alignof(T)));
+  return std::shared_ptr<T>(object, ArenaDestroyer<T>{}, ArenaAllocator<T>(arena));
+}
+
+}  // namespace common
+}  // namespace dfl
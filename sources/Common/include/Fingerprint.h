@@ -0,0 +1,171 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Fingerprint.h
+ *
+ * @brief Content fingerprint header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Incremental fingerprint of a content
+ *
+ * 64 bits FNV-1a hash of the values added, in the order they are added. Strings are prefixed by their length, so that
+ * the boundaries between the values are part of the fingerprint.
+ *
+ * Unordered containers are added with addUnordered, which does not depend on the iteration order of the container,
+ * so that the same content always gives the same fingerprint.
+ */
+class Fingerprint {
+ public:
+  using Value = std::uint64_t;  ///< alias for the value of a fingerprint
+
+  /**
+   * @brief Add bytes
+   *
+   * @param data the bytes
+   * @param size the number of bytes
+   * @returns the fingerprint
+   */
+  Fingerprint& add(const char* data, std::size_t size);
+
+  /**
+   * @brief Add a string, prefixed by its length
+   * @param str the string
+   * @returns the fingerprint
+   */
+  Fingerprint& add(const std::string& str);
+
+  /**
+   * @brief Add a C string, prefixed by its length
+   *
+   * Prevents string literals from being added as booleans.
+   *
+   * @param str the string
+   * @returns the fingerprint
+   */
+  Fingerprint& add(const char* str) {
+    return add(std::string(str));
+  }
+
+  /**
+   * @brief Add an integer
+   * @param value the integer
+   * @returns the fingerprint
+   */
+  Fingerprint& add(std::uint64_t value);
+
+  /**
+   * @brief Add a floating point value
+   *
+   * Both zeros give the same fingerprint.
+   *
+   * @param value the value
+   * @returns the fingerprint
+   */
+  Fingerprint& add(double value);
+
+  /**
+   * @brief Add a boolean
+   * @param value the boolean
+   * @returns the fingerprint
+   */
+  Fingerprint& add(bool value);
+
+  /**
+   * @brief Add an optional value: its presence, then the value if present
+   * @param value the optional value
+   * @returns the fingerprint
+   */
+  template<class T>
+  Fingerprint& add(const boost::optional<T>& value) {
+    add(static_cast<bool>(value));
+    return value ? add(*value) : *this;
+  }
+
+  /**
+   * @brief Add the name of a file, its content and its size
+   *
+   * A file that cannot be read is added as an empty string, so that creating it changes the fingerprint.
+   *
+   * @param filepath the file
+   * @returns the fingerprint
+   */
+  Fingerprint& addFile(const boost::filesystem::path& filepath);
+
+  /**
+   * @brief Add the elements of a container in an order independent way
+   *
+   * Each element is fingerprinted on its own, then the sum of their fingerprints and their number are added.
+   *
+   * the type AddElement requires to be callable as addElement(Fingerprint&, const Container::value_type&)
+   *
+   * @param container the container, usually an unordered map or set
+   * @param addElement the function adding an element to a fingerprint
+   * @returns the fingerprint
+   */
+  template<class Container, class AddElement>
+  Fingerprint& addUnordered(const Container& container, const AddElement& addElement) {
+    Value sum = 0;
+    for (const auto& element : container) {
+      Fingerprint elementFingerprint;
+      addElement(elementFingerprint, element);
+      sum += elementFingerprint.value();
+    }
+    add(static_cast<std::uint64_t>(container.size()));
+    return add(sum);
+  }
+
+  /**
+   * @brief Retrieve the value of the fingerprint
+   * @returns the value
+   */
+  Value value() const {
+    return value_;
+  }
+
+  /**
+   * @brief Retrieve the value of the fingerprint as a string
+   * @returns the value in 16 hexadecimal digits
+   */
+  std::string str() const;
+
+  /**
+   * @brief Write the fingerprint into a file
+   * @param filepath the file to write
+   */
+  void save(const boost::filesystem::path& filepath) const;
+
+  /**
+   * @brief Read a fingerprint written by save
+   *
+   * @param filepath the file to read
+   * @returns the fingerprint string, or nothing if the file does not exist or cannot be read
+   */
+  static boost::optional<std::string> load(const boost::filesystem::path& filepath);
+
+ private:
+  Value value_ = 0xcbf29ce484222325ULL;  ///< current value, starting from the FNV-1a offset basis
+};
+
+}  // namespace common
+}  // namespace dfl
@@ -0,0 +1,231 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  MemoryFootprint.h
+ *
+ * @brief Memory footprint accounting header file
+ *
+ */
+
+#pragma once
+
+#include "SmallVector.h"
+
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Memory footprint of the structures of a process
+ *
+ * Breakdown of the bytes retained by each structure, with the number of elements it contains, so that the memory
+ * needed for a network can be predicted from its element counts.
+ *
+ * The bytes are estimated from the sizes and capacities of the containers: the bookkeeping of the memory allocator
+ * is not accounted for, and the node sizes of the node-based containers are the ones of the usual standard libraries.
+ */
+class MemoryFootprint {
+ public:
+  /**
+   * @brief Footprint of a structure
+   */
+  struct Entry {
+    std::string name;   ///< name of the structure, the dots separating the groups
+    std::size_t count;  ///< number of elements of the structure
+    std::size_t bytes;  ///< number of bytes retained by the structure
+  };
+
+  /**
+   * @brief Add the footprint of a structure
+   *
+   * @param name the name of the structure
+   * @param count the number of elements of the structure
+   * @param bytes the number of bytes retained by the structure
+   */
+  void add(const std::string& name, std::size_t count, std::size_t bytes);
+
+  /**
+   * @brief Retrieve the footprints of the structures
+   * @returns the footprints, in the order they were added
+   */
+  const std::vector<Entry>& entries() const {
+    return entries_;
+  }
+
+  /**
+   * @brief Retrieve the number of bytes retained by all the structures
+   * @returns the total number of bytes
+   */
+  std::size_t totalBytes() const;
+
+  /**
+   * @brief Write the footprint as a JSON document
+   *
+   * @param os the stream to write into
+   */
+  void writeJson(std::ostream& os) const;
+
+ private:
+  std::vector<Entry> entries_;  ///< footprints of the structures
+};
+
+/// @brief Estimations of the memory retained by the standard containers
+namespace memory {
+
+constexpr std::size_t sharedControlBlockBytes = 2 * sizeof(void*) + 2 * sizeof(int);  ///< control block of an object built with std::make_shared
+constexpr std::size_t hashNodeBytes = 2 * sizeof(void*);                               ///< bookkeeping of an element of an unordered container
+constexpr std::size_t treeNodeBytes = 4 * sizeof(void*);                               ///< bookkeeping of an element of an ordered container
+
+/**
+ * @brief Estimate the bytes allocated by a string
+ * @param str the string
+ * @returns the bytes allocated on the heap, zero when the string is stored inline
+ */
+std::size_t stringBytes(const std::string& str);
+
+/**
+ * @brief Estimate the bytes allocated by a vector
+ * @param vector the vector
+ * @returns the bytes of its storage
+ */
+template<class T>
+std::size_t
+vectorBytes(const std::vector<T>& vector) {
+  return vector.capacity() * sizeof(T);
+}
+
+/**
+ * @brief Estimate the bytes allocated by a vector and by its elements
+ *
+ * @param vector the vector
+ * @param elementBytes the function estimating the bytes allocated by an element, outside of the vector storage
+ * @returns the bytes of its storage and of its elements
+ */
+template<class T, class ElementBytes>
+std::size_t
+vectorBytes(const std::vector<T>& vector, const ElementBytes& elementBytes) {
+  std::size_t bytes = vectorBytes(vector);
+  for (const auto& element : vector) {
+    bytes += elementBytes(element);
+  }
+  return bytes;
+}
+
+/**
+ * @brief Estimate the bytes allocated by a small vector and by its elements
+ *
+ * @param vector the small vector
+ * @param elementBytes the function estimating the bytes allocated by an element, outside of the vector storage
+ * @returns the bytes of its storage when it is on the heap, and of its elements
+ */
+template<class T, std::size_t N, class ElementBytes>
+std::size_t
+smallVectorBytes(const SmallVector<T, N>& vector, const ElementBytes& elementBytes) {
+  std::size_t bytes = vector.isInline() ? 0 : vector.capacity() * sizeof(T);
+  for (const auto& element : vector) {
+    bytes += elementBytes(element);
+  }
+  return bytes;
+}
+
+/**
+ * @brief Estimate the bytes allocated by a small vector
+ * @param vector the small vector
+ * @returns the bytes of its storage when it is on the heap
+ */
+template<class T, std::size_t N>
+std::size_t
+smallVectorBytes(const SmallVector<T, N>& vector) {
+  return smallVectorBytes(vector, [](const T&) { return std::size_t{0}; });
+}
+
+/**
+ * @brief Estimate the bytes allocated by an unordered container and by its elements
+ *
+ * @param container the unordered map or set
+ * @param elementBytes the function estimating the bytes allocated by an element, outside of its node
+ * @returns the bytes of its buckets, of its nodes and of its elements
+ */
+template<class Container, class ElementBytes>
+std::size_t
+hashBytes(const Container& container, const ElementBytes& elementBytes) {
+  std::size_t bytes = container.bucket_count() * sizeof(void*) + container.size() * (sizeof(typename Container::value_type) + hashNodeBytes);
+  for (const auto& element : container) {
+    bytes += elementBytes(element);
+  }
+  return bytes;
+}
+
+/**
+ * @brief Estimate the bytes allocated by an unordered container
+ * @param container the unordered map or set
+ * @returns the bytes of its buckets and of its nodes
+ */
+template<class Container>
+std::size_t
+hashBytes(const Container& container) {
+  return hashBytes(container, [](const typename Container::value_type&) { return std::size_t{0}; });
+}
+
+/**
+ * @brief Estimate the bytes allocated by an ordered container and by its elements
+ *
+ * @param container the map or set
+ * @param elementBytes the function estimating the bytes allocated by an element, outside of its node
+ * @returns the bytes of its nodes and of its elements
+ */
+template<class Container, class ElementBytes>
+std::size_t
+treeBytes(const Container& container, const ElementBytes& elementBytes) {
+  std::size_t bytes = container.size() * (sizeof(typename Container::value_type) + treeNodeBytes);
+  for (const auto& element : container) {
+    bytes += elementBytes(element);
+  }
+  return bytes;
+}
+
+/**
+ * @brief Estimate the bytes allocated by an optional value
+ *
+ * @param value the optional value
+ * @param valueBytes the function estimating the bytes allocated by the value
+ * @returns the bytes allocated by the value if any, zero if not
+ */
+template<class T, class ValueBytes>
+std::size_t
+optionalBytes(const boost::optional<T>& value, const ValueBytes& valueBytes) {
+  return value ? valueBytes(*value) : 0;
+}
+
+/**
+ * @brief Estimate the bytes retained by a vector of shared objects, which are owned by the vector
+ *
+ * @param vector the vector of shared pointers
+ * @param elementBytes the function estimating the bytes allocated by an object, outside of the object itself
+ * @returns the bytes of its storage, of the objects with their control blocks and of what the objects allocate
+ */
+template<class T, class ElementBytes>
+std::size_t
+sharedVectorBytes(const std::vector<std::shared_ptr<T>>& vector, const ElementBytes& elementBytes) {
+  return vectorBytes(vector, [&elementBytes](const std::shared_ptr<T>& element) {
+    return element ? sizeof(T) + sharedControlBlockBytes + elementBytes(*element) : 0;
+  });
+}
+
+}  // namespace memory
+}  // namespace common
+}  // namespace dfl
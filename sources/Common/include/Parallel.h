@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Parallel.h
+ *
+ * @brief Parallel loop helper header file
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Apply a function on contiguous chunks of a range of indexes, using several threads
+ *
+ * The range [0, size) is split into at most @p nbThreads chunks of similar sizes, the calling thread processing the first one.
+ * If a call throws, the first exception (by chunk order) is rethrown in the calling thread once all threads are joined.
+ *
+ * @param size the number of indexes to process
+ * @param nbThreads the maximum number of threads to use
+ * @param func the function called as func(begin, end) on each chunk
+ */
+template<class F>
+void
+parallelFor(std::size_t size, unsigned int nbThreads, const F& func) {
+  const std::size_t nbChunks = std::max<std::size_t>(1, std::min<std::size_t>(nbThreads, size));
+  if (nbChunks == 1) {
+    func(std::size_t{0}, size);
+    return;
+  }
+
+  std::vector<std::exception_ptr> errors(nbChunks);
+  auto processChunk = [&func, &errors, size, nbChunks](std::size_t chunk) {
+    try {
+      func(chunk * size / nbChunks, (chunk + 1) * size / nbChunks);
+    } catch (...) {
+      errors[chunk] = std::current_exception();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(nbChunks - 1);
+  for (std::size_t chunk = 1; chunk < nbChunks; ++chunk) {
+    threads.emplace_back(processChunk, chunk);
+  }
+  processChunk(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+}  // namespace common
+}  // namespace dfl
@@ -0,0 +1,432 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  SmallVector.h
+ *
+ * @brief Vector with inline storage header file
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace dfl {
+namespace common {
+
+namespace detail {
+/**
+ * @brief Inline storage of a small vector, for N elements of type T
+ */
+template<class T, std::size_t N>
+struct SmallVectorStorage {
+  alignas(T) unsigned char bytes[N * sizeof(T)];  ///< uninitialized storage of the elements
+};
+
+/**
+ * @brief Empty inline storage, taking no room in the small vector thanks to the empty base optimization
+ */
+template<class T>
+struct SmallVectorStorage<T, 0> {};
+}  // namespace detail
+
+/**
+ * @brief Vector storing up to N elements inline, without heap allocation
+ *
+ * Elements are moved to the heap when the inline capacity is exceeded. Size and capacity are stored on 32 bits so that the vector
+ * itself is smaller than a std::vector when N is 0. Elements are only copy or move constructed, never assigned,
+ * so that types with constant members can be stored and erased.
+ */
+template<class T, std::size_t N>
+class SmallVector : private detail::SmallVectorStorage<T, N> {
+ public:
+  using value_type = T;                 ///< Alias for the type of the elements
+  using size_type = std::size_t;        ///< Alias for sizes
+  using iterator = T*;                  ///< Alias for iterators
+  using const_iterator = const T*;      ///< Alias for constant iterators
+  using reference = T&;                 ///< Alias for references
+  using const_reference = const T&;     ///< Alias for constant references
+
+  /// @brief Default constructor: empty vector
+  SmallVector() : data_(inlineData()), size_(0), capacity_(N) {}
+
+  /**
+   * @brief Constructor from a std::vector
+   *
+   * @param elements the elements to copy
+   */
+  explicit SmallVector(const std::vector<T>& elements) : SmallVector() {
+    reserve(elements.size());
+    for (const auto& element : elements) {
+      new (data_ + size_++) T(element);
+    }
+  }
+
+  /**
+   * @brief Copy constructor
+   *
+   * @param other the vector to copy
+   */
+  SmallVector(const SmallVector& other) : SmallVector() {
+    reserve(other.size_);
+    for (const auto& element : other) {
+      new (data_ + size_++) T(element);
+    }
+  }
+
+  /**
+   * @brief Move constructor
+   *
+   * @param other the vector to move, left empty
+   */
+  SmallVector(SmallVector&& other) : SmallVector() {
+    moveFrom(other);
+  }
+
+  /// @brief Destructor
+  ~SmallVector() {
+    clear();
+    releaseHeap();
+  }
+
+  /**
+   * @brief Copy assignment
+   *
+   * @param other the vector to copy
+   * @returns the vector
+   */
+  SmallVector& operator=(const SmallVector& other) {
+    if (this != &other) {
+      clear();
+      reserve(other.size_);
+      for (const auto& element : other) {
+        new (data_ + size_++) T(element);
+      }
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment
+   *
+   * @param other the vector to move, left empty
+   * @returns the vector
+   */
+  SmallVector& operator=(SmallVector&& other) {
+    if (this != &other) {
+      clear();
+      releaseHeap();
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Retrieve the number of elements
+   * @returns number of elements
+   */
+  size_type size() const {
+    return size_;
+  }
+
+  /**
+   * @brief Determines if the vector is empty
+   * @returns @b true if there is no element, @b false if not
+   */
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  /**
+   * @brief Retrieve the number of elements which can be stored without allocation
+   * @returns capacity
+   */
+  size_type capacity() const {
+    return capacity_;
+  }
+
+  /**
+   * @brief Determines if the elements are stored inline
+   * @returns @b true if the elements are stored inside the vector, @b false if they are stored on the heap
+   */
+  bool isInline() const {
+    return data_ == inlineData();
+  }
+
+  /**
+   * @brief Retrieve the beginning of the elements
+   * @returns iterator to the first element
+   */
+  iterator begin() {
+    return data_;
+  }
+
+  /**
+   * @brief Retrieve the end of the elements
+   * @returns iterator past the last element
+   */
+  iterator end() {
+    return data_ + size_;
+  }
+
+  /**
+   * @brief Retrieve the beginning of the elements
+   * @returns iterator to the first element
+   */
+  const_iterator begin() const {
+    return data_;
+  }
+
+  /**
+   * @brief Retrieve the end of the elements
+   * @returns iterator past the last element
+   */
+  const_iterator end() const {
+    return data_ + size_;
+  }
+
+  /**
+   * @brief Access an element
+   * @param i the position of the element
+   * @returns the element
+   */
+  reference operator[](size_type i) {
+    assert(i < size_);
+    return data_[i];
+  }
+
+  /**
+   * @brief Access an element
+   * @param i the position of the element
+   * @returns the element
+   */
+  const_reference operator[](size_type i) const {
+    assert(i < size_);
+    return data_[i];
+  }
+
+  /**
+   * @brief Access the first element
+   * @returns the first element
+   */
+  reference front() {
+    return (*this)[0];
+  }
+
+  /**
+   * @brief Access the first element
+   * @returns the first element
+   */
+  const_reference front() const {
+    return (*this)[0];
+  }
+
+  /**
+   * @brief Access the last element
+   * @returns the last element
+   */
+  reference back() {
+    return (*this)[size_ - 1];
+  }
+
+  /**
+   * @brief Access the last element
+   * @returns the last element
+   */
+  const_reference back() const {
+    return (*this)[size_ - 1];
+  }
+
+  /**
+   * @brief Ensure that a number of elements can be stored without allocation
+   * @param capacity the number of elements
+   */
+  void reserve(size_type capacity) {
+    if (capacity > capacity_) {
+      reallocate(capacity);
+    }
+  }
+
+  /**
+   * @brief Construct an element at the end
+   *
+   * The capacity is doubled when exceeded
+   *
+   * @param args the arguments of the constructor of the element
+   * @returns the constructed element
+   */
+  template<class... Args>
+  reference emplace_back(Args&&... args) {
+    if (size_ == capacity_) {
+      // the element is constructed before moving the others, as the arguments may refer to them
+      const size_type capacity = (capacity_ == 0) ? 1 : 2 * static_cast<size_type>(capacity_);
+      T* data = static_cast<T*>(::operator new(capacity * sizeof(T)));
+      new (data + size_) T(std::forward<Args>(args)...);
+      moveElements(data);
+      releaseHeap();
+      data_ = data;
+      capacity_ = static_cast<std::uint32_t>(capacity);
+    } else {
+      new (data_ + size_) T(std::forward<Args>(args)...);
+    }
+    return data_[size_++];
+  }
+
+  /**
+   * @brief Copy an element at the end
+   * @param element the element to copy
+   */
+  void push_back(const T& element) {
+    emplace_back(element);
+  }
+
+  /**
+   * @brief Move an element at the end
+   * @param element the element to move
+   */
+  void push_back(T&& element) {
+    emplace_back(std::move(element));
+  }
+
+  /// @brief Remove the last element
+  void pop_back() {
+    assert(size_ > 0);
+    data_[--size_].~T();
+  }
+
+  /**
+   * @brief Remove a range of elements
+   *
+   * The following elements are moved to fill the gap, keeping their order
+   *
+   * @param first the first element to remove
+   * @param last past the last element to remove
+   * @returns iterator following the last removed element
+   */
+  iterator erase(const_iterator first, const_iterator last) {
+    const auto position = static_cast<size_type>(first - data_);
+    const auto nbErased = static_cast<size_type>(last - first);
+    if (nbErased == 0) {
+      return data_ + position;
+    }
+    for (auto i = position; i + nbErased < size_; ++i) {
+      data_[i].~T();
+      new (data_ + i) T(std::move(data_[i + nbErased]));
+    }
+    for (auto i = size_ - nbErased; i < size_; ++i) {
+      data_[i].~T();
+    }
+    size_ -= static_cast<std::uint32_t>(nbErased);
+    return data_ + position;
+  }
+
+  /**
+   * @brief Remove an element
+   * @param position the element to remove
+   * @returns iterator following the removed element
+   */
+  iterator erase(const_iterator position) {
+    return erase(position, position + 1);
+  }
+
+  /// @brief Remove all the elements, keeping the capacity
+  void clear() {
+    for (size_type i = 0; i < size_; ++i) {
+      data_[i].~T();
+    }
+    size_ = 0;
+  }
+
+ private:
+  /**
+   * @brief Retrieve the inline storage
+   * @returns pointer to the inline storage
+   */
+  T* inlineData() {
+    return reinterpret_cast<T*>(static_cast<detail::SmallVectorStorage<T, N>*>(this));
+  }
+
+  /**
+   * @brief Retrieve the inline storage
+   * @returns pointer to the inline storage
+   */
+  const T* inlineData() const {
+    return reinterpret_cast<const T*>(static_cast<const detail::SmallVectorStorage<T, N>*>(this));
+  }
+
+  /**
+   * @brief Move the elements to new storage, destroying the moved elements
+   * @param data the new storage
+   */
+  void moveElements(T* data) {
+    for (size_type i = 0; i < size_; ++i) {
+      new (data + i) T(std::move(data_[i]));
+      data_[i].~T();
+    }
+  }
+
+  /**
+   * @brief Move the elements to a heap storage of a given capacity
+   * @param capacity the new capacity
+   */
+  void reallocate(size_type capacity) {
+    T* data = static_cast<T*>(::operator new(capacity * sizeof(T)));
+    moveElements(data);
+    releaseHeap();
+    data_ = data;
+    capacity_ = static_cast<std::uint32_t>(capacity);
+  }
+
+  /// @brief Free the heap storage if any, the elements being already destroyed or moved
+  void releaseHeap() {
+    if (!isInline()) {
+      ::operator delete(data_);
+      data_ = inlineData();
+      capacity_ = N;
+    }
+  }
+
+  /**
+   * @brief Take the elements of another vector, this vector being empty and inline
+   *
+   * Inline elements are moved one by one, heap storage is taken over
+   *
+   * @param other the vector to move, left empty
+   */
+  void moveFrom(SmallVector& other) {
+    if (other.isInline()) {
+      for (size_type i = 0; i < other.size_; ++i) {
+        new (data_ + i) T(std::move(other.data_[i]));
+      }
+      size_ = other.size_;
+      other.clear();
+    } else {
+      data_ = other.data_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inlineData();
+      other.size_ = 0;
+      other.capacity_ = N;
+    }
+  }
+
+ private:
+  T* data_;                 ///< elements, stored inline or on the heap
+  std::uint32_t size_;      ///< number of elements
+  std::uint32_t capacity_;  ///< number of elements which can be stored without allocation
+};
+
+}  // namespace common
+}  // namespace dfl
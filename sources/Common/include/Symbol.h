@@ -0,0 +1,199 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Symbol.h
+ *
+ * @brief Interned string header file
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Interned string
+ *
+ * Handle on a string stored once in a process-wide symbol table. Copying, comparing for equality and hashing a symbol
+ * only involve its handle, the string being used only when the symbol is created and when it is serialized.
+ *
+ * Symbols are ordered by their strings, so that ordered containers of symbols keep the same order as with strings.
+ *
+ * Creating symbols is thread-safe.
+ */
+class Symbol {
+ public:
+  using Handle = std::uint32_t;  ///< Alias for the compact integer handle of a symbol
+
+  /// @brief Default constructor: empty string
+  Symbol();
+
+  /**
+   * @brief Constructor
+   *
+   * Implicit to allow using strings where symbols are expected
+   *
+   * @param str the string to intern
+   */
+  Symbol(const std::string& str);  // NOLINT(runtime/explicit)
+
+  /**
+   * @brief Constructor
+   *
+   * Implicit to allow using string literals where symbols are expected
+   *
+   * @param str the string to intern
+   */
+  Symbol(const char* str);  // NOLINT(runtime/explicit)
+
+  /**
+   * @brief Retrieve the interned string
+   *
+   * @returns the string of the symbol
+   */
+  const std::string& str() const {
+    return entry_->first;
+  }
+
+  /**
+   * @brief Retrieve the handle of the symbol
+   *
+   * Handles are allocated in the order the strings are interned, starting from 0 for the empty string
+   *
+   * @returns the handle
+   */
+  Handle handle() const {
+    return entry_->second;
+  }
+
+  /**
+   * @brief Determines if the symbol is the empty string
+   *
+   * @returns @b true if the symbol is empty, @b false if not
+   */
+  bool empty() const {
+    return entry_->first.empty();
+  }
+
+  /**
+   * @brief Retrieve the number of strings interned so far
+   *
+   * @returns number of symbols in the symbol table
+   */
+  static std::size_t nbSymbols();
+
+  /**
+   * @brief Estimate the memory retained by the symbol table
+   *
+   * @returns number of bytes of the symbol table and of the interned strings
+   */
+  static std::size_t memoryBytes();
+
+ private:
+  using Entry = std::pair<const std::string, Handle>;  ///< Alias for an entry of the symbol table
+
+  const Entry* entry_;  ///< entry of the symbol table, whose address is stable for the whole process
+};
+
+/**
+ * @brief Determines if two symbols are equal
+ *
+ * @param lhs first symbol
+ * @param rhs second symbol
+ *
+ * @returns status of the comparaison
+ */
+inline bool
+operator==(const Symbol& lhs, const Symbol& rhs) {
+  return lhs.handle() == rhs.handle();
+}
+
+/**
+ * @brief Determines if two symbols are different
+ *
+ * @param lhs first symbol
+ * @param rhs second symbol
+ *
+ * @returns status of the comparaison
+ */
+inline bool
+operator!=(const Symbol& lhs, const Symbol& rhs) {
+  return !(lhs == rhs);
+}
+
+/**
+ * @brief Determines if a symbol is inferior to another symbol
+ *
+ * Used criteria is the string of the symbol
+ *
+ * @param lhs first symbol
+ * @param rhs second symbol
+ *
+ * @returns status of the comparaison
+ */
+inline bool
+operator<(const Symbol& lhs, const Symbol& rhs) {
+  return lhs != rhs && lhs.str() < rhs.str();
+}
+
+/**
+ * @brief Determines if a symbol is superior to another symbol
+ *
+ * Used criteria is the string of the symbol
+ *
+ * @param lhs first symbol
+ * @param rhs second symbol
+ *
+ * @returns status of the comparaison
+ */
+inline bool
+operator>(const Symbol& lhs, const Symbol& rhs) {
+  return rhs < lhs;
+}
+
+/**
+ * @brief Write the string of a symbol
+ *
+ * @param os the output stream
+ * @param symbol the symbol to write
+ *
+ * @returns the output stream
+ */
+inline std::ostream&
+operator<<(std::ostream& os, const Symbol& symbol) {
+  return os << symbol.str();
+}
+
+}  // namespace common
+}  // namespace dfl
+
+namespace std {
+/// @brief specialization hash for symbols, relying on their handle
+template<>
+struct hash<dfl::common::Symbol> {
+  /**
+   * @brief Action operator
+   *
+   * @param symbol the symbol to hash
+   * @returns the hash value
+   */
+  size_t operator()(const dfl::common::Symbol& symbol) const {
+    return hash<dfl::common::Symbol::Handle>{}(symbol.handle());
+  }
+};
+}  // namespace std
@@ -0,0 +1,122 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  SymbolIndex.h
+ *
+ * @brief Hash index of symbols header file
+ *
+ */
+
+#pragma once
+
+#include "Symbol.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Hash index from symbols to positions in a dense vector
+ *
+ * Open addressing with linear probing over a flat array of (handle, position) slots, kept at most half full.
+ * Looking up a symbol only compares integer handles, without following pointers nor comparing strings.
+ */
+class SymbolIndex {
+ public:
+  using Position = std::uint32_t;                                         ///< Alias for a position in the indexed vector
+  static constexpr Position npos = std::numeric_limits<Position>::max();  ///< Position returned for unknown symbols
+
+  /**
+   * @brief Prepare the index for a number of symbols
+   *
+   * @param nbSymbols the number of symbols expected
+   */
+  void reserve(std::size_t nbSymbols);
+
+  /**
+   * @brief Add a symbol to the index
+   *
+   * @param symbol the symbol to add
+   * @param position the position associated with the symbol
+   * @returns @b true if the symbol was added, @b false if it was already in the index, in which case its position is unchanged
+   */
+  bool insert(const Symbol& symbol, Position position);
+
+  /**
+   * @brief Retrieve the position associated with a symbol
+   *
+   * @param symbol the symbol to look for
+   * @returns the position of the symbol, or npos if the symbol is not in the index
+   */
+  Position find(const Symbol& symbol) const;
+
+  /**
+   * @brief Determines if a symbol is in the index
+   *
+   * @param symbol the symbol to look for
+   * @returns @b true if the symbol is in the index, @b false if not
+   */
+  bool contains(const Symbol& symbol) const {
+    return find(symbol) != npos;
+  }
+
+  /**
+   * @brief Retrieve the number of symbols in the index
+   *
+   * @returns number of symbols
+   */
+  std::size_t size() const {
+    return size_;
+  }
+
+  /**
+   * @brief Estimate the memory retained by the index
+   *
+   * @returns number of bytes of the hash table
+   */
+  std::size_t memoryBytes() const {
+    return slots_.capacity() * sizeof(Slot);
+  }
+
+ private:
+  /// @brief Slot of the hash table
+  struct Slot {
+    Symbol::Handle handle;  ///< handle of the symbol, or emptyHandle if the slot is free
+    Position position;      ///< position associated with the symbol
+  };
+
+  static constexpr Symbol::Handle emptyHandle = std::numeric_limits<Symbol::Handle>::max();  ///< Handle marking a free slot
+
+  /**
+   * @brief Compute the first slot to probe for a handle
+   *
+   * @param handle the symbol handle
+   * @returns the slot index
+   */
+  std::size_t firstSlot(Symbol::Handle handle) const;
+
+  /**
+   * @brief Rebuild the table with a new number of slots
+   *
+   * @param nbSlots the new number of slots, a power of two
+   */
+  void rehash(std::size_t nbSlots);
+
+ private:
+  std::vector<Slot> slots_;  ///< hash table, whose size is zero or a power of two
+  std::size_t size_ = 0;     ///< number of symbols in the index
+};
+
+}  // namespace common
+}  // namespace dfl
@@ -0,0 +1,48 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Arena.cpp
+ *
+ * @brief Monotonic memory arena implementation file
+ *
+ */
+
+#include "Arena.h"
+
+#include <algorithm>
+
+namespace dfl {
+namespace common {
+
+constexpr std::size_t Arena::defaultBlockSize;
+
+Arena::Arena(std::size_t blockSize) : blockSize_{blockSize}, blocks_{}, current_{nullptr}, remaining_{0}, nbAllocations_{0}, size_{0} {}
+
+void*
+Arena::allocate(std::size_t size, std::size_t alignment) {
+  ++nbAllocations_;
+  void* memory = current_;
+  if (!std::align(alignment, size, memory, remaining_)) {
+    // new block: blocks are allocated with new[] so they are aligned for any fundamental type
+    auto newBlockSize = std::max(blockSize_, size);
+    std::unique_ptr<char[]> block(new char[newBlockSize]);
+    memory = block.get();
+    blocks_.push_back(std::move(block));
+    remaining_ = newBlockSize;
+  }
+  current_ = static_cast<char*>(memory) + size;
+  remaining_ -= size;
+  size_ += size;
+  return memory;
+}
+
+}  // namespace common
+}  // namespace dfl
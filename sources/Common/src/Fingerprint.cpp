@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Fingerprint.cpp
+ *
+ * @brief Content fingerprint implementation file
+ *
+ */
+
+#include "Fingerprint.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace dfl {
+namespace common {
+
+Fingerprint&
+Fingerprint::add(const char* data, std::size_t size) {
+  const Value prime = 0x100000001b3ULL;
+  for (std::size_t i = 0; i < size; ++i) {
+    value_ ^= static_cast<unsigned char>(data[i]);
+    value_ *= prime;
+  }
+  return *this;
+}
+
+Fingerprint&
+Fingerprint::add(const std::string& str) {
+  add(static_cast<std::uint64_t>(str.size()));
+  return add(str.data(), str.size());
+}
+
+Fingerprint&
+Fingerprint::add(std::uint64_t value) {
+  return add(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+Fingerprint&
+Fingerprint::add(double value) {
+  if (value == 0.) {
+    value = 0.;  // -0. and 0. are equal but do not have the same bytes
+  }
+  return add(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+Fingerprint&
+Fingerprint::add(bool value) {
+  const char byte = value ? 1 : 0;
+  return add(&byte, sizeof(byte));
+}
+
+Fingerprint&
+Fingerprint::addFile(const boost::filesystem::path& filepath) {
+  std::ifstream file(filepath.c_str(), std::ios::binary);
+  if (!file.is_open()) {
+    return add(std::string{});
+  }
+  add(filepath.filename().generic_string());
+  std::vector<char> buffer(1 << 16);
+  std::uint64_t size = 0;
+  while (file) {
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    const auto nbRead = static_cast<std::size_t>(file.gcount());
+    add(buffer.data(), nbRead);
+    size += nbRead;
+  }
+  return add(size);
+}
+
+std::string
+Fingerprint::str() const {
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << value_;
+  return ss.str();
+}
+
+void
+Fingerprint::save(const boost::filesystem::path& filepath) const {
+  std::ofstream file(filepath.c_str());
+  file << str() << std::endl;
+}
+
+boost::optional<std::string>
+Fingerprint::load(const boost::filesystem::path& filepath) {
+  std::ifstream file(filepath.c_str());
+  std::string str;
+  if (!file.is_open() || !std::getline(file, str)) {
+    return boost::none;
+  }
+  return str;
+}
+
+}  // namespace common
+}  // namespace dfl
@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  MemoryFootprint.cpp
+ *
+ * @brief Memory footprint accounting implementation file
+ *
+ */
+
+#include "MemoryFootprint.h"
+
+namespace dfl {
+namespace common {
+
+void
+MemoryFootprint::add(const std::string& name, std::size_t count, std::size_t bytes) {
+  entries_.push_back(Entry{name, count, bytes});
+}
+
+std::size_t
+MemoryFootprint::totalBytes() const {
+  std::size_t total = 0;
+  for (const auto& entry : entries_) {
+    total += entry.bytes;
+  }
+  return total;
+}
+
+void
+MemoryFootprint::writeJson(std::ostream& os) const {
+  // names are identifiers chosen by the code: they never need escaping
+  os << "{\n";
+  os << "  \"totalBytes\": " << totalBytes() << ",\n";
+  os << "  \"structures\": [";
+  for (std::size_t i = 0; i < entries_.size(); ++i) {
+    const auto& entry = entries_[i];
+    os << (i == 0 ? "\n" : ",\n");
+    os << "    {\"name\": \"" << entry.name << "\", \"count\": " << entry.count << ", \"bytes\": " << entry.bytes << "}";
+  }
+  os << (entries_.empty() ? "]\n" : "\n  ]\n");
+  os << "}\n";
+}
+
+namespace memory {
+
+std::size_t
+stringBytes(const std::string& str) {
+  // strings shorter than the inline buffer of the usual implementations do not allocate
+  static const std::size_t inlineCapacity = std::string().capacity();
+  return str.capacity() > inlineCapacity ? str.capacity() + 1 : 0;
+}
+
+}  // namespace memory
+}  // namespace common
+}  // namespace dfl
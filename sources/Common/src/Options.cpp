@@ -78,12 +78,14 @@ Options::basename(const std::string& filepath) {
   return path.filename().replace_extension().generic_string();
 }
 
-Options::Options() : desc_{}, config_{"", "", "", defaultLogLevel_} {
+Options::Options() : desc_{}, config_{"", "", "", defaultLogLevel_, ""} {
   desc_.add_options()("help,h", "Display help message")(
       "log-level", po::value<ParsedLogLevel>(),
       (std::string("Dynawo logger level (allowed values are ERROR, WARN, INFO, DEBUG): default is ") + defaultLogLevel_).c_str())(
       "network", po::value<std::string>(&config_.networkFilePath)->required(), "Network file path to process (IIDM support only)")(
-      "config", po::value<std::string>(&config_.configPath)->required(), "launcher Configuration file to use")("version,v", "Display version");
+      "config", po::value<std::string>(&config_.configPath)->required(), "launcher Configuration file to use")(
+      "memory-report", po::value<std::string>(&config_.memoryReportPath),
+      "Write the memory footprint of the network model and of the definitions, as JSON, to this file after processing")("version,v", "Display version");
 }
 
 auto
@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Symbol.cpp
+ *
+ * @brief Interned string implementation file
+ *
+ */
+
+#include "Symbol.h"
+
+#include "MemoryFootprint.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Process-wide symbol table
+ *
+ * Entries are never removed: the nodes of the maps keep their address when the maps are rehashed, so that symbols can
+ * refer to them directly and read their string without locking.
+ *
+ * The table is split into shards by hash of the string, each with its own lock, so that threads interning different
+ * strings rarely wait for each other. Handles are taken from a single counter, so that they stay dense.
+ */
+class SymbolTable {
+ public:
+  using Entry = std::pair<const std::string, Symbol::Handle>;  ///< Alias for an entry of the table
+
+  /**
+   * @brief Retrieve the symbol table instance
+   *
+   * @returns the single instance of the symbol table
+   */
+  static SymbolTable& instance() {
+    static SymbolTable table;
+    return table;
+  }
+
+  /**
+   * @brief Intern a string
+   *
+   * @param str the string to intern
+   * @returns the entry of the string in the table
+   */
+  const Entry* intern(const std::string& str) {
+    auto& shard = shards_[shardIndex(str)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(str);
+    if (it == shard.entries.end()) {
+      it = shard.entries.emplace(str, nextHandle_++).first;
+    }
+    return &*it;
+  }
+
+  /**
+   * @brief Retrieve the entry of the empty string
+   *
+   * @returns the entry of the empty string
+   */
+  const Entry* empty() const {
+    return empty_;
+  }
+
+  /**
+   * @brief Retrieve the number of interned strings
+   *
+   * @returns number of entries
+   */
+  std::size_t size() const {
+    return nextHandle_;
+  }
+
+  /**
+   * @brief Estimate the memory retained by the table
+   *
+   * @returns number of bytes of the table and of the interned strings
+   */
+  std::size_t memoryBytes() {
+    std::size_t bytes = 0;
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      bytes += memory::hashBytes(shard.entries, [](const Entry& entry) { return memory::stringBytes(entry.first); });
+    }
+    return bytes;
+  }
+
+ private:
+  /// @brief Part of the table, with its own lock
+  struct Shard {
+    std::mutex mutex;                                         ///< mutex protecting the shard
+    std::unordered_map<std::string, Symbol::Handle> entries;  ///< handles by interned string
+  };
+
+  static constexpr std::size_t nbShards = 64;  ///< number of shards, enough for the threads of a machine to rarely collide
+
+  /**
+   * @brief Select the shard of a string
+   *
+   * The string is hashed again by the map of its shard: only its last characters, where the ids of a network usually differ,
+   * are hashed here, with FNV-1a
+   *
+   * @param str the string
+   * @returns the index of the shard of the string
+   */
+  static std::size_t shardIndex(const std::string& str) {
+    static constexpr std::size_t nbHashedCharacters = 8;
+    std::uint32_t hash = 2166136261U;
+    for (auto i = str.size() - std::min(str.size(), nbHashedCharacters); i < str.size(); ++i) {
+      hash = (hash ^ static_cast<unsigned char>(str[i])) * 16777619U;
+    }
+    return hash % nbShards;
+  }
+
+  /// @brief Constructor: the empty string gets the first handle
+  SymbolTable() : nextHandle_{0}, empty_(intern("")) {}
+
+ private:
+  std::array<Shard, nbShards> shards_;      ///< shards of the table
+  std::atomic<Symbol::Handle> nextHandle_;  ///< handle of the next interned string
+  const Entry* empty_;                      ///< entry of the empty string
+};
+
+Symbol::Symbol() : entry_(SymbolTable::instance().empty()) {}
+
+Symbol::Symbol(const std::string& str) : entry_(SymbolTable::instance().intern(str)) {}
+
+Symbol::Symbol(const char* str) : entry_(SymbolTable::instance().intern(str)) {}
+
+std::size_t
+Symbol::nbSymbols() {
+  return SymbolTable::instance().size();
+}
+
+std::size_t
+Symbol::memoryBytes() {
+  return SymbolTable::instance().memoryBytes();
+}
+
+}  // namespace common
+}  // namespace dfl
@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  SymbolIndex.cpp
+ *
+ * @brief Hash index of symbols implementation file
+ *
+ */
+
+#include "SymbolIndex.h"
+
+namespace dfl {
+namespace common {
+
+constexpr SymbolIndex::Position SymbolIndex::npos;
+constexpr Symbol::Handle SymbolIndex::emptyHandle;
+
+/// @brief Minimal number of slots of a non-empty table
+static constexpr std::size_t minNbSlots = 16;
+
+void
+SymbolIndex::reserve(std::size_t nbSymbols) {
+  std::size_t nbSlots = minNbSlots;
+  while (nbSlots < 2 * nbSymbols) {
+    nbSlots *= 2;
+  }
+  if (nbSlots > slots_.size()) {
+    rehash(nbSlots);
+  }
+}
+
+std::size_t
+SymbolIndex::firstSlot(Symbol::Handle handle) const {
+  // Fibonacci hashing: handles are allocated sequentially, the multiplication spreads them over the whole table
+  return static_cast<std::size_t>((static_cast<std::uint64_t>(handle) * 0x9E3779B97F4A7C15ULL) >> 32) & (slots_.size() - 1);
+}
+
+bool
+SymbolIndex::insert(const Symbol& symbol, Position position) {
+  if (2 * (size_ + 1) > slots_.size()) {
+    rehash(slots_.empty() ? minNbSlots : 2 * slots_.size());
+  }
+
+  const auto handle = symbol.handle();
+  for (auto slot = firstSlot(handle);; slot = (slot + 1) & (slots_.size() - 1)) {
+    if (slots_[slot].handle == handle) {
+      return false;
+    }
+    if (slots_[slot].handle == emptyHandle) {
+      slots_[slot] = Slot{handle, position};
+      ++size_;
+      return true;
+    }
+  }
+}
+
+SymbolIndex::Position
+SymbolIndex::find(const Symbol& symbol) const {
+  if (slots_.empty()) {
+    return npos;
+  }
+
+  const auto handle = symbol.handle();
+  // the table is never full so the probing always ends on a free slot
+  for (auto slot = firstSlot(handle);; slot = (slot + 1) & (slots_.size() - 1)) {
+    if (slots_[slot].handle == handle) {
+      return slots_[slot].position;
+    }
+    if (slots_[slot].handle == emptyHandle) {
+      return npos;
+    }
+  }
+}
+
+void
+SymbolIndex::rehash(std::size_t nbSlots) {
+  std::vector<Slot> oldSlots(nbSlots, Slot{emptyHandle, npos});
+  oldSlots.swap(slots_);
+  for (const auto& oldSlot : oldSlots) {
+    if (oldSlot.handle == emptyHandle) {
+      continue;
+    }
+    auto slot = firstSlot(oldSlot.handle);
+    while (slots_[slot].handle != emptyHandle) {
+      slot = (slot + 1) & (slots_.size() - 1);
+    }
+    slots_[slot] = oldSlot;
+  }
+}
+
+}  // namespace common
+}  // namespace dfl
@@ -19,18 +19,22 @@
 
 #include "Algo.h"
 #include "Constants.h"
+#include "DecompressedFile.h"
 #include "Diagram.h"
 #include "Dyd.h"
+#include "Islanding.h"
 #include "Job.h"
 #include "Log.h"
 #include "Message.hpp"
 #include "Par.h"
+#include "version.h"
 
 #include <DYNSimulation.h>
 #include <DYNSimulationContext.h>
 #include <algorithm>
 #include <boost/filesystem.hpp>
 #include <boost/make_shared.hpp>
+#include <functional>
 #include <tuple>
 
 namespace file = boost::filesystem;
@@ -38,17 +42,17 @@ namespace file = boost::filesystem;
 namespace dfl {
 Context::Context(const ContextDef& def, const inputs::Configuration& config) :
     def_(def),
-    networkManager_(def.networkFilepath),
+    networkManager_(def.networkFilepath, config.getNbThreads(), config.getNetworkCacheDir()),
     dynamicDataBaseManager_(def.settingFilePath, def.assemblingFilePath),
     config_(config),
     basename_{},
     slackNode_{},
     slackNodeOrigin_{SlackNodeOrigin::ALGORITHM},
-    generators_{},
+    generators_{networkManager_.getGenerators()},
     loads_{},
     jobEntry_{} {
   file::path path(def.networkFilepath);
-  basename_ = path.filename().replace_extension().generic_string();
+  basename_ = inputs::DecompressedFile::uncompressedFilename(path).replace_extension().generic_string();
 
   auto found_slack_node = networkManager_.getSlackNode();
   if (found_slack_node.is_initialized() && !config_.isAutomaticSlackBusOn()) {
@@ -61,26 +65,30 @@ Context::Context(const ContextDef& def, const inputs::Configuration& config) :
       // case slack node is requested to be extracted from IIDM but is not present in IIDM: we will compute it internally but a warning is sent
       LOG(warn) << MESS(NetworkSlackNodeNotFound, def.networkFilepath) << LOG_ENDL;
     }
-    networkManager_.onNode(algo::SlackNodeAlgorithm(slackNode_));
   }
-
-  networkManager_.onNode(algo::MainConnexComponentAlgorithm(mainConnexNodes_));
-  networkManager_.onNode(algo::DynModelAlgorithm(dynamicModels_, dynamicDataBaseManager_));
-  networkManager_.onNode(algo::ShuntCounterAlgorithm(counters_));
-  networkManager_.onNode(algo::LinesByIdAlgorithm(linesById_));
 }
 
 bool
 Context::checkConnexity() const {
   // The slack node must be in the main connex component
-  return std::find_if(mainConnexNodes_.begin(), mainConnexNodes_.end(),
-                      [this](const std::shared_ptr<inputs::Node>& node) { return node->id == slackNode_->id; }) != mainConnexNodes_.end();
+  return networkManager_.getIslands().isInMainIsland(slackNode_->index);
 }
 
 bool
 Context::process() {
   // Process all algorithms on nodes
-  networkManager_.walkNodes();
+  // The slack node, the shunt counters and the lines by id do not depend on the walk order: the nodes are walked in storage order
+  auto algorithms = algo::makeNodePipeline(algo::ShuntCounterAlgorithm(counters_), algo::LinesByIdAlgorithm(linesById_));
+  if (slackNodeOrigin_ == SlackNodeOrigin::ALGORITHM) {
+    networkManager_.walkNodes(algo::makeNodePipeline(algo::SlackNodeAlgorithm(slackNode_, networkManager_.getGraph()), std::ref(algorithms)));
+  } else {
+    networkManager_.walkNodes(algorithms);
+  }
+  // The main connex component is collected from its first node in the walk, and its order is the order of the generator and load definitions.
+  // The dynamic models are written in the order of their connection. Both are walked by id, so that the outputs are reproducible
+  networkManager_.walkNodesById(
+      algo::makeNodePipeline(algo::MainConnexComponentAlgorithm(mainConnexNodes_, networkManager_.getGraph(), networkManager_.getIslands()),
+                             algo::DynModelAlgorithm(dynamicModels_, dynamicDataBaseManager_)));
 
   // Check models generated with algorithm
   filterPartiallyConnectedDynamicModels();
@@ -95,20 +103,22 @@ Context::process() {
       LOG(warn) << MESS(ConnexityErrorReCompute, slackNode_->id) << LOG_ENDL;
       // Compute slack node only on main connex component
       slackNode_.reset();
-      std::for_each(mainConnexNodes_.begin(), mainConnexNodes_.end(), algo::SlackNodeAlgorithm(slackNode_));
+      std::for_each(mainConnexNodes_.begin(), mainConnexNodes_.end(), algo::SlackNodeAlgorithm(slackNode_, networkManager_.getGraph()));
 
       // By construction, the new slack node is in the main connex component
       LOG(info) << MESS(SlackNode, slackNode_->id, static_cast<unsigned int>(slackNodeOrigin_)) << LOG_ENDL;
     }
   }
 
-  onNodeOnMainConnexComponent(algo::GeneratorDefinitionAlgorithm(generators_, busesWithDynamicModel_, networkManager_.getMapBusGeneratorsBusId(),
-                                                                 config_.useInfiniteReactiveLimits(), networkManager_.dataInterface()->getServiceManager()));
-  onNodeOnMainConnexComponent(algo::LoadDefinitionAlgorithm(loads_, config_.getDsoVoltageLevel()));
-  onNodeOnMainConnexComponent(
-      algo::HVDCDefinitionAlgorithm(hvdcLineDefinitions_, config_.useInfiniteReactiveLimits(), networkManager_.getMapBusVSCConvertersBusId()));
-  onNodeOnMainConnexComponent(algo::StaticVarCompensatorAlgorithm(svarcsDefinitions_));
-  walkNodesMain();
+  auto mainAlgorithms = algo::makeNodePipeline(
+      algo::GeneratorDefinitionAlgorithm(generators_, busesWithDynamicModel_, networkManager_.getMapBusGeneratorsBusId(), config_.useInfiniteReactiveLimits(),
+                                         networkManager_.serviceManager()),
+      algo::LoadDefinitionAlgorithm(loads_, config_.getDsoVoltageLevel()),
+      algo::HVDCDefinitionAlgorithm(hvdcLineDefinitions_, config_.useInfiniteReactiveLimits(), networkManager_.getMapBusVSCConvertersBusId()),
+      algo::StaticVarCompensatorAlgorithm(svarcsDefinitions_));
+  for (const auto& node : mainConnexNodes_) {
+    mainAlgorithms(node);
+  }
 
   if (generators_.empty()) {
     // no generator is regulating the voltage in the main connex component : do not simulate
@@ -119,6 +129,185 @@ Context::process() {
   return true;
 }
 
+common::MemoryFootprint
+Context::memoryFootprint() const {
+  using common::memory::hashBytes;
+  using common::memory::stringBytes;
+  using common::memory::treeBytes;
+  using common::memory::vectorBytes;
+
+  common::MemoryFootprint footprint;
+  networkManager_.addMemoryFootprint(footprint);
+  dynamicDataBaseManager_.addMemoryFootprint(footprint);
+  footprint.add("symbols", common::Symbol::nbSymbols(), common::Symbol::memoryBytes());
+
+  footprint.add("definitions.mainConnexNodes", mainConnexNodes_.size(), vectorBytes(mainConnexNodes_));
+  footprint.add("definitions.generators", generators_.size(), vectorBytes(generators_.rows) + vectorBytes(generators_.models));
+  footprint.add("definitions.loads", loads_.size(), vectorBytes(loads_));
+  footprint.add("definitions.hvdcLines", hvdcLineDefinitions_.hvdcLines.size(),
+                hashBytes(hvdcLineDefinitions_.hvdcLines) + hashBytes(hvdcLineDefinitions_.vscBusVSCDefinitionsMap));
+  footprint.add("definitions.busesWithDynamicModel", busesWithDynamicModel_.size(), hashBytes(busesWithDynamicModel_));
+  footprint.add("definitions.dynamicModels", dynamicModels_.models.size(),
+                hashBytes(dynamicModels_.models,
+                          [](const std::pair<const algo::DynamicModelDefinition::DynModelId, algo::DynamicModelDefinition>& model) {
+                            return stringBytes(model.first) + stringBytes(model.second.id) + stringBytes(model.second.lib) +
+                                   treeBytes(model.second.nodeConnections, [](const algo::DynamicModelDefinition::MacroConnection& connection) {
+                                     return stringBytes(connection.id);
+                                   });
+                          }) +
+                    hashBytes(dynamicModels_.usedMacroConnections, [](const std::string& macroId) { return stringBytes(macroId); }));
+  footprint.add("definitions.shuntCounters", counters_.nbShunts.size(), hashBytes(counters_.nbShunts));
+  footprint.add("definitions.linesById", linesById_.linesMap.size(),
+                hashBytes(linesById_.linesMap,
+                          [](const std::pair<const inputs::Line::LineId, inputs::Line>& line) { return stringBytes(line.second.activeSeason); }));
+  footprint.add("definitions.staticVarCompensators", svarcsDefinitions_.svarcs.size(), vectorBytes(svarcsDefinitions_.svarcs));
+  return footprint;
+}
+
+/**
+ * @brief Add the points of a reactive capability curve to a fingerprint
+ *
+ * @param fingerprint the fingerprint to update
+ * @param points the points of the curve
+ */
+static void
+addPoints(common::Fingerprint& fingerprint, const inputs::ReactiveCurveStore::Points& points) {
+  fingerprint.add(static_cast<std::uint64_t>(points.size()));
+  for (const auto& point : points) {
+    fingerprint.add(point.p).add(point.qmin).add(point.qmax);
+  }
+}
+
+/**
+ * @brief Add a VSC converter definition, with its diagram, to a fingerprint
+ *
+ * @param fingerprint the fingerprint to update
+ * @param vsc the VSC converter definition
+ * @param curves the store of the reactive capability curves
+ */
+static void
+addVSCDefinition(common::Fingerprint& fingerprint, const algo::VSCDefinition& vsc, const inputs::ReactiveCurveStore& curves) {
+  fingerprint.add(vsc.id.str()).add(vsc.qmax).add(vsc.qmin).add(vsc.pmax).add(vsc.pmin);
+  addPoints(fingerprint, curves.points(vsc.curve));
+}
+
+common::Fingerprint
+Context::fingerprint() const {
+  const auto& curves = networkManager_.getReactiveCurves();
+  common::Fingerprint fingerprint;
+  fingerprint.add(DYNAFLOW_LAUNCHER_VERSION_STRING).add(basename_).add(def_.dynawoLogLevel);
+
+  // configuration fields used by the writers
+  fingerprint.add(static_cast<std::uint64_t>(config_.getActivePowerCompensation()))
+      .add(config_.useInfiniteReactiveLimits())
+      .add(config_.isPSTRegulationOn())
+      .add(config_.isSVCRegulationOn())
+      .add(config_.isShuntRegulationOn())
+      .add(config_.isAutomaticSlackBusOn())
+      .add(config_.getDsoVoltageLevel());
+
+  // dynamic data base and constant parameter files
+  fingerprint.addFile(def_.settingFilePath).addFile(def_.assemblingFilePath);
+  std::vector<file::path> parFiles;
+  for (auto& entry : boost::make_iterator_range(file::directory_iterator(def_.parFileDir))) {
+    if (entry.path().extension() == ".par") {
+      parFiles.push_back(entry.path());
+    }
+  }
+  fingerprint.addUnordered(parFiles, [](common::Fingerprint& parFingerprint, const file::path& parFile) { parFingerprint.addFile(parFile); });
+
+  // definitions of the main connex component, the ordered ones being exported in their order
+  fingerprint.add(slackNode_->id.str()).add(static_cast<std::uint64_t>(slackNodeOrigin_));
+  const auto& table = generators_.table;
+  fingerprint.add(static_cast<std::uint64_t>(generators_.size()));
+  for (std::size_t i = 0; i < generators_.size(); ++i) {
+    const auto row = generators_.rows[i];
+    fingerprint.add(table.ids()[row].str())
+        .add(static_cast<std::uint64_t>(generators_.models[i]))
+        .add(table.qmin()[row])
+        .add(table.qmax()[row])
+        .add(table.pmin()[row])
+        .add(table.pmax()[row])
+        .add(table.targetP()[row])
+        .add(table.regulatedBusIds()[row].str())
+        .add(table.connectedBusIds()[row].str());
+    addPoints(fingerprint, table.points(row));
+  }
+  fingerprint.add(static_cast<std::uint64_t>(loads_.size()));
+  for (const auto& load : loads_) {
+    fingerprint.add(load.id.str()).add(load.nodeId.str());
+  }
+  fingerprint.addUnordered(hvdcLineDefinitions_.hvdcLines,
+                           [&curves](common::Fingerprint& hvdcFingerprint, const algo::HVDCLineDefinitions::HvdcLineMap::value_type& hvdcLine) {
+                             const auto& hvdc = hvdcLine.second;
+                             hvdcFingerprint.add(hvdc.id.str())
+                                 .add(static_cast<std::uint64_t>(hvdc.converterType))
+                                 .add(hvdc.converter1Id.str())
+                                 .add(hvdc.converter1BusId.str())
+                                 .add(hvdc.converter1VoltageRegulationOn)
+                                 .add(hvdc.converter2Id.str())
+                                 .add(hvdc.converter2BusId.str())
+                                 .add(hvdc.converter2VoltageRegulationOn)
+                                 .add(static_cast<std::uint64_t>(hvdc.position))
+                                 .add(static_cast<std::uint64_t>(hvdc.model))
+                                 .add(hvdc.powerFactors[0])
+                                 .add(hvdc.powerFactors[1])
+                                 .add(hvdc.pMax)
+                                 .add(hvdc.droop);
+                             for (const auto& vsc : {hvdc.vscDefinition1, hvdc.vscDefinition2}) {
+                               hvdcFingerprint.add(static_cast<bool>(vsc));
+                               if (vsc) {
+                                 addVSCDefinition(hvdcFingerprint, *vsc, curves);
+                               }
+                             }
+                           });
+  fingerprint.addUnordered(hvdcLineDefinitions_.vscBusVSCDefinitionsMap,
+                           [&curves](common::Fingerprint& vscFingerprint, const algo::HVDCLineDefinitions::BusVSCMap::value_type& busVSC) {
+                             vscFingerprint.add(busVSC.first.str());
+                             addVSCDefinition(vscFingerprint, busVSC.second, curves);
+                           });
+  fingerprint.addUnordered(busesWithDynamicModel_,
+                           [](common::Fingerprint& busFingerprint, const algo::GeneratorDefinitionAlgorithm::BusGenMap::value_type& busGen) {
+                             busFingerprint.add(busGen.first.str()).add(busGen.second.str());
+                           });
+  fingerprint.addUnordered(dynamicModels_.models,
+                           [](common::Fingerprint& modelFingerprint,
+                              const std::pair<const algo::DynamicModelDefinition::DynModelId, algo::DynamicModelDefinition>& model) {
+                             modelFingerprint.add(model.second.id).add(model.second.lib).add(static_cast<std::uint64_t>(model.second.nodeConnections.size()));
+                             for (const auto& connection : model.second.nodeConnections) {
+                               modelFingerprint.add(connection.id)
+                                   .add(static_cast<std::uint64_t>(connection.elementType))
+                                   .add(connection.connectedElementId.str());
+                             }
+                           });
+  fingerprint.addUnordered(dynamicModels_.usedMacroConnections,
+                           [](common::Fingerprint& macroFingerprint, const std::string& macroId) { macroFingerprint.add(macroId); });
+  fingerprint.addUnordered(counters_.nbShunts,
+                           [](common::Fingerprint& counterFingerprint, const std::pair<const inputs::VoltageLevel::VoltageLevelId, unsigned int>& counter) {
+                             counterFingerprint.add(counter.first.str()).add(static_cast<std::uint64_t>(counter.second));
+                           });
+  fingerprint.addUnordered(linesById_.linesMap,
+                           [](common::Fingerprint& lineFingerprint, const std::pair<const inputs::Line::LineId, inputs::Line>& line) {
+                             lineFingerprint.add(line.first.str()).add(line.second.activeSeason);
+                           });
+  fingerprint.add(static_cast<std::uint64_t>(svarcsDefinitions_.svarcs.size()));
+  for (const auto& svarcRef : svarcsDefinitions_.svarcs) {
+    const auto& svarc = svarcRef.get();
+    fingerprint.add(svarc.id.str())
+        .add(svarc.bMin)
+        .add(svarc.bMax)
+        .add(svarc.voltageSetPoint)
+        .add(svarc.VNom)
+        .add(svarc.UMinActivation)
+        .add(svarc.UMaxActivation)
+        .add(svarc.USetPointMin)
+        .add(svarc.USetPointMax)
+        .add(svarc.b0)
+        .add(svarc.slope);
+  }
+  return fingerprint;
+}
+
 void
 Context::filterPartiallyConnectedDynamicModels() {
   const auto& automatonsConfig = dynamicDataBaseManager_.assemblingDocument().dynamicAutomatons();
@@ -152,18 +341,18 @@ Context::exportOutputs() {
   outputs::Job jobWriter(outputs::Job::JobDefinition(basename_, def_.dynawoLogLevel));
   jobEntry_ = jobWriter.write();
 #if _DEBUG_
-  outputs::Job::exportJob(jobEntry_, absolute(def_.networkFilepath.generic_string()), config_.outputDir().generic_string());
+  // the exported job is run by Dynawo alone, which reads only uncompressed network files
+  file::path networkFilepath = absolute(def_.networkFilepath);
+  if (inputs::DecompressedFile::isCompressed(networkFilepath)) {
+    file::create_directories(outputDir);
+    const file::path decompressedFilepath = outputDir / inputs::DecompressedFile::uncompressedFilename(networkFilepath);
+    inputs::DecompressedFile::decompress(networkFilepath, decompressedFilepath);
+    networkFilepath = absolute(decompressedFilepath);
+  }
+  outputs::Job::exportJob(jobEntry_, networkFilepath.generic_string(), config_.outputDir().generic_string());
 #endif
 
-  // Dyd
-  file::path dydOutput(config_.outputDir());
-  dydOutput.append(basename_ + ".dyd");
-  outputs::Dyd dydWriter(outputs::Dyd::DydDefinition(basename_, dydOutput.generic_string(), generators_, loads_, slackNode_, hvdcLineDefinitions_,
-                                                     busesWithDynamicModel_, dynamicDataBaseManager_, dynamicModels_, svarcsDefinitions_));
-  dydWriter.write();
-
-  // Par
-  // copy constants files
+  // Par: constants files are copied on each run, so that they are always present in the output directory
   for (auto& entry : boost::make_iterator_range(file::directory_iterator(def_.parFileDir))) {
     if (entry.path().extension() == ".par") {
       file::path dest(outputDir);
@@ -171,19 +360,53 @@ Context::exportOutputs() {
       file::copy_file(entry.path(), dest, file::copy_option::overwrite_if_exists);
     }
   }
-  // create specific par
+
+  // Dyd, specific Par and Diagram: skipped if the output directory already contains the outputs of the same process
+  file::path dydOutput(config_.outputDir());
+  dydOutput.append(basename_ + ".dyd");
   file::path parOutput(config_.outputDir());
   parOutput.append(basename_ + ".par");
-  outputs::Par parWriter(outputs::Par::ParDefinition(basename_, config_.outputDir(), parOutput, generators_, hvdcLineDefinitions_,
-                                                     config_.getActivePowerCompensation(), busesWithDynamicModel_, dynamicDataBaseManager_, counters_,
-                                                     dynamicModels_, linesById_, svarcsDefinitions_));
-  parWriter.write();
-
-  // Diagram
   file::path diagramDirectory(config_.outputDir());
   diagramDirectory.append(basename_ + outputs::constants::diagramDirectorySuffix);
-  outputs::Diagram diagramWriter(outputs::Diagram::DiagramDefinition(basename_, diagramDirectory.generic_string(), generators_, hvdcLineDefinitions_));
-  diagramWriter.write();
+  file::path fingerprintOutput(config_.outputDir());
+  fingerprintOutput.append(basename_ + outputs::constants::fingerprintFileSuffix);
+  outputs::Diagram diagramWriter(outputs::Diagram::DiagramDefinition(basename_, diagramDirectory.generic_string(), generators_, hvdcLineDefinitions_,
+                                                                     networkManager_.getReactiveCurves()));
+  const auto diagramFiles = diagramWriter.filepaths();
+
+  const auto processFingerprint = fingerprint();
+  const auto previousFingerprint = common::Fingerprint::load(fingerprintOutput);
+  if (previousFingerprint && *previousFingerprint == processFingerprint.str() && file::exists(dydOutput) && file::exists(parOutput) &&
+      std::all_of(diagramFiles.begin(), diagramFiles.end(), [](const file::path& diagramFile) { return file::exists(diagramFile); })) {
+    LOG(info) << MESS(OutputsUnchanged, basename_, processFingerprint.str()) << LOG_ENDL;
+  } else {
+    // removed first, so that an interrupted export is never taken as complete
+    file::remove(fingerprintOutput);
+
+    // Dyd
+    outputs::Dyd dydWriter(outputs::Dyd::DydDefinition(basename_, dydOutput.generic_string(), generators_, loads_, slackNode_, hvdcLineDefinitions_,
+                                                       busesWithDynamicModel_, dynamicDataBaseManager_, dynamicModels_, svarcsDefinitions_));
+    dydWriter.write();
+
+    // Par
+    outputs::Par parWriter(outputs::Par::ParDefinition(basename_, config_.outputDir(), parOutput, generators_, hvdcLineDefinitions_,
+                                                       config_.getActivePowerCompensation(), busesWithDynamicModel_, dynamicDataBaseManager_, counters_,
+                                                       dynamicModels_, linesById_, svarcsDefinitions_));
+    parWriter.write();
+
+    // Diagram
+    diagramWriter.write();
+
+    processFingerprint.save(fingerprintOutput);
+  }
+
+  // Islanding report
+  file::path islandingOutput(config_.outputDir());
+  islandingOutput.append(basename_ + outputs::constants::islandingFileSuffix);
+  auto detachedParts = networkManager_.computeDetachedParts();
+  LOG(info) << MESS(IslandingInfo, detachedParts.size(), islandingOutput.generic_string()) << LOG_ENDL;
+  outputs::Islanding islandingWriter(outputs::Islanding::IslandingDefinition(islandingOutput.generic_string(), detachedParts));
+  islandingWriter.write();
 }
 
 void
@@ -209,13 +432,4 @@ Context::execute() {
   simu->clean();
 }
 
-void
-Context::walkNodesMain() const {
-  for (const auto& node : mainConnexNodes_) {
-    for (const auto& cbk : callbacksMainConnexComponent_) {
-      cbk(node);
-    }
-  }
-}
-
 }  // namespace dfl
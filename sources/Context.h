@@ -20,6 +20,8 @@
 #include "Algo.h"
 #include "Configuration.h"
 #include "DynamicDataBaseManager.h"
+#include "Fingerprint.h"
+#include "MemoryFootprint.h"
 #include "NetworkManager.h"
 
 #include <JOBJobEntry.h>
@@ -77,10 +79,32 @@ class Context {
    */
   bool process();
 
+  /**
+   * @brief Estimate the memory footprint of the network model and of the definitions computed by the process
+   *
+   * @returns the footprint of the node tree, of the dynamic data base, of the symbol table and of the definitions
+   */
+  common::MemoryFootprint memoryFootprint() const;
+
+  /**
+   * @brief Compute the fingerprint of the inputs of the output files
+   *
+   * The fingerprint covers everything the exported files depend on: the definitions computed by the process on the main
+   * connex component, with their models, the content of the diagrams, the configuration fields used by the writers and
+   * the content of the dynamic data base and of the constant parameter files. Two processes with the same fingerprint
+   * export the same files.
+   *
+   * @returns the fingerprint, independent of the iteration order of the unordered definitions
+   */
+  common::Fingerprint fingerprint() const;
+
   /**
    * @brief Export output files
    *
    * This create the job entry, exports all intermediate files for dynawo simulation and create dynawo simulation
+   *
+   * The fingerprint of the process is saved next to the outputs: the intermediate files are not written again when
+   * the output directory already contains the outputs of a process with the same fingerprint.
    */
   void exportOutputs();
 
@@ -109,20 +133,6 @@ class Context {
    */
   bool checkConnexity() const;
 
-  /**
-   * @brief Register a callback to call at each node
-   *
-   * @param cbk the callback to register
-   */
-  void onNodeOnMainConnexComponent(inputs::NetworkManager::ProcessNodeCallback&& cbk) {
-    callbacksMainConnexComponent_.push_back(std::forward<inputs::NetworkManager::ProcessNodeCallback>(cbk));
-  }
-
-  /**
-   * @brief Walk through all nodes in main connex components and apply callbacks
-   */
-  void walkNodesMain() const;
-
   /**
    * @brief Filter partially connected dynamic models
    *
@@ -136,13 +146,12 @@ class Context {
   inputs::DynamicDataBaseManager dynamicDataBaseManager_;  ///< dynamic model configuration manager
   const inputs::Configuration& config_;                    ///< configuration
 
-  std::string basename_;                                                                   ///< basename for all files
-  std::vector<inputs::NetworkManager::ProcessNodeCallback> callbacksMainConnexComponent_;  ///< List of algorithms to run in main components
+  std::string basename_;  ///< basename for all files
 
   std::shared_ptr<inputs::Node> slackNode_;                              ///< computed slack node
   SlackNodeOrigin slackNodeOrigin_;                                      ///< slack node origin
   std::vector<std::shared_ptr<inputs::Node>> mainConnexNodes_;           ///< main connex component
-  std::vector<algo::GeneratorDefinition> generators_;                    ///< generators found
+  algo::GeneratorDefinitions generators_;                                ///< generators found, referring to the generator table of the network manager
   std::vector<algo::LoadDefinition> loads_;                              ///< loads found
   algo::HVDCLineDefinitions hvdcLineDefinitions_;                        ///< hvdc definitions
   algo::GeneratorDefinitionAlgorithm::BusGenMap busesWithDynamicModel_;  ///< map of bus ids to a generator that regulates them
@@ -17,9 +17,11 @@
 
 #pragma once
 
-#include <DYNGeneratorInterface.h>
-#include <DYNVscConverterInterface.h>
+#include "ReactiveCurveStore.h"
+#include "Symbol.h"
+
 #include <boost/optional.hpp>
+#include <cassert>
 #include <string>
 
 namespace dfl {
@@ -29,140 +31,138 @@ namespace inputs {
  * @brief Load behaviour
  */
 struct Load {
-  using LoadId = std::string;  ///< alias for id
+  using LoadId = common::Symbol;  ///< alias for id
 
   /**
    * @brief Constructor
    *
    * @param loadId the id of the load
+   * @param p0 the active power of the load
    */
-  explicit Load(const LoadId& loadId) : id{loadId} {}
+  explicit Load(const LoadId& loadId, double p0 = 0.) : id{loadId}, p0{p0} {}
 
   LoadId id;  ///< load id
+  double p0;  ///< active power of the load
 };
 
-/**
- * @brief Generator behaviour
- */
-struct Generator {
-  using GeneratorId = std::string;                                         ///< alias for id
-  using ReactiveCurvePoint = DYN::GeneratorInterface::ReactiveCurvePoint;  ///< alias for point type
-  using BusId = std::string;                                               ///< alias of BusId
+class HvdcLine;
 
+/// @brief LCC converter specific data
+struct LCCConverter {
   /**
    * @brief Constructor
    *
-   * @param genId the id of the generator
-   * @param curvePoints the list of reactive capabilities curve points
-   * @param qmin minimum reactive power for the generator
-   * @param qmax maximum reactive power for the generator
-   * @param pmin minimum active power for the generator
-   * @param pmax maximum active power for the generator
-   * @param targetP target active power of the generator
-   * @param regulatedBusId the Bus Id this generator is regulating
-   * @param connectedBusId the Bus Id this generator is connected to
+   * @param powerFactor the power factor of the LCC converter
    */
-  explicit Generator(const GeneratorId& genId, const std::vector<ReactiveCurvePoint>& curvePoints, double qmin, double qmax, double pmin, double pmax,
-                     double targetP, const BusId& regulatedBusId, const BusId& connectedBusId) :
-      id{genId},
-      points(curvePoints),
-      qmin{qmin},
-      qmax{qmax},
-      pmin{pmin},
-      pmax{pmax},
-      targetP{targetP},
-      regulatedBusId{regulatedBusId},
-      connectedBusId{connectedBusId} {}
-
-  GeneratorId id;                          ///< generator id
-  std::vector<ReactiveCurvePoint> points;  ///< reactive points
-  double qmin;                             ///< minimum reactive power
-  double qmax;                             ///< maximum reactive power
-  double pmin;                             ///< minimum active power
-  double pmax;                             ///< maximum active power
-  double targetP;                          ///< target active power of the generator
-  const BusId regulatedBusId;              ///< regulated Bus Id
-  const BusId connectedBusId;              ///< connected Bus Id
+  explicit LCCConverter(double powerFactor) : powerFactor{powerFactor} {}
+
+  const double powerFactor;  ///< power factor
+};
+
+/// @brief VSC converter specific data
+struct VSCConverter {
+  using CurveId = ReactiveCurveStore::CurveId;  ///< alias for curve id
+
+  /**
+   * @brief Constructor
+   *
+   * @param voltageRegulationOn boolean for the voltage regulation parameter
+   * @param qMax maximum reactive power of the converter
+   * @param qMin minimum reactive power of the converter
+   * @param curve the reactive capability curve of the converter in the curve store
+   */
+  VSCConverter(bool voltageRegulationOn, double qMax, double qMin, CurveId curve) :
+      qMax{qMax},
+      qMin{qMin},
+      curve{curve},
+      voltageRegulationOn{voltageRegulationOn} {}
+
+  const double qMax;               ///< maximum q of the converter
+  const double qMin;               ///< minimum q of the converter
+  const CurveId curve;             ///< reactive capability curve
+  const bool voltageRegulationOn;  ///< determines if voltage regulation is enabled
 };
 
-class HvdcLine;
 /**
  * @brief Converter behaviour
+ *
+ * Closed variant of the LCC and VSC converters: the specific data are stored inline and selected by the type of the converter,
+ * so that no virtual call nor dynamic cast is required to process a converter.
  */
 struct Converter {
-  using ConverterId = std::string;  ///< alias for id
-  using BusId = std::string;        ///< alias for bus id
+  using ConverterId = common::Symbol;  ///< alias for id
+  using BusId = common::Symbol;        ///< alias for bus id
+
+  /// @brief Type of converter
+  enum class Type {
+    VSC,  ///< voltage source converter
+    LCC   ///< line-commutated converter
+  };
 
   /**
-   * @brief Constructor
+   * @brief Constructor of a LCC converter
    *
    * @param converterId the id of the converter
    * @param busId the id of the bus
    * @param hvdcLine the hvdc line this converter is contained into
+   * @param lcc the LCC specific data
    */
-  Converter(const ConverterId& converterId, const BusId& busId, std::shared_ptr<HvdcLine> hvdcLine) :
+  Converter(const ConverterId& converterId, const BusId& busId, HvdcLine* hvdcLine, const LCCConverter& lcc) :
       converterId{converterId},
       busId{busId},
-      hvdcLine{hvdcLine} {}
-
-  /// @brief Destructor
-  virtual ~Converter() {}
-
-  const ConverterId converterId;  ///< converter id
-  const BusId busId;              ///< bus id
-  // not const to allow further connection after construction
-  std::shared_ptr<HvdcLine> hvdcLine;  ///< hvdc line this converter is contained into
-};
+      hvdcLine{hvdcLine},
+      type{Type::LCC},
+      lcc_(lcc) {}
 
-/// @brief LCC converter
-struct LCCConverter : public Converter {
   /**
-   * @brief Constructor
+   * @brief Constructor of a VSC converter
    *
    * @param converterId the id of the converter
    * @param busId the id of the bus
    * @param hvdcLine the hvdc line this converter is contained into
-   * @param powerFactor the power factor of the LCC converter
+   * @param vsc the VSC specific data
    */
-  LCCConverter(const ConverterId& converterId, const BusId& busId, std::shared_ptr<HvdcLine> hvdcLine, double powerFactor) :
-      Converter(converterId, busId, hvdcLine),
-      powerFactor{powerFactor} {}
-
-  const double powerFactor;  ///< power factor
-};
+  Converter(const ConverterId& converterId, const BusId& busId, HvdcLine* hvdcLine, const VSCConverter& vsc) :
+      converterId{converterId},
+      busId{busId},
+      hvdcLine{hvdcLine},
+      type{Type::VSC},
+      vsc_(vsc) {}
 
-/// @brief VSC converter
-struct VSCConverter : public Converter {
-  using ReactiveCurvePoint = DYN::VscConverterInterface::ReactiveCurvePoint;  ///< alias for point type
+  /**
+   * @brief Retrieve the LCC specific data
+   * @returns the LCC data, the converter must be a LCC converter
+   */
+  const LCCConverter& lcc() const {
+    assert(type == Type::LCC);
+    return lcc_;
+  }
 
   /**
-   * @brief Constructor
-   *
-   * @param converterId the id of the converter
-   * @param busId the id of the bus
-   * @param hvdcLine the hvdc line this converter is contained into
-   * @param voltageRegulationOn optional boolean for the voltage regulation parameter, only used for VSC converters
-   * @param qMax maximum reactive power of the converter
-   * @param qMin minimum reactive power of the converter
-   * @param points the reactive curve points
+   * @brief Retrieve the VSC specific data
+   * @returns the VSC data, the converter must be a VSC converter
    */
-  VSCConverter(const ConverterId& converterId, const BusId& busId, std::shared_ptr<HvdcLine> hvdcLine, bool voltageRegulationOn, double qMax, double qMin,
-               const std::vector<ReactiveCurvePoint>& points) :
-      Converter(converterId, busId, hvdcLine),
-      qMax{qMax},
-      qMin{qMin},
-      points(points),
-      voltageRegulationOn{voltageRegulationOn} {}
+  const VSCConverter& vsc() const {
+    assert(type == Type::VSC);
+    return vsc_;
+  }
 
-  const double qMax;                             ///< maximum q of the converter
-  const double qMin;                             ///< minimum q of the converter
-  const std::vector<ReactiveCurvePoint> points;  ///< reactive points
-  const bool voltageRegulationOn;                ///< determines if voltage regulation is enabled
+  const ConverterId converterId;  ///< converter id
+  const BusId busId;              ///< bus id
+  // not const to allow further connection after construction
+  HvdcLine* hvdcLine;  ///< hvdc line this converter is contained into, not owning
+  const Type type;     ///< type of converter, selecting the specific data
+
+ private:
+  union {
+    LCCConverter lcc_;  ///< LCC specific data, when type is LCC
+    VSCConverter vsc_;  ///< VSC specific data, when type is VSC
+  };
 };
 
 /// @brief Static var compensator (SVarC) behaviour
 struct StaticVarCompensator {
-  using SVarCid = std::string;  ///< alias for static var compensator id
+  using SVarCid = common::Symbol;  ///< alias for static var compensator id
 
   /**
    * @brief Constructor
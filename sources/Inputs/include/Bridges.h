@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Bridges.h
+ *
+ * @brief Topological bridges and articulation points header file
+ *
+ */
+
+#pragma once
+
+#include "Graph.h"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Bridges and articulation points of the network
+ *
+ * A bridge is a closed edge whose opening splits its island, an articulation point is a node whose removal splits its island.
+ * They are found by a single depth-first search over the closed edges (Tarjan's lowpoint algorithm). The depth-first search tree
+ * is kept: the part split from its island by a bridge is the subtree below the bridge, which is a contiguous range of the nodes
+ * in depth-first order.
+ */
+class Bridges {
+ public:
+  static constexpr Graph::EdgeIndex noEdge = std::numeric_limits<Graph::EdgeIndex>::max();  ///< Parent edge of the roots of the search
+
+  /**
+   * @brief Compute the bridges and articulation points of a graph
+   *
+   * Non-recursive depth-first search, in linear time in the number of nodes and edges. Parallel edges are not bridges.
+   *
+   * @param graph the topological graph
+   * @returns the bridges and articulation points of the graph
+   */
+  static Bridges compute(const Graph& graph);
+
+  /// @brief Default constructor: no bridge
+  Bridges() = default;
+
+  /**
+   * @brief Determines if an edge is a bridge
+   *
+   * @param edge the edge index
+   * @returns @b true if opening the edge splits its island, @b false if not
+   */
+  bool isBridge(Graph::EdgeIndex edge) const {
+    return bridges_[edge] != 0;
+  }
+
+  /**
+   * @brief Determines if a node is an articulation point
+   *
+   * @param index the node index
+   * @returns @b true if removing the node splits its island, @b false if not
+   */
+  bool isArticulationPoint(Graph::NodeIndex index) const {
+    return articulationPoints_[index] != 0;
+  }
+
+  /**
+   * @brief Retrieve the nodes in depth-first order
+   *
+   * @returns the node indexes, in the order of their discovery by the search
+   */
+  const std::vector<Graph::NodeIndex>& orderedNodes() const {
+    return orderedNodes_;
+  }
+
+  /**
+   * @brief Retrieve the position of a node in depth-first order
+   *
+   * @param index the node index
+   * @returns the position of the node in orderedNodes()
+   */
+  std::size_t order(Graph::NodeIndex index) const {
+    return orders_[index];
+  }
+
+  /**
+   * @brief Retrieve the number of nodes of the subtree of a node
+   *
+   * The nodes of the subtree are the ones following the node in depth-first order
+   *
+   * @param index the node index
+   * @returns the number of nodes of the subtree, the node included
+   */
+  std::size_t subtreeSize(Graph::NodeIndex index) const {
+    return subtreeSizes_[index];
+  }
+
+  /**
+   * @brief Retrieve the root of the subtree below a bridge
+   *
+   * The nodes of this subtree are the ones split from their island when the bridge is opened
+   *
+   * @param graph the topological graph
+   * @param bridge the bridge
+   * @returns the extremity of the bridge which is a child in the depth-first search tree
+   */
+  Graph::NodeIndex subtreeRoot(const Graph& graph, Graph::EdgeIndex bridge) const {
+    return (parentEdges_[graph.edgeNode1(bridge)] == bridge) ? graph.edgeNode1(bridge) : graph.edgeNode2(bridge);
+  }
+
+ private:
+  std::vector<std::uint8_t> bridges_;             ///< whether each edge is a bridge, by edge index
+  std::vector<std::uint8_t> articulationPoints_;  ///< whether each node is an articulation point, by node index
+  std::vector<Graph::NodeIndex> orderedNodes_;    ///< node indexes in depth-first order
+  std::vector<std::uint32_t> orders_;             ///< position of each node in depth-first order, by node index
+  std::vector<std::uint32_t> subtreeSizes_;       ///< number of nodes of the subtree of each node, by node index
+  std::vector<Graph::EdgeIndex> parentEdges_;     ///< edge to the parent of each node in the search tree, by node index
+};
+
+}  // namespace inputs
+}  // namespace dfl
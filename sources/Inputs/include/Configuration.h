@@ -80,6 +80,15 @@ class Configuration {
     return isAutomaticSlackBusOn_;
   }
 
+  /**
+   * @brief determines if the topology of the network file is pre-scanned, to reject unusable networks before building the data interface
+   *
+   * @returns the parameter value
+   */
+  bool isNetworkPrescanOn() const {
+    return isNetworkPrescanOn_;
+  }
+
   /**
    * @brief Retrieves the output directory
    *
@@ -98,6 +107,24 @@ class Configuration {
     return dsoVoltageLevel_;
   }
 
+  /**
+   * @brief Retrieves the number of threads to use for the topological computations
+   *
+   * @returns the parameter value
+   */
+  unsigned int getNbThreads() const {
+    return nbThreads_;
+  }
+
+  /**
+   * @brief Retrieves the directory of the network cache files
+   *
+   * @returns the parameter value, empty if the network tree is not cached
+   */
+  const boost::filesystem::path& getNetworkCacheDir() const {
+    return networkCacheDir_;
+  }
+
   /**
    * @brief type of active power compensation for generator
    */
@@ -138,8 +165,11 @@ class Configuration {
   bool isSVCRegulationOn_ = true;                                                    ///< SVC regulation on
   bool isShuntRegulationOn_ = true;                                                  ///< Shunt regulation on
   bool isAutomaticSlackBusOn_ = true;                                                ///< automatic slack bus on
+  bool isNetworkPrescanOn_ = false;                                                  ///< network topology pre-scan on
   boost::filesystem::path outputDir_ = boost::filesystem::current_path();            ///< Directory for output files
   double dsoVoltageLevel_ = 45.0;                                                    ///< Minimum voltage level of the load to be taken into account
+  unsigned int nbThreads_ = 1;                                                       ///< Number of threads for the topological computations
+  boost::filesystem::path networkCacheDir_;                                          ///< Directory of the network cache files
   ActivePowerCompensation activePowerCompensation_ = ActivePowerCompensation::PMAX;  ///< Type of active power compensation
   boost::filesystem::path settingFilePath_;                                          ///< setting file path
   boost::filesystem::path assemblingFilePath_;                                       ///< assembling file path
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  DecompressedFile.h
+ *
+ * @brief Decompressed input file header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <exception>
+#include <functional>
+#include <future>
+#include <thread>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Input file, decompressed if it is compressed
+ *
+ * Compressed files (gzip, bzip2, xz, zstd) are detected from their magic number, whatever their extension. They are given to the reader
+ * as a named pipe in a temporary directory, fed by a thread decompressing the file by blocks while the reader reads the pipe: the
+ * decompressed content is streamed to the reader, without being written to disk nor fully loaded in memory. The pipe can be read
+ * only once, sequentially. Files which are not compressed are used in place.
+ */
+class DecompressedFile {
+ public:
+  /**
+   * @brief Constructor, starting the decompression if the file is compressed
+   *
+   * Throws a std::runtime_error if the named pipe cannot be created
+   *
+   * @param filepath the input file, compressed or not
+   */
+  explicit DecompressedFile(const boost::filesystem::path& filepath);
+
+  /**
+   * @brief Destructor, stopping the decompression and removing the named pipe if any
+   */
+  ~DecompressedFile();
+
+  DecompressedFile(const DecompressedFile&) = delete;
+  DecompressedFile& operator=(const DecompressedFile&) = delete;
+
+  /**
+   * @brief Retrieve the path to read the decompressed content from
+   *
+   * @returns the path of the named pipe if the input file is compressed, the input file if not
+   */
+  const boost::filesystem::path& filepath() const {
+    return filepath_;
+  }
+
+  /**
+   * @brief Stop the decompression, once the reader is done with the named pipe
+   *
+   * The part of the content that the reader did not read is not decompressed. Nothing is done if the input file is not compressed.
+   *
+   * Throws a std::runtime_error if the part of the file given to the reader could not be decompressed
+   */
+  void close();
+
+  /**
+   * @brief Read the content of a file by blocks, decompressing it on the fly if it is compressed
+   *
+   * Throws a std::runtime_error if the file cannot be read or decompressed
+   *
+   * @param filepath the file, compressed or not
+   * @param onBlock the function called on each block of content, in order
+   */
+  static void read(const boost::filesystem::path& filepath, const std::function<void(const char* data, std::size_t size)>& onBlock);
+
+  /**
+   * @brief Decompress a file into another file
+   *
+   * Throws a std::runtime_error if the file cannot be read, decompressed or written
+   *
+   * @param filepath the file, compressed or not
+   * @param decompressedFilepath the file to write the decompressed content to
+   */
+  static void decompress(const boost::filesystem::path& filepath, const boost::filesystem::path& decompressedFilepath);
+
+  /**
+   * @brief Determines if a file is compressed
+   *
+   * @param filepath the file
+   * @returns @b true if the file is compressed with a supported format, @b false if not
+   */
+  static bool isCompressed(const boost::filesystem::path& filepath);
+
+  /**
+   * @brief Retrieve the name of a file without its compression extension
+   *
+   * @param filepath the file
+   * @returns the file name, without its last extension if it is a compression one (.gz, .bz2, .xz, .zst)
+   */
+  static boost::filesystem::path uncompressedFilename(const boost::filesystem::path& filepath);
+
+ private:
+  /**
+   * @brief Decompress the input file into the named pipe, in the decompression thread
+   *
+   * @param filepath the input file
+   */
+  void feed(const boost::filesystem::path& filepath);
+
+  /**
+   * @brief Stop the decompression thread
+   *
+   * A thread waiting for a reader of the named pipe is released by opening the pipe without reading it. The decompression then stops
+   * as soon as it writes to the pipe, which has no reader anymore.
+   */
+  void stop();
+
+ private:
+  boost::filesystem::path temporaryDir_;  ///< directory of the named pipe, empty if the input file is not compressed
+  boost::filesystem::path filepath_;      ///< path of the file to read
+  std::promise<void> opened_;             ///< set once the decompression thread opened the named pipe, or failed to
+  std::thread decompression_;             ///< thread decompressing the input file into the named pipe
+  std::exception_ptr error_;              ///< error of the decompression, null if none
+};
+
+}  // namespace inputs
+}  // namespace dfl
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "AssemblingXmlDocument.h"
+#include "MemoryFootprint.h"
 #include "SettingXmlDocument.h"
 
 #include <boost/filesystem.hpp>
@@ -47,6 +48,15 @@ class DynamicDataBaseManager {
     return settingDoc_;
   }
 
+  /**
+   * @brief Add the memory footprint of the parsed setting and assembling documents
+   *
+   * The structures are named "dynamicDataBase.setting" and "dynamicDataBase.assembling"
+   *
+   * @param footprint the footprint to complete
+   */
+  void addMemoryFootprint(common::MemoryFootprint& footprint) const;
+
  public:
   /**
    * @brief Constructor
@@ -0,0 +1,192 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  GeneratorTable.h
+ *
+ * @brief Columnar generator table header file
+ *
+ */
+
+#pragma once
+
+#include "ReactiveCurveStore.h"
+#include "Symbol.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Table of the generators of the network, stored by columns
+ *
+ * Each field of the generators is stored in its own array, indexed by the row of the generator, so that algorithms and writers
+ * loop over the fields they need without copying the generators. The reactive curve points are not stored in the table: each
+ * generator references its curve in the shared curve store.
+ *
+ * Rows are never removed: disconnected generators are only removed from their node.
+ */
+class GeneratorTable {
+ public:
+  using Index = std::uint32_t;                                        ///< alias for the row of a generator
+  using GeneratorId = common::Symbol;                                 ///< alias for generator id
+  using BusId = common::Symbol;                                       ///< alias for bus id
+  using CurveId = ReactiveCurveStore::CurveId;                        ///< alias for curve id
+  using ReactiveCurvePoint = ReactiveCurveStore::ReactiveCurvePoint;  ///< alias for point type
+  using Points = ReactiveCurveStore::Points;                          ///< alias for the points of a curve
+
+  /**
+   * @brief Constructor
+   *
+   * @param curves the store of the reactive capability curves referenced by the generators
+   */
+  explicit GeneratorTable(const ReactiveCurveStore& curves) : curves_(curves) {}
+
+  /**
+   * @brief Add a generator
+   *
+   * @param id the id of the generator
+   * @param curve the reactive capabilities curve of the generator in the curve store
+   * @param qmin minimum reactive power for the generator
+   * @param qmax maximum reactive power for the generator
+   * @param pmin minimum active power for the generator
+   * @param pmax maximum active power for the generator
+   * @param targetP target active power of the generator
+   * @param regulatedBusId the Bus Id this generator is regulating
+   * @param connectedBusId the Bus Id this generator is connected to
+   * @returns the row of the generator
+   */
+  Index add(const GeneratorId& id, CurveId curve, double qmin, double qmax, double pmin, double pmax, double targetP, const BusId& regulatedBusId,
+            const BusId& connectedBusId);
+
+  /**
+   * @brief Retrieve the number of generators
+   * @returns number of generators
+   */
+  std::size_t size() const {
+    return ids_.size();
+  }
+
+  /// @brief Remove all the generators
+  void clear();
+
+  /**
+   * @brief Estimate the memory retained by the table
+   *
+   * @returns number of bytes of the columns, the curves being owned by the curve store
+   */
+  std::size_t memoryBytes() const;
+
+  /**
+   * @brief Retrieve the reactive curve points of a generator
+   * @param row the row of the generator
+   * @returns the points of the generator, sorted by active power
+   */
+  Points points(Index row) const {
+    return curves_.points(curveIds_[row]);
+  }
+
+  /**
+   * @brief Retrieve the store of the curves referenced by the generators
+   * @returns the curve store
+   */
+  const ReactiveCurveStore& curves() const {
+    return curves_;
+  }
+
+  /**
+   * @brief Retrieve the ids of the generators, by row
+   * @returns the column of the ids
+   */
+  const std::vector<GeneratorId>& ids() const {
+    return ids_;
+  }
+
+  /**
+   * @brief Retrieve the reactive capability curves of the generators, by row
+   * @returns the column of the curve ids
+   */
+  const std::vector<CurveId>& curveIds() const {
+    return curveIds_;
+  }
+
+  /**
+   * @brief Retrieve the minimum reactive powers of the generators, by row
+   * @returns the column of the minimum reactive powers
+   */
+  const std::vector<double>& qmin() const {
+    return qmin_;
+  }
+
+  /**
+   * @brief Retrieve the maximum reactive powers of the generators, by row
+   * @returns the column of the maximum reactive powers
+   */
+  const std::vector<double>& qmax() const {
+    return qmax_;
+  }
+
+  /**
+   * @brief Retrieve the minimum active powers of the generators, by row
+   * @returns the column of the minimum active powers
+   */
+  const std::vector<double>& pmin() const {
+    return pmin_;
+  }
+
+  /**
+   * @brief Retrieve the maximum active powers of the generators, by row
+   * @returns the column of the maximum active powers
+   */
+  const std::vector<double>& pmax() const {
+    return pmax_;
+  }
+
+  /**
+   * @brief Retrieve the target active powers of the generators, by row
+   * @returns the column of the target active powers
+   */
+  const std::vector<double>& targetP() const {
+    return targetP_;
+  }
+
+  /**
+   * @brief Retrieve the buses regulated by the generators, by row
+   * @returns the column of the regulated bus ids
+   */
+  const std::vector<BusId>& regulatedBusIds() const {
+    return regulatedBusIds_;
+  }
+
+  /**
+   * @brief Retrieve the buses the generators are connected to, by row
+   * @returns the column of the connected bus ids
+   */
+  const std::vector<BusId>& connectedBusIds() const {
+    return connectedBusIds_;
+  }
+
+ private:
+  const ReactiveCurveStore& curves_;    ///< store of the reactive capability curves
+  std::vector<GeneratorId> ids_;        ///< generator ids
+  std::vector<CurveId> curveIds_;       ///< reactive capability curves
+  std::vector<double> qmin_;            ///< minimum reactive powers
+  std::vector<double> qmax_;            ///< maximum reactive powers
+  std::vector<double> pmin_;            ///< minimum active powers
+  std::vector<double> pmax_;            ///< maximum active powers
+  std::vector<double> targetP_;         ///< target active powers
+  std::vector<BusId> regulatedBusIds_;  ///< regulated bus ids
+  std::vector<BusId> connectedBusIds_;  ///< connected bus ids
+};
+
+}  // namespace inputs
+}  // namespace dfl
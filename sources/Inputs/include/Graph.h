@@ -0,0 +1,322 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Graph.h
+ *
+ * @brief Topological graph header file
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+class Node;
+
+/**
+ * @brief Topological graph of the network
+ *
+ * Adjacency between nodes stored in compressed sparse row (CSR) format: the neighbours of all nodes are stored
+ * contiguously and the neighbours of a node are a slice of this storage. Nodes are identified by a dense index
+ * and edges are typed according to the network element realizing the connection.
+ *
+ * The graph is built once, through its builder, when all topological elements are known. Edges can then be opened and closed,
+ * to follow the state of the switches and branches: open edges stay in the adjacency but do not count in the degree of the nodes
+ * and do not connect the islands.
+ */
+class Graph {
+ public:
+  using NodeIndex = std::uint32_t;  ///< Dense index of a node
+  using EdgeIndex = std::uint32_t;  ///< Dense index of an edge
+
+  /// @brief Type of network element realizing an edge
+  enum class EdgeType : std::uint8_t {
+    SWITCH = 0,  ///< Switch inside a voltage level
+    LINE,        ///< Line
+    TFO          ///< Transformer, three windings transformers being represented by three pairwise edges
+  };
+
+  /**
+   * @brief Contiguous range of elements of the graph storage
+   */
+  template<class T>
+  class Range {
+   public:
+    /**
+     * @brief Constructor
+     *
+     * @param begin pointer to the first element
+     * @param end pointer past the last element
+     */
+    Range(const T* begin, const T* end) : begin_(begin), end_(end) {}
+
+    /**
+     * @brief Retrieve the beginning of the range
+     * @returns pointer to the first element
+     */
+    const T* begin() const {
+      return begin_;
+    }
+
+    /**
+     * @brief Retrieve the end of the range
+     * @returns pointer past the last element
+     */
+    const T* end() const {
+      return end_;
+    }
+
+    /**
+     * @brief Retrieve the number of elements of the range
+     * @returns number of elements
+     */
+    std::size_t size() const {
+      return static_cast<std::size_t>(end_ - begin_);
+    }
+
+    /**
+     * @brief Access an element of the range
+     * @param i the position in the range
+     * @returns the element
+     */
+    const T& operator[](std::size_t i) const {
+      return begin_[i];
+    }
+
+   private:
+    const T* begin_;  ///< first element
+    const T* end_;    ///< past the last element
+  };
+
+  /**
+   * @brief Graph builder
+   *
+   * Accumulates nodes and edges before freezing them into the CSR storage
+   */
+  class Builder {
+   public:
+    /// @brief Default constructor: no node nor edge
+    Builder() = default;
+
+    /**
+     * @brief Constructor from a built graph
+     *
+     * The nodes and the edges of the graph are added with their indexes and their states
+     *
+     * @param graph the graph
+     */
+    explicit Builder(const Graph& graph);
+
+    /**
+     * @brief Add a node to the graph
+     *
+     * The index of the node is updated with its position in the graph
+     *
+     * @param node the node to add
+     * @returns the index of the node
+     */
+    NodeIndex addNode(const std::shared_ptr<Node>& node);
+
+    /**
+     * @brief Add an edge between two nodes already added
+     *
+     * @param node1 index of the first node
+     * @param node2 index of the second node
+     * @param type type of the element realizing the edge
+     * @param isOpen whether the element realizing the edge is open
+     * @returns the index of the edge
+     */
+    EdgeIndex addEdge(NodeIndex node1, NodeIndex node2, EdgeType type, bool isOpen = false);
+
+    /**
+     * @brief Add a fictitious node to the graph
+     *
+     * A fictitious node only takes part in the topological computations: it has no node data, the built graph giving a null node
+     * for it, so that the nodes cannot be renumbered
+     *
+     * @returns the index of the node
+     */
+    NodeIndex addFictitiousNode();
+
+    /**
+     * @brief Renumber the nodes in a locality-aware order
+     *
+     * The nodes of a voltage level are given consecutive indexes, sorted by id. The voltage levels are ordered breadth-first
+     * with the Cuthill-McKee rule over the edges between them, each component starting from its voltage level of lowest degree,
+     * the neighbours being visited by increasing degree. Ties are broken by id, so that the order does not depend on the order
+     * in which the nodes and edges were added.
+     *
+     * The indexes of the nodes and the extremities of the edges already added are updated, the edges keeping their indexes.
+     *
+     * @returns the new index of each node, by previous index
+     */
+    std::vector<NodeIndex> renumber();
+
+    /**
+     * @brief Build the graph
+     *
+     * Adjacency of each node keeps the order in which the edges were added. The builder is left empty.
+     *
+     * @returns the built graph
+     */
+    Graph build();
+
+   private:
+    std::vector<std::shared_ptr<Node>> nodes_;  ///< nodes by index
+    std::vector<NodeIndex> edgesNode1_;         ///< first extremity of the edges
+    std::vector<NodeIndex> edgesNode2_;         ///< second extremity of the edges
+    std::vector<EdgeType> edgesType_;           ///< type of the edges
+    std::vector<std::uint8_t> edgesOpen_;       ///< whether the edges are open
+  };
+
+ public:
+  /// @brief Default constructor: empty graph
+  Graph() = default;
+
+  /**
+   * @brief Retrieve the number of nodes
+   * @returns number of nodes
+   */
+  std::size_t nbNodes() const {
+    return nodes_.size();
+  }
+
+  /**
+   * @brief Retrieve the number of edges
+   * @returns number of edges
+   */
+  std::size_t nbEdges() const {
+    return edgesType_.size();
+  }
+
+  /**
+   * @brief Retrieve a node by its index
+   * @param index the node index
+   * @returns the node
+   */
+  const std::shared_ptr<Node>& node(NodeIndex index) const {
+    return nodes_[index];
+  }
+
+  /**
+   * @brief Retrieve all nodes, by index
+   * @returns the nodes
+   */
+  const std::vector<std::shared_ptr<Node>>& nodes() const {
+    return nodes_;
+  }
+
+  /**
+   * @brief Retrieve the number of closed edges incident to a node
+   * @param index the node index
+   * @returns the degree of the node
+   */
+  std::size_t degree(NodeIndex index) const {
+    return degrees_[index];
+  }
+
+  /**
+   * @brief Retrieve the neighbours of a node
+   *
+   * A neighbour appears once for each edge connecting it to the node, open edges included
+   *
+   * @param index the node index
+   * @returns the range of neighbour indexes
+   */
+  Range<NodeIndex> neighbours(NodeIndex index) const {
+    return Range<NodeIndex>(adjacentNodes_.data() + offsets_[index], adjacentNodes_.data() + offsets_[index + 1]);
+  }
+
+  /**
+   * @brief Retrieve the edges incident to a node
+   *
+   * Edges are given in the same order as the neighbours
+   *
+   * @param index the node index
+   * @returns the range of edge indexes
+   */
+  Range<EdgeIndex> incidentEdges(NodeIndex index) const {
+    return Range<EdgeIndex>(adjacentEdges_.data() + offsets_[index], adjacentEdges_.data() + offsets_[index + 1]);
+  }
+
+  /**
+   * @brief Retrieve the type of an edge
+   * @param edge the edge index
+   * @returns the type of the edge
+   */
+  EdgeType edgeType(EdgeIndex edge) const {
+    return edgesType_[edge];
+  }
+
+  /**
+   * @brief Retrieve the first extremity of an edge
+   * @param edge the edge index
+   * @returns the index of the first node
+   */
+  NodeIndex edgeNode1(EdgeIndex edge) const {
+    return edgesNode1_[edge];
+  }
+
+  /**
+   * @brief Retrieve the second extremity of an edge
+   * @param edge the edge index
+   * @returns the index of the second node
+   */
+  NodeIndex edgeNode2(EdgeIndex edge) const {
+    return edgesNode2_[edge];
+  }
+
+  /**
+   * @brief Determines if an edge is open
+   * @param edge the edge index
+   * @returns @b true if the element realizing the edge is open, @b false if it connects its nodes
+   */
+  bool isEdgeOpen(EdgeIndex edge) const {
+    return edgesOpen_[edge] != 0;
+  }
+
+  /**
+   * @brief Open or close an edge
+   *
+   * The islands of the graph must be updated afterwards
+   *
+   * @param edge the edge index
+   * @param isOpen whether the edge is open
+   * @returns @b true if the state of the edge changed, @b false if it already had this state
+   */
+  bool setEdgeOpen(EdgeIndex edge, bool isOpen);
+
+  /**
+   * @brief Estimate the memory retained by the graph
+   *
+   * @returns number of bytes of the adjacency and of the edges, the nodes being owned by the network
+   */
+  std::size_t memoryBytes() const;
+
+ private:
+  std::vector<std::shared_ptr<Node>> nodes_;  ///< nodes by index
+  std::vector<EdgeIndex> offsets_;            ///< position of the adjacency of each node, of size nbNodes + 1
+  std::vector<std::size_t> degrees_;          ///< number of closed edges incident to each node
+  std::vector<NodeIndex> adjacentNodes_;      ///< neighbours of all nodes, contiguous by node
+  std::vector<EdgeIndex> adjacentEdges_;      ///< incident edges of all nodes, parallel to the neighbours
+  std::vector<NodeIndex> edgesNode1_;         ///< first extremity of the edges
+  std::vector<NodeIndex> edgesNode2_;         ///< second extremity of the edges
+  std::vector<EdgeType> edgesType_;           ///< type of the edges
+  std::vector<std::uint8_t> edgesOpen_;       ///< whether the edges are open
+};
+
+}  // namespace inputs
+}  // namespace dfl
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include "Arena.h"
 #include "Behaviours.h"
+#include "Symbol.h"
 
 #include <boost/optional.hpp>
 #include <string>
@@ -30,15 +32,11 @@ namespace inputs {
  */
 class HvdcLine {
  public:
-  using HvdcLineId = std::string;   ///< HvdcLine id definition
-  using ConverterId = std::string;  ///< alias for converter id
-  using BusId = std::string;        ///< alias for bus id
+  using HvdcLineId = common::Symbol;   ///< HvdcLine id definition
+  using ConverterId = common::Symbol;  ///< alias for converter id
+  using BusId = common::Symbol;        ///< alias for bus id
 
-  /// @brief Type of converter
-  enum class ConverterType {
-    VSC,  ///< voltage source converter
-    LCC   ///< line-commutated converter
-  };
+  using ConverterType = Converter::Type;  ///< alias for type of converter
 
   /**
    * @brief HVDC Active power control information
@@ -60,7 +58,8 @@ class HvdcLine {
   /**
    * @brief Build a HVDC line object
    *
-   * the builder builds the HVDC line object and performs the connections to converters
+   * the builder builds the HVDC line object and performs the connections to converters. The converters are not owned by the line:
+   * they must outlive it, usually by being stored in the converter pool of the network.
    *
    * @param id the hvdc line id
    * @param converterType type of converter of the hvdc line
@@ -68,16 +67,17 @@ class HvdcLine {
    * @param converter2 the second converter
    * @param activePowerControl the active power control information, when present in the network
    * @param pMax the maximum p
+   * @param arena the arena to allocate the line from, or a null pointer to allocate it on the heap
    */
-  static std::shared_ptr<HvdcLine> build(const std::string& id, const ConverterType converterType, const std::shared_ptr<Converter>& converter1,
-                                         const std::shared_ptr<Converter>& converter2, const boost::optional<ActivePowerControl>& activePowerControl,
-                                         double pMax);
+  static std::shared_ptr<HvdcLine> build(const HvdcLineId& id, const ConverterType converterType, Converter* converter1, Converter* converter2,
+                                         const boost::optional<ActivePowerControl>& activePowerControl, double pMax,
+                                         const std::shared_ptr<common::Arena>& arena = nullptr);
 
  public:
   const HvdcLineId id;                                           ///< HvdcLine id
   const ConverterType converterType;                             ///< type of converter
-  const std::shared_ptr<Converter> converter1;                   ///< first converter
-  const std::shared_ptr<Converter> converter2;                   ///< second converter
+  const Converter* const converter1;                             ///< first converter, not owning
+  const Converter* const converter2;                             ///< second converter, not owning
   const boost::optional<ActivePowerControl> activePowerControl;  ///< active power control information
   const double pMax;                                             ///< maximum p
 
@@ -92,7 +92,7 @@ class HvdcLine {
    * @param activePowerControl the active power control information, when present in the network
    * @param pMax the maximum p
    */
-  HvdcLine(const std::string& id, const ConverterType converterType, const std::shared_ptr<Converter>& converter1, const std::shared_ptr<Converter>& converter2,
+  HvdcLine(const HvdcLineId& id, const ConverterType converterType, const Converter* converter1, const Converter* converter2,
            const boost::optional<ActivePowerControl>& activePowerControl, double pMax);
 };
 }  // namespace inputs
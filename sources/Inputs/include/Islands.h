@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Islands.h
+ *
+ * @brief Topological islands header file
+ *
+ */
+
+#pragma once
+
+#include "Graph.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Topological islands of the network
+ *
+ * Labelling of the nodes of the graph by connex component (island), through the closed edges. Islands are numbered in the order of their
+ * first node index when computed. They can then be updated when an edge is opened or closed, without computing them again: ids of the
+ * islands untouched by the update are kept, and the ids of merged islands are reused for split islands.
+ */
+class Islands {
+ public:
+  using IslandId = std::uint32_t;  ///< Island id
+
+  /**
+   * @brief Compute the islands of a graph
+   *
+   * Non-recursive union-find over all edges of the graph followed by a single labelling sweep.
+   * With one thread, union by size and path halving are used. With several threads, the edges are shared between the threads
+   * which perform a lock-free union-find: roots are linked by index with compare-and-swap and paths are halved concurrently.
+   * The resulting islands do not depend on the number of threads.
+   *
+   * @param graph the topological graph
+   * @param nbThreads the number of threads to use
+   * @returns the islands of the graph
+   */
+  static Islands compute(const Graph& graph, unsigned int nbThreads = 1);
+
+  /// @brief Default constructor: no island
+  Islands() = default;
+
+  /**
+   * @brief Update the islands after an edge of the graph was opened or closed
+   *
+   * Closing an edge between two islands relabels the smallest one. Opening an edge explores the graph from both extremities
+   * at the same pace, so that only the part which is split from the island is visited, unless the extremities are still connected.
+   * The resulting islands and main island are the same as the ones computed from scratch, up to the numbering of the islands.
+   *
+   * @param graph the topological graph, whose edge state was just changed
+   * @param edge the edge which was opened or closed
+   */
+  void update(const Graph& graph, Graph::EdgeIndex edge);
+
+  /**
+   * @brief Retrieve the island of a node
+   * @param index the node index
+   * @returns the island containing the node
+   */
+  IslandId islandOf(Graph::NodeIndex index) const {
+    return labels_[index];
+  }
+
+  /**
+   * @brief Retrieve the number of islands
+   * @returns number of islands
+   */
+  std::size_t nbIslands() const {
+    return sizes_.size() - freeIslands_.size();
+  }
+
+  /**
+   * @brief Retrieve the number of nodes of an island
+   * @param island the island
+   * @returns number of nodes in the island
+   */
+  std::size_t size(IslandId island) const {
+    return sizes_[island];
+  }
+
+  /**
+   * @brief Retrieve the island of each node
+   * @returns island ids, by node index
+   */
+  const std::vector<IslandId>& labels() const {
+    return labels_;
+  }
+
+  /**
+   * @brief Retrieve the size of each island
+   * @returns number of nodes, by island id, zero for the ids left unused by the updates
+   */
+  const std::vector<std::size_t>& sizes() const {
+    return sizes_;
+  }
+
+  /**
+   * @brief Retrieve the main island
+   *
+   * The main island is the one with the most nodes. In case of equality, the island containing the node with the
+   * lowest id is chosen, which is the first island met when walking through the nodes by id.
+   *
+   * @returns the main island
+   */
+  IslandId mainIsland() const {
+    return mainIsland_;
+  }
+
+  /**
+   * @brief Determines if a node belongs to the main island
+   * @param index the node index
+   * @returns @b true if the node is in the main island, @b false if not
+   */
+  bool isInMainIsland(Graph::NodeIndex index) const {
+    return labels_[index] == mainIsland_;
+  }
+
+  /**
+   * @brief Estimate the memory retained by the islands
+   *
+   * @returns number of bytes of the labels and of the update buffers
+   */
+  std::size_t memoryBytes() const;
+
+ private:
+  /**
+   * @brief Label the islands
+   *
+   * @param graph the topological graph
+   * @param roots the union-find root of each node, by node index
+   * @returns the labelled islands
+   */
+  static Islands label(const Graph& graph, const std::vector<Graph::NodeIndex>& roots);
+
+  /**
+   * @brief Choose the main island among the islands
+   *
+   * @param graph the topological graph
+   */
+  void updateMainIsland(const Graph& graph);
+
+  /**
+   * @brief Merge the islands of the extremities of a closed edge
+   *
+   * @param graph the topological graph
+   * @param node1 the first extremity
+   * @param node2 the second extremity
+   */
+  void merge(const Graph& graph, Graph::NodeIndex node1, Graph::NodeIndex node2);
+
+  /**
+   * @brief Split the island of the extremities of an open edge, if they are no longer connected
+   *
+   * @param graph the topological graph
+   * @param node1 the first extremity
+   * @param node2 the second extremity
+   */
+  void split(const Graph& graph, Graph::NodeIndex node1, Graph::NodeIndex node2);
+
+ private:
+  std::vector<IslandId> labels_;                 ///< island of each node, by node index
+  std::vector<std::size_t> sizes_;               ///< number of nodes of each island, by island id
+  std::vector<Graph::NodeIndex> lowestIdNodes_;  ///< node with the lowest id of each island, by island id
+  std::vector<IslandId> freeIslands_;            ///< island ids left unused by the updates
+  IslandId mainIsland_ = 0;                      ///< main island
+  std::vector<std::uint32_t> visits_;            ///< visit stamp of each node during the updates, by node index
+  std::uint32_t visitStamp_ = 0;                 ///< last visit stamp used
+};
+
+}  // namespace inputs
+}  // namespace dfl
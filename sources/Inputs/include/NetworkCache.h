@@ -0,0 +1,189 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NetworkCache.h
+ *
+ * @brief Binary cache of the network tree header file
+ *
+ */
+
+#pragma once
+
+#include "Symbol.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Binary cache of the network tree
+ *
+ * A cache file is made of a header, a table of the strings of the tree and a body of fixed-size values referring to the strings
+ * by their position in the table. Values are stored in the native representation of the machine, so that the file can be read in place
+ * once memory mapped. Cache files are identified by a key computed from the content of the network file.
+ */
+class NetworkCache {
+ public:
+  using Key = std::uint64_t;  ///< Alias for the key of a cache file
+
+  static constexpr std::uint32_t version = 7;  ///< Version of the format, to update each time the layout of the tree changes
+
+  /**
+   * @brief Compute the key of a network file
+   *
+   * The key is a 64 bits FNV-1a hash of the content of the file
+   *
+   * @param networkFilepath the network file
+   * @returns the key of the file
+   */
+  static Key computeKey(const boost::filesystem::path& networkFilepath);
+
+  /**
+   * @brief Retrieve the path of the cache file of a key
+   *
+   * @param cacheDir the directory of the cache files
+   * @param key the key of the network file
+   * @returns the path of the cache file
+   */
+  static boost::filesystem::path cacheFilepath(const boost::filesystem::path& cacheDir, Key key);
+
+  /**
+   * @brief Writer of a cache file
+   */
+  class Writer {
+   public:
+    /**
+     * @brief Write a value of a trivially copyable type
+     *
+     * @param value the value to write
+     */
+    template<class T>
+    void write(const T& value) {
+      static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written");
+      const auto position = body_.size();
+      body_.resize(position + sizeof(T));
+      std::memcpy(&body_[position], &value, sizeof(T));
+    }
+
+    /**
+     * @brief Write a string, as its position in the string table
+     *
+     * @param str the string to write
+     */
+    void writeString(const std::string& str);
+
+    /**
+     * @brief Write a symbol, as the position of its string in the string table
+     *
+     * @param symbol the symbol to write
+     */
+    void writeSymbol(const common::Symbol& symbol) {
+      writeString(symbol.str());
+    }
+
+    /**
+     * @brief Save the cache file
+     *
+     * The file is written next to its final path then renamed, so that concurrent readers never see a partial file
+     *
+     * @param filepath the path of the cache file
+     * @param key the key of the network file
+     */
+    void save(const boost::filesystem::path& filepath, Key key) const;
+
+   private:
+    std::vector<char> body_;                                    ///< values written
+    std::vector<std::string> strings_;                          ///< string table
+    std::unordered_map<std::string, std::uint32_t> positions_;  ///< positions of the strings in the string table
+  };
+
+  /**
+   * @brief Reader of a cache file
+   *
+   * The cache file is memory mapped and the values are read in place. Reading past the end of the file throws a std::runtime_error.
+   */
+  class Reader {
+   public:
+    /**
+     * @brief Constructor
+     *
+     * @param filepath the path of the cache file
+     * @param key the expected key of the network file
+     */
+    Reader(const boost::filesystem::path& filepath, Key key);
+
+    /**
+     * @brief Determines if the cache file exists and matches the key and the version of the format
+     *
+     * @returns @b true if the cache file can be read, @b false if not
+     */
+    bool isValid() const {
+      return current_ != nullptr;
+    }
+
+    /**
+     * @brief Read a value of a trivially copyable type
+     *
+     * @returns the value read
+     */
+    template<class T>
+    T read() {
+      static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read");
+      T value;
+      std::memcpy(&value, advance(sizeof(T)), sizeof(T));
+      return value;
+    }
+
+    /**
+     * @brief Read a symbol written as a string or a symbol
+     *
+     * @returns the symbol read
+     */
+    const common::Symbol& readSymbol();
+
+    /**
+     * @brief Determines if all the values of the cache file were read
+     *
+     * @returns @b true if the end of the file is reached, @b false if not
+     */
+    bool isAtEnd() const {
+      return current_ == end_;
+    }
+
+   private:
+    /**
+     * @brief Move forward in the mapped file
+     *
+     * @param size the number of bytes to move forward
+     * @returns the position before moving
+     */
+    const char* advance(std::size_t size);
+
+   private:
+    boost::interprocess::mapped_region region_;  ///< memory mapping of the cache file
+    const char* current_;                        ///< position of the next value to read, or null pointer if the file is invalid
+    const char* end_;                            ///< end of the mapped file
+    std::vector<common::Symbol> symbols_;        ///< string table, interned
+  };
+};
+
+}  // namespace inputs
+}  // namespace dfl
@@ -0,0 +1,152 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NetworkColumns.h
+ *
+ * @brief Columnar extract of the network data interface header file
+ *
+ */
+
+#pragma once
+
+#include "Symbol.h"
+
+#include <DYNGeneratorInterface.h>
+#include <DYNNetworkInterface.h>
+#include <DYNStaticVarCompensatorInterface.h>
+#include <boost/shared_ptr.hpp>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Columnar extract of the elements of a network data interface
+ *
+ * Each element category is walked once through the data interface, and the fields the node tree is built from are stored in columns,
+ * sized beforehand from the element counts of the voltage levels, each voltage level filling its own ranges of the columns.
+ * The extraction is sequential: the data interface is not known to be safe to call from several threads at once.
+ *
+ * Elements refer to their buses by position in the bus columns. The bus interfaces are resolved by address rather than by id,
+ * so that a reference costs neither a string copy nor the interning of a symbol.
+ *
+ * Only the connection flags are read for the elements that are not connected: their ids and buses are not read, their ids
+ * staying empty and their buses set to noBus. The detail of the generators and of the static var compensators, only needed
+ * in the main island, is not part of the columns: their interfaces are kept so that it can be read afterwards.
+ */
+struct NetworkColumns {
+  using BusIndex = std::uint32_t;                                          ///< alias for the position of a bus in the bus columns
+  static constexpr BusIndex noBus = std::numeric_limits<BusIndex>::max();  ///< bus of the elements that are not connected
+
+  /// @brief Columns of the voltage levels, in network order
+  struct VoltageLevels {
+    std::vector<common::Symbol> ids;          ///< voltage level ids
+    std::vector<double> nominalVoltages;      ///< nominal voltages
+    std::vector<std::uint8_t> isNodeBreaker;  ///< whether the voltage levels are described in node-breaker topology
+  };
+
+  /// @brief Columns of the buses, grouped by voltage level
+  struct Buses {
+    std::vector<std::uint32_t> offsets;  ///< position of the first bus of each voltage level, followed by the number of buses
+    std::vector<common::Symbol> ids;     ///< bus ids
+  };
+
+  /// @brief Columns of the loads, grouped by voltage level
+  struct Loads {
+    std::vector<std::uint32_t> offsets;   ///< position of the first load of each voltage level, followed by the number of loads
+    std::vector<std::uint8_t> connected;  ///< whether the loads are connected
+    std::vector<common::Symbol> ids;      ///< load ids
+    std::vector<BusIndex> buses;          ///< buses of the loads
+    std::vector<double> activePowers;     ///< active powers of the loads
+  };
+
+  /// @brief Columns of the shunts, grouped by voltage level, connected or not as dynamic models may aim to connect them
+  struct Shunts {
+    std::vector<std::uint32_t> offsets;  ///< position of the first shunt of each voltage level, followed by the number of shunts
+    std::vector<common::Symbol> ids;     ///< shunt ids
+    std::vector<BusIndex> buses;         ///< buses of the shunts, noBus if their bus is unknown
+  };
+
+  /// @brief Columns of the switches, grouped by voltage level
+  struct Switches {
+    std::vector<std::uint32_t> offsets;  ///< position of the first switch of each voltage level, followed by the number of switches
+    std::vector<common::Symbol> ids;     ///< switch ids
+    std::vector<BusIndex> buses1;        ///< first buses of the switches
+    std::vector<BusIndex> buses2;        ///< second buses of the switches
+    std::vector<std::uint8_t> open;      ///< whether the switches are open
+  };
+
+  /**
+   * @brief Columns of the injections whose detail is read afterwards, grouped by voltage level
+   *
+   * @tparam Interface the interface type of the injection in the data interface
+   */
+  template<class Interface>
+  struct Injections {
+    std::vector<std::uint32_t> offsets;                    ///< position of the first injection of each voltage level, followed by the number of injections
+    std::vector<std::uint8_t> connected;                   ///< whether the injections are connected
+    std::vector<BusIndex> buses;                           ///< buses of the injections
+    std::vector<boost::shared_ptr<Interface>> interfaces;  ///< injections in the data interface, to read their detail
+  };
+
+  /// @brief Columns of the lines or of the two windings transformers, in network order
+  struct Branches {
+    std::vector<std::uint8_t> connected;  ///< whether the branches are connected at both sides
+    std::vector<common::Symbol> ids;      ///< branch ids
+    std::vector<BusIndex> buses1;         ///< first buses of the branches
+    std::vector<BusIndex> buses2;         ///< second buses of the branches
+    std::vector<std::string> seasons;     ///< active seasons of the lines, not filled for the transformers
+  };
+
+  /// @brief Columns of the three windings transformers, in network order
+  struct ThreeWindingsTransformers {
+    std::vector<std::uint8_t> connected;  ///< whether the transformers are connected at the three sides
+    std::vector<common::Symbol> ids;      ///< transformer ids
+    std::vector<BusIndex> buses1;         ///< first buses of the transformers
+    std::vector<BusIndex> buses2;         ///< second buses of the transformers
+    std::vector<BusIndex> buses3;         ///< third buses of the transformers
+  };
+
+  /**
+   * @brief Extract the columns of a network
+   *
+   * @param network the network in the data interface
+   * @returns the columns of the network
+   * @throws std::out_of_range if an element is connected to a bus that does not exist, or to a bus of another voltage level
+   * for the elements of the voltage levels
+   */
+  static NetworkColumns extract(const DYN::NetworkInterface& network);
+
+  /**
+   * @brief Retrieve the number of voltage levels
+   * @returns number of voltage levels
+   */
+  std::size_t nbVoltageLevels() const {
+    return voltageLevels.ids.size();
+  }
+
+  VoltageLevels voltageLevels;                            ///< voltage levels
+  Buses buses;                                            ///< buses
+  Loads loads;                                            ///< loads
+  Shunts shunts;                                          ///< shunt compensators
+  Switches switches;                                      ///< switches
+  Injections<DYN::GeneratorInterface> generators;         ///< generators
+  Injections<DYN::StaticVarCompensatorInterface> svarcs;  ///< static var compensators
+  Branches lines;                                         ///< lines
+  Branches twoWTransformers;                              ///< two windings transformers
+  ThreeWindingsTransformers threeWTransformers;           ///< three windings transformers
+};
+
+}  // namespace inputs
+}  // namespace dfl
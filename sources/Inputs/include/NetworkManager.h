@@ -17,16 +17,31 @@
 
 #pragma once
 
+#include "Arena.h"
+#include "Bridges.h"
+#include "GeneratorTable.h"
+#include "Graph.h"
 #include "HvdcLine.h"
+#include "Islands.h"
+#include "MemoryFootprint.h"
+#include "NetworkCache.h"
+#include "NetworkColumns.h"
 #include "Node.h"
+#include "ReactiveCurveStore.h"
+#include "SymbolIndex.h"
 
 #include <DYNDataInterface.h>
+#include <DYNGeneratorInterface.h>
+#include <DYNHvdcLineInterface.h>
+#include <DYNServiceManagerInterface.h>
+#include <DYNStaticVarCompensatorInterface.h>
 #include <boost/filesystem.hpp>
 #include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
-#include <map>
+#include <deque>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 namespace dfl {
 namespace inputs {
 
@@ -34,6 +49,17 @@ namespace inputs {
  * @brief Network manager, handling the network input file
  *
  * Relies on DYNAWO data interface
+ *
+ * The topology of the whole network is read from the data interface in a single pass into columns (see NetworkColumns),
+ * the node tree being built from the columns.
+ *
+ * The node tree is built in two phases: the topology of the whole network is extracted first, then the detail of the generators,
+ * static var compensators and hvdc lines is extracted only for the main island, as the definitions are only produced for it.
+ * The equipment of the other islands stays pending and is extracted when its island becomes the main island after a topology update.
+ *
+ * Node-breaker voltage levels are extracted in their bus view: the buses of the data interface connected by closed switches, retained
+ * or not, and by internal connections are merged into a single node, named after the first of them. Only the open switches are kept
+ * as switches of the graph, so that they can be closed afterwards.
  */
 class NetworkManager {
  public:
@@ -45,33 +71,65 @@ class NetworkManager {
     MULTIPLES  ///< There are more than one element regulating the bus
   };
 
-  using ProcessNodeCallback = std::function<void(const std::shared_ptr<Node>&)>;  ///< Callback for node algorithm
-  using BusId = std::string;                                                      ///< alias of BusId
-  using BusMapRegulating = std::unordered_map<BusId, NbOfRegulating>;             ///< alias for the bus map
+  using BusId = common::Symbol;                                        ///< alias of BusId
+  using BusMapRegulating = std::unordered_map<BusId, NbOfRegulating>;  ///< alias for the bus map
+
+  /// @brief Part of the main island detached by the outage of a branch
+  struct DetachedPart {
+    common::Symbol branchId;     ///< id of the line or transformer
+    Graph::EdgeType branchType;  ///< type of the branch
+    std::size_t nbNodes;         ///< number of nodes of the detached part
+    double generation;           ///< target active power of the voltage regulating generators of the detached part
+    double load;                 ///< active power of the loads of the detached part
+  };
 
  public:
   /**
   * @brief Constructor
   *
+  * If a cache directory is given, the node tree is loaded from the cache file of the network file if it exists, without parsing the network file.
+  * Otherwise the node tree is built from the network file and saved in the cache directory.
+  *
   * @param filepath network file path
+  * @param nbThreads number of threads to use for the extraction of the voltage levels and the topological computations
+  * @param cacheDir directory of the network cache files, or empty path to disable the cache
   */
-  explicit NetworkManager(const boost::filesystem::path& filepath);
+  explicit NetworkManager(const boost::filesystem::path& filepath, unsigned int nbThreads = 1, const boost::filesystem::path& cacheDir = {});
 
   /**
-   * @brief Register a callback to call at each node
+   * @brief Walk through nodes
+   *
+   * This will call the node algorithm on each node, usually a pipeline of several algorithms (see algo::NodePipeline).
+   * The nodes are walked in the order of their storage, which keeps neighbouring nodes close in memory (see Graph::Builder::renumber):
+   * the results of the algorithm must not depend on the walk order. Otherwise, use walkNodesById
    *
-   * @param callback callback
+   * the type NodeAlgorithm requires to be callable as algorithm(const std::shared_ptr<Node>&)
+   *
+   * @param algorithm the node algorithm to call
    */
-  void onNode(ProcessNodeCallback&& callback) {
-    nodesCallbacks_.push_back(std::forward<ProcessNodeCallback>(callback));
+  template<class NodeAlgorithm>
+  void walkNodes(NodeAlgorithm&& algorithm) const {
+    for (const auto& node : nodes_) {
+      algorithm(node);
+    }
   }
 
   /**
-   * @brief Walk through nodes
+   * @brief Walk through nodes in the order of their ids
    *
-   * This will call all registered callbacks for nodes
+   * Same as walkNodes, for the algorithms whose results depend on the walk order, so that the outputs written from them are reproducible
+   * whatever the order of the storage. This walk does not benefit from the locality of the storage.
+   *
+   * the type NodeAlgorithm requires to be callable as algorithm(const std::shared_ptr<Node>&)
+   *
+   * @param algorithm the node algorithm to call
    */
-  void walkNodes() const;
+  template<class NodeAlgorithm>
+  void walkNodesById(NodeAlgorithm&& algorithm) const {
+    for (auto index : sortedNodes_) {
+      algorithm(nodes_[index]);
+    }
+  }
 
   /**
    * @brief Retrieve the slack node if it is given in the network file
@@ -85,10 +143,47 @@ class NetworkManager {
   /**
    * @brief Retrieve data interface
    *
+   * The network file is parsed on first call if the node tree was loaded from the cache
+   *
    * @returns data interface
    */
-  boost::shared_ptr<DYN::DataInterface> dataInterface() const {
-    return interface_;
+  boost::shared_ptr<DYN::DataInterface> dataInterface() const;
+
+  /**
+   * @brief Retrieve a service manager answering from the node tree
+   *
+   * Buses connected by switches are given by the switches of the topological graph, so that the data interface is not needed.
+   * Regulated buses are requested to the service manager of the data interface.
+   *
+   * @returns service manager
+   */
+  boost::shared_ptr<DYN::ServiceManagerInterface> serviceManager() const;
+
+  /**
+   * @brief Determines if the node tree was loaded from the cache
+   *
+   * @returns @b true if the node tree was loaded from a cache file, @b false if it was built from the network file
+   */
+  bool isLoadedFromCache() const {
+    return loadedFromCache_;
+  }
+
+  /**
+   * @brief Retrieve the topological graph of the network
+   *
+   * @returns the graph of the nodes connected by closed switches, lines and transformers
+   */
+  const Graph& getGraph() const {
+    return graph_;
+  }
+
+  /**
+   * @brief Retrieve the topological islands of the network
+   *
+   * @returns the islands of the nodes of the graph
+   */
+  const Islands& getIslands() const {
+    return islands_;
   }
 
   /**
@@ -100,6 +195,37 @@ class NetworkManager {
     return hvdcLines_;
   }
 
+  /**
+   * @brief Retrieve the generators of the network
+   *
+   * The generators of a node are its rows in the table
+   *
+   * @returns the generator table
+   */
+  const GeneratorTable& getGenerators() const {
+    return generators_;
+  }
+
+  /**
+   * @brief Retrieve the buses of the data interface merged into another node
+   *
+   * Buses of node-breaker voltage levels connected by closed switches are merged into a single node
+   *
+   * @returns the ids of the merged buses, with the index of their node
+   */
+  const std::vector<std::pair<common::Symbol, Graph::NodeIndex>>& getNodeAliases() const {
+    return nodeAliases_;
+  }
+
+  /**
+   * @brief Retrieve the reactive capability curves of the generators and VSC converters
+   *
+   * @returns the curve store
+   */
+  const ReactiveCurveStore& getReactiveCurves() const {
+    return curves_;
+  }
+
   /**
    * @brief Retrieve the mapping of busId and the number of generators that regulate them
    *
@@ -117,32 +243,301 @@ class NetworkManager {
     return mapBusVSCConvertersBusId_;
   }
 
+  /**
+   * @brief Compute the branches whose outage detaches a part of the main island
+   *
+   * The bridges are computed once, in linear time, on a copy of the graph where the loop of the three edges of each three windings transformer
+   * is replaced by a star around a fictitious node. The outage of a line or two windings transformer which is a bridge of the main island
+   * splits it in two parts, the outage of a three windings transformer splits it in up to three parts, one for each winding side connected
+   * only through the transformer and one for the windings still connected together. The largest part remains the main island, on equality
+   * the part containing the node with the lowest id, as for the islands: the detached part gathers the other parts. Their generation and load
+   * are sums over ranges of the nodes in depth-first order.
+   *
+   * @returns the parts detached by the branches, sorted by branch id
+   */
+  std::vector<DetachedPart> computeDetachedParts() const;
+
+  /**
+   * @brief Open a switch of the network
+   *
+   * The graph and the islands are updated incrementally, without parsing the network file again
+   *
+   * @param switchId the id of the switch
+   * @returns @b true if the switch was closed, @b false if it was already open
+   * @throws std::out_of_range if the switch does not exist, or is a closed switch of a node-breaker voltage level, merged into a node
+   */
+  bool openSwitch(const common::Symbol& switchId) {
+    return setSwitchOpen(switchId, true);
+  }
+
+  /**
+   * @brief Close a switch of the network
+   *
+   * The graph and the islands are updated incrementally, without parsing the network file again.
+   * The pending equipment of the nodes joining the main island is extracted.
+   *
+   * @param switchId the id of the switch
+   * @returns @b true if the switch was open, @b false if it was already closed
+   * @throws std::out_of_range if the switch does not exist, or is a closed switch of a node-breaker voltage level, merged into a node
+   */
+  bool closeSwitch(const common::Symbol& switchId) {
+    return setSwitchOpen(switchId, false);
+  }
+
+  /**
+   * @brief Disconnect a line or a transformer of the network
+   *
+   * The edges of the branch are opened in the graph, the islands are updated incrementally and the branch is removed from its nodes.
+   * If another island becomes the main island, its pending equipment is extracted.
+   *
+   * @param branchId the id of the line or transformer
+   * @returns @b true if the branch was connected, @b false if it was already disconnected
+   * @throws std::out_of_range if the branch does not exist
+   */
+  bool disconnectBranch(const common::Symbol& branchId);
+
+  /**
+   * @brief Disconnect a load, a generator or a static var compensator of the network
+   *
+   * The injection is removed from its node and the regulated buses mapping is updated for generators.
+   * A pending generator or static var compensator, outside the main island, is removed from the pending equipment.
+   * A generator or static var compensator without a model in the node tree is only recorded as disconnected.
+   *
+   * @param injectionId the id of the injection
+   * @returns @b true if the injection was connected, @b false if it was already disconnected
+   * @throws std::out_of_range if the injection is not a connected injection of the network, or is missing from its node
+   */
+  bool disconnectInjection(const common::Symbol& injectionId);
+
+  /**
+   * @brief Extract the detail of the equipment of all the islands
+   *
+   * By default, only the generators, static var compensators and hvdc lines of the main island are extracted
+   */
+  void extractAllEquipment() {
+    extractEquipment(true);
+    countPendingRegulations(true);
+  }
+
+  /**
+   * @brief Retrieve the number of generators, static var compensators and hvdc lines whose detail is not extracted yet
+   *
+   * @returns the number of pending equipment, outside the main island
+   */
+  std::size_t nbPendingEquipment() const {
+    return pendingGenerators_.size() + pendingSvarcs_.size() + pendingHvdcLines_.size();
+  }
+
+  /**
+   * @brief Add the memory footprint of the node tree, by element category
+   *
+   * The structures are named "network.<category>". The data interface of the network file is not accounted for.
+   *
+   * @param footprint the footprint to complete
+   */
+  void addMemoryFootprint(common::MemoryFootprint& footprint) const;
+
  private:
+  /// @brief Topology elements extracted from one voltage level of the network, before being merged into the node tree
+  struct VoltageLevelExtract {
+    using Generator = std::pair<std::size_t, boost::shared_ptr<DYN::GeneratorInterface>>;                        ///< generator with the position of its node
+    using StaticVarCompensator = std::pair<std::size_t, boost::shared_ptr<DYN::StaticVarCompensatorInterface>>;  ///< svarc with the position of its node
+
+    /// @brief Switch of the voltage level
+    struct Switch {
+      common::Symbol id;  ///< switch id
+      std::size_t node1;  ///< position in nodes of the first node
+      std::size_t node2;  ///< position in nodes of the second node
+      bool isOpen;        ///< whether the switch is open
+    };
+
+    std::shared_ptr<VoltageLevel> voltageLevel;                   ///< voltage level element
+    std::vector<std::shared_ptr<Node>> nodes;                     ///< nodes of the voltage level, in network order
+    std::vector<Switch> switches;                                 ///< switches of the voltage level, open or closed
+    std::vector<Generator> generators;                            ///< connected generators, in network order
+    std::vector<StaticVarCompensator> svarcs;                     ///< connected static var compensators, in network order
+    std::vector<std::pair<common::Symbol, std::size_t>> aliases;  ///< ids of the buses merged into another node, with the position of the node
+    std::vector<std::size_t> busNodes;                            ///< position in nodes of the node of each bus of the voltage level
+  };
+
+  /**
+   * @brief Equipment of the network whose detail is not extracted yet
+   *
+   * @tparam T the interface type of the equipment in the data interface
+   */
+  template<class T>
+  using PendingEquipment = std::pair<Graph::NodeIndex, boost::shared_ptr<T>>;
+
+  /// @brief Edges of a switch, line or transformer in the graph
+  struct ElementEdges {
+    common::Symbol id;           ///< id of the element
+    Graph::EdgeIndex firstEdge;  ///< index of the first edge of the element
+    std::uint8_t nbEdges;        ///< number of consecutive edges of the element
+  };
+
+  /**
+   * @brief Bus regulated by an element extracted outside the main island, for the network cache only
+   *
+   * It is counted in the bus regulating maps once the element is reached by the main island, as if the element were still pending
+   */
+  struct PendingRegulation {
+    common::Symbol elementId;  ///< id of the generator or of the VSC converter
+    BusId nodeId1;             ///< id of the node of the generator, or of the first converter of the hvdc line
+    BusId nodeId2;             ///< id of the node of the second converter of the hvdc line, or of the node of the generator
+    BusId regulatedBus;        ///< id of the regulated bus
+    bool isVSCConverter;       ///< whether the element is a VSC converter
+  };
+
   /**
    * @brief Build node tree from data interface
+   *
+   * Voltage levels are extracted in parallel, then merged in network order before performing the connections between them.
+   * Once the islands are computed, the detail of the equipment is extracted for the main island only.
    */
   void buildTree();
 
   /**
-   * @brief Update a bus regulating map according to internal interface
+   * @brief Extract the detail of the pending generators, static var compensators and hvdc lines
+   *
+   * Only the equipment connected to the main island is extracted unless @p all is set, the rest staying pending.
+   * An hvdc line is extracted as soon as one of its converters is connected to the main island.
+   * The buses regulated by the elements extracted outside the main island are kept in the pending regulations.
+   *
+   * @param all whether all the pending equipment is extracted, whatever its island
+   */
+  void extractEquipment(bool all);
+
+  /**
+   * @brief Count the pending regulations in the bus regulating maps
+   *
+   * Only the regulations of the elements connected to the main island are counted unless @p all is set, the rest staying pending.
+   *
+   * @param all whether all the pending regulations are counted, whatever the island of their element
+   */
+  void countPendingRegulations(bool all);
+
+  /**
+   * @brief Build the graph, the walk order and the islands of the nodes
+   *
+   * @param builder the builder of the graph, containing all the nodes and edges
+   */
+  void computeTopology(Graph::Builder& builder);
+
+  /**
+   * @brief Add an edge of a network element to the graph
+   *
+   * The edges of an element must be added consecutively
+   *
+   * @param builder the builder of the graph
+   * @param elementId the id of the switch, line or transformer realizing the edge
+   * @param node1 index of the first node
+   * @param node2 index of the second node
+   * @param type type of the element
+   * @param isOpen whether the element is open
+   */
+  void addElementEdge(Graph::Builder& builder, const common::Symbol& elementId, Graph::NodeIndex node1, Graph::NodeIndex node2, Graph::EdgeType type,
+                      bool isOpen = false);
+
+  /**
+   * @brief Open or close a switch and update the islands
+   *
+   * @param switchId the id of the switch
+   * @param isOpen whether the switch is open
+   * @returns @b true if the state of the switch changed, @b false if not
+   * @throws std::out_of_range if the switch does not exist, or is a closed switch of a node-breaker voltage level, merged into a node
+   */
+  bool setSwitchOpen(const common::Symbol& switchId, bool isOpen);
+
+  /**
+   * @brief Save the node tree in a cache file
+   *
+   * @param filepath the path of the cache file
+   * @param key the key of the network file
+   */
+  void saveCache(const boost::filesystem::path& filepath, NetworkCache::Key key) const;
+
+  /**
+   * @brief Load the node tree from a cache file
+   *
+   * @param reader the reader of the cache file
+   * @throws std::runtime_error if the cache file is inconsistent
+   */
+  void loadCache(NetworkCache::Reader& reader);
+
+  /**
+   * @brief Remove all the elements of the node tree, after a failed load
+   */
+  void clearTree();
+
+  /**
+   * @brief Build the nodes of a voltage level with their shunts, loads and switches, and its connected generators and static var compensators
+   *
+   * Only touches the extract, so that several voltage levels can be built in parallel as long as they use different arenas
+   *
+   * In node-breaker voltage levels, the buses connected by closed switches are merged into a single node
+   *
+   * @param columns the columns extracted from the data interface
+   * @param vl the position of the voltage level in the columns
+   * @param arena the arena to allocate the voltage level elements from
+   * @param extract the extract to fill
+   */
+  static void extractVoltageLevel(const NetworkColumns& columns, std::size_t vl, const std::shared_ptr<common::Arena>& arena, VoltageLevelExtract& extract);
+
+  /**
+   * @brief Resolve the buses regulated by elements of the network
+   * @param elementIds the ids of the regulating elements
+   * @returns the regulated bus ids, in the order of @p elementIds
+   */
+  std::vector<BusId> resolveRegulatedBuses(const std::vector<std::string>& elementIds) const;
+
+  /**
+   * @brief Update a bus regulating map with a regulated bus
    * @param map the mapping to update
-   * @param elementId the element id to add to the map
-   * @param dataInterface the data interface to use
-   * @returns the regulated bus id
+   * @param regulatedBus the regulated bus id
    */
-  static BusId updateMapRegulatingBuses(BusMapRegulating& map, const std::string& elementId, const boost::shared_ptr<DYN::DataInterface>& dataInterface);
+  static void updateMapRegulatingBuses(BusMapRegulating& map, const BusId& regulatedBus);
+
+  /**
+   * @brief Retrieve a node by its id
+   *
+   * @param nodeId the id of the node
+   * @returns the node
+   * @throws std::out_of_range if the node does not exist
+   */
+  const std::shared_ptr<Node>& findNode(const Node::NodeId& nodeId) const;
 
  private:
-  boost::shared_ptr<DYN::DataInterface> interface_;           ///< data interface
-  std::shared_ptr<Node> slackNode_;                           ///< Slack node defined in network, if any
-  std::map<Node::NodeId, std::shared_ptr<Node>> nodes_;       ///< nodes representing the node tree
-  std::vector<ProcessNodeCallback> nodesCallbacks_;           ///< list of callback or nodes
-  std::vector<std::shared_ptr<HvdcLine>> hvdcLines_;          ///< hvdc Lines
-  std::vector<std::shared_ptr<VoltageLevel>> voltagelevels_;  ///< Voltage levels elements
-  std::vector<std::shared_ptr<Line>> lines_;                  ///< List of the lines
-  std::vector<std::shared_ptr<Tfo>> tfos_;                    ///< List of transformers
-  BusMapRegulating mapBusGeneratorsBusId_;                    ///< mapping of busId and the number of generators that regulate them
-  BusMapRegulating mapBusVSCConvertersBusId_;                 ///< mapping of busId and the number of VSC converters that regulate them
+  const boost::filesystem::path filepath_;                                ///< network file path
+  const unsigned int nbThreads_;                                          ///< number of threads for the extraction and the topological computations
+  mutable boost::shared_ptr<DYN::DataInterface> interface_;               ///< data interface, parsed on first use
+  bool loadedFromCache_;                                                  ///< whether the node tree was loaded from the cache
+  std::shared_ptr<common::Arena> arena_;                                  ///< arena of the topology objects, shared with the first extraction thread
+  std::shared_ptr<Node> slackNode_;                                       ///< Slack node defined in network, if any
+  std::vector<std::shared_ptr<Node>> nodes_;                              ///< nodes representing the node tree, by graph index
+  common::SymbolIndex nodesIndex_;                                        ///< positions of the nodes in nodes_ by node id, and by merged bus id
+  std::vector<std::pair<common::Symbol, Graph::NodeIndex>> nodeAliases_;  ///< buses of the data interface merged into another node, with its index
+  common::SymbolIndex elementsIndex_;                                     ///< positions in elementsEdges_ by switch, line and transformer id
+  std::vector<ElementEdges> elementsEdges_;                               ///< edges of the switches, lines and transformers
+  common::SymbolIndex injectionsIndex_;                                   ///< positions in nodes_ of the nodes of the loads, generators and svarcs by id
+  std::vector<Graph::NodeIndex> sortedNodes_;                             ///< indexes of the nodes sorted by id, for walkNodesById
+  std::unordered_set<common::Symbol> unmodelledInjections_;               ///< extracted generators and svarcs that are not part of the node tree
+  std::unordered_set<common::Symbol> disconnectedInjections_;             ///< injections disconnected by disconnectInjection
+  Graph graph_;                                                           ///< topological graph of the nodes
+  Islands islands_;                                                       ///< topological islands of the graph
+  std::deque<Converter> converters_;                                      ///< converters of the hvdc lines, with stable addresses
+  std::vector<std::shared_ptr<HvdcLine>> hvdcLines_;                      ///< hvdc Lines
+  std::vector<std::shared_ptr<VoltageLevel>> voltagelevels_;              ///< Voltage levels elements
+  std::vector<std::shared_ptr<Line>> lines_;                              ///< List of the lines
+  std::vector<std::shared_ptr<Tfo>> tfos_;                                ///< List of transformers
+  ReactiveCurveStore curves_;                                             ///< reactive capability curves of the generators and VSC converters
+  GeneratorTable generators_{curves_};                                    ///< voltage regulating generators, referenced by their node
+  BusMapRegulating mapBusGeneratorsBusId_;                                ///< mapping of busId and the number of generators that regulate them
+  BusMapRegulating mapBusVSCConvertersBusId_;                             ///< mapping of busId and the number of VSC converters that regulate them
+
+  std::vector<PendingEquipment<DYN::GeneratorInterface>> pendingGenerators_;         ///< connected generators outside the main island, in network order
+  std::vector<PendingEquipment<DYN::StaticVarCompensatorInterface>> pendingSvarcs_;  ///< connected svarcs outside the main island, in network order
+  std::vector<boost::shared_ptr<DYN::HvdcLineInterface>> pendingHvdcLines_;          ///< connected hvdc lines with no converter in the main island
+  std::vector<PendingRegulation> pendingRegulations_;                                ///< regulations of the elements extracted outside the main island
 };
 
 }  // namespace inputs
@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NetworkPrescan.h
+ *
+ * @brief Topology pre-scan of a network file header file
+ *
+ */
+
+#pragma once
+
+#include "Graph.h"
+#include "Islands.h"
+#include "Node.h"
+
+#include <boost/filesystem.hpp>
+#include <memory>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Topology pre-scan of an IIDM network file
+ *
+ * The network file is streamed once through a SAX parser, decompressing it on the fly if needed, and only the buses, the closed switches,
+ * the connected lines and transformers and the regulating generators are kept. This gives the topological graph and the islands of the network
+ * long before the data interface is built, to reject unusable networks early.
+ *
+ * Buses of bus-breaker voltage levels are the nodes of the network manager. In node-breaker voltage levels, the nodes connected
+ * by closed switches or internal connections are merged into a single node, named after the voltage level and the smallest merged node.
+ *
+ * Generators are considered as regulating with the same criteria as the network manager, so the regulating generators of the network
+ * manager are a subset of the ones of the pre-scan.
+ *
+ * The nodes of node-breaker voltage levels are not the ones of the network manager, so the sizes of the islands, and then the main island,
+ * may differ from the ones of the network manager: only the existence of a regulating generator in the whole network is a verdict,
+ * the main island of the pre-scan is a hint.
+ */
+class NetworkPrescan {
+ public:
+  /**
+   * @brief Constructor, scanning the network file
+   *
+   * Throws a std::runtime_error if the file cannot be read or is not a well formed IIDM file
+   *
+   * @param filepath the network file, compressed or not
+   * @param nbThreads the number of threads to use to compute the islands
+   */
+  explicit NetworkPrescan(const boost::filesystem::path& filepath, unsigned int nbThreads = 1);
+
+  /**
+   * @brief Retrieve the topological graph
+   *
+   * @returns the graph of the buses, connected by the closed switches and the connected lines and transformers
+   */
+  const Graph& getGraph() const {
+    return graph_;
+  }
+
+  /**
+   * @brief Retrieve the topological islands
+   *
+   * @returns the islands of the graph
+   */
+  const Islands& getIslands() const {
+    return islands_;
+  }
+
+  /**
+   * @brief Determines if a node holds a connected generator regulating the voltage
+   *
+   * @param index the index of the node in the graph
+   * @returns @b true if the node holds a regulating generator, @b false if not
+   */
+  bool hasRegulatingGenerator(Graph::NodeIndex index) const {
+    return regulatingNodes_[index];
+  }
+
+  /**
+   * @brief Determines if a regulating generator is connected to the network
+   *
+   * @returns @b true if a node holds a regulating generator, @b false if not
+   */
+  bool hasAnyRegulatingGenerator() const;
+
+  /**
+   * @brief Determines if a regulating generator is connected to the main island
+   *
+   * @returns @b true if a node of the main island holds a regulating generator, @b false if not
+   */
+  bool hasRegulatingGeneratorInMainIsland() const;
+
+ private:
+  std::vector<std::shared_ptr<VoltageLevel>> voltageLevels_;  ///< voltage levels, owning the nodes of the graph
+  Graph graph_;                                               ///< topological graph
+  Islands islands_;                                           ///< islands of the graph
+  std::vector<bool> regulatingNodes_;                         ///< nodes holding a regulating generator, by node index
+};
+
+}  // namespace inputs
+}  // namespace dfl
@@ -17,8 +17,14 @@
 
 #pragma once
 
+#include "Arena.h"
 #include "Behaviours.h"
+#include "GeneratorTable.h"
+#include "Graph.h"
+#include "SmallVector.h"
+#include "Symbol.h"
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
@@ -35,7 +41,7 @@ class Node;
  * aggregate of nodes
  */
 struct VoltageLevel {
-  using VoltageLevelId = std::string;  ///< Voltage level id
+  using VoltageLevelId = common::Symbol;  ///< Voltage level id
 
   /**
    * @brief Constructor
@@ -44,8 +50,8 @@ struct VoltageLevel {
    */
   explicit VoltageLevel(const VoltageLevelId& vlid);
 
-  const VoltageLevelId id;                   ///< id
-  std::vector<std::shared_ptr<Node>> nodes;  ///< nodes contained in the voltage level
+  const VoltageLevelId id;   ///< id
+  std::vector<Node*> nodes;  ///< nodes contained in the voltage level
 };
 
 /**
@@ -53,23 +59,25 @@ struct VoltageLevel {
  */
 class Line {
  public:
-  using LineId = std::string;  ///< Alias for line id
+  using LineId = common::Symbol;  ///< Alias for line id
 
   /**
    * @brief Build a line
    *
-   * This will update the neighbours and the line references in the input nodes
+   * This will update the line references in the input nodes
    * @param lineId the line id
    * @param node1 the origin of the line
    * @param node2 the extremity of the line
    * @param season active season of the line
+   * @param arena the arena to allocate the line from, or a null pointer to allocate it on the heap
    * @returns the built line
    */
-  static std::shared_ptr<Line> build(const LineId& lineId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2, const std::string& season);
+  static std::shared_ptr<Line> build(const LineId& lineId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2, const std::string& season,
+                                     const std::shared_ptr<common::Arena>& arena = nullptr);
 
-  const LineId id;                                   ///< line id
-  const std::string activeSeason;                    ///< active season associated with the line
-  const std::array<std::shared_ptr<Node>, 2> nodes;  ///< nodes of the line
+  const LineId id;                   ///< line id
+  const std::string activeSeason;    ///< active season associated with the line
+  const std::array<Node*, 2> nodes;  ///< nodes of the line
 
  private:
   /**
@@ -88,7 +96,7 @@ class Line {
  */
 class Tfo {
  public:
-  using TfoId = std::string;  ///< alias for transformer id
+  using TfoId = common::Symbol;  ///< alias for transformer id
 
   /**
    * @brief Build a two windings transformer
@@ -97,9 +105,11 @@ class Tfo {
    * @param tfoId the transformer id
    * @param node1 the first node
    * @param node2 the second node
+   * @param arena the arena to allocate the transformer from, or a null pointer to allocate it on the heap
    * @returns the built transformer
    */
-  static std::shared_ptr<Tfo> build(const TfoId& tfoId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2);
+  static std::shared_ptr<Tfo> build(const TfoId& tfoId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2,
+                                    const std::shared_ptr<common::Arena>& arena = nullptr);
 
   /**
    * @brief Build a three windings transformer
@@ -109,13 +119,14 @@ class Tfo {
    * @param node1 the first node
    * @param node2 the second node
    * @param node3 the third node
+   * @param arena the arena to allocate the transformer from, or a null pointer to allocate it on the heap
    * @returns the built transformer
    */
   static std::shared_ptr<Tfo> build(const TfoId& tfoId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2,
-                                    const std::shared_ptr<Node>& node3);
+                                    const std::shared_ptr<Node>& node3, const std::shared_ptr<common::Arena>& arena = nullptr);
 
-  const TfoId id;                                  ///< transformer id
-  const std::vector<std::shared_ptr<Node>> nodes;  ///< list of nodes
+  const TfoId id;                  ///< transformer id
+  const std::vector<Node*> nodes;  ///< list of nodes
 
  private:
   /**
@@ -140,7 +151,7 @@ class Tfo {
 
 /// @brief Topological shunt
 struct Shunt {
-  using ShuntId = std::string;  ///< alias for shunt id
+  using ShuntId = common::Symbol;  ///< alias for shunt id
 
   /**
    * @brief Constructor
@@ -156,10 +167,12 @@ struct Shunt {
  * @brief topological node structure
  *
  * This implement a graph node concept. It contains only the information required to perform the algorithms and not all information extractable from network file
+ *
+ * References to the voltage level, lines, transformers and converters are non-owning: these elements are owned by the network manager
  */
 class Node {
  public:
-  using NodeId = std::string;  ///< node id definition
+  using NodeId = common::Symbol;  ///< node id definition
 
   /**
    * @brief Builder for node
@@ -170,22 +183,33 @@ class Node {
    * @param vl the voltage level element containing the node
    * @param nominalVoltage the nominal voltage of the node
    * @param shunts the list of the shunts connectable to this node
+   * @param arena the arena to allocate the node from, or a null pointer to allocate it on the heap
    *
    * @returns the built node
    */
-  static std::shared_ptr<Node> build(const NodeId& id, const std::shared_ptr<VoltageLevel>& vl, double nominalVoltage, const std::vector<Shunt>& shunts);
-
-  const NodeId id;                                   ///< node id
-  const std::weak_ptr<VoltageLevel> voltageLevel;    ///< voltage level containing the node
-  const double nominalVoltage;                       ///< Nominal voltage of the node
-  const std::vector<Shunt> shunts;                   ///< Shunts connectable to the node
-  std::vector<std::weak_ptr<Line>> lines;            ///< Lines connected to this node
-  std::vector<std::weak_ptr<Tfo>> tfos;              ///< Transformers connected to this node
-  std::vector<std::shared_ptr<Node>> neighbours;     ///< list of neighbours
-  std::vector<Load> loads;                           ///< list of loads associated to this node
-  std::vector<Generator> generators;                 ///< list of generators associated to this node
-  std::vector<std::weak_ptr<Converter>> converters;  ///< list of converter associated to this node
-  std::vector<StaticVarCompensator> svarcs;             ///< List of static var compensators
+  static std::shared_ptr<Node> build(const NodeId& id, const std::shared_ptr<VoltageLevel>& vl, double nominalVoltage, const std::vector<Shunt>& shunts,
+                                     const std::shared_ptr<common::Arena>& arena = nullptr);
+
+  // Inline capacities of the lists, from the usual number of elements by node so that most nodes need no allocation
+  static constexpr std::size_t nbInlineShunts = 1;      ///< number of shunts stored inside the node
+  static constexpr std::size_t nbInlineLines = 2;       ///< number of lines stored inside the node
+  static constexpr std::size_t nbInlineTfos = 1;        ///< number of transformers stored inside the node
+  static constexpr std::size_t nbInlineLoads = 1;       ///< number of loads stored inside the node
+  static constexpr std::size_t nbInlineGenerators = 0;  ///< number of generators stored inside the node
+  static constexpr std::size_t nbInlineConverters = 0;  ///< number of converters stored inside the node
+  static constexpr std::size_t nbInlineSvarcs = 0;      ///< number of static var compensators stored inside the node
+
+  const NodeId id;                                                            ///< node id
+  Graph::NodeIndex index;                                                     ///< index of the node in the topological graph
+  VoltageLevel* const voltageLevel;                                           ///< voltage level containing the node
+  const double nominalVoltage;                                                ///< Nominal voltage of the node
+  const common::SmallVector<Shunt, nbInlineShunts> shunts;                    ///< Shunts connectable to the node
+  common::SmallVector<Line*, nbInlineLines> lines;                            ///< Lines connected to this node
+  common::SmallVector<Tfo*, nbInlineTfos> tfos;                               ///< Transformers connected to this node
+  common::SmallVector<Load, nbInlineLoads> loads;                             ///< list of loads associated to this node
+  common::SmallVector<GeneratorTable::Index, nbInlineGenerators> generators;  ///< rows of the generators associated to this node in the generator table
+  common::SmallVector<Converter*, nbInlineConverters> converters;             ///< list of converter associated to this node
+  common::SmallVector<StaticVarCompensator, nbInlineSvarcs> svarcs;           ///< List of static var compensators
 
  private:
   /**
@@ -0,0 +1,202 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ReactiveCurveStore.h
+ *
+ * @brief Shared reactive capability curve store header file
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Store of the reactive capability curves of the generators and VSC converters of the network
+ *
+ * Each distinct curve is sorted by active power and stored once, in a single buffer shared by all the curves.
+ * Curves are deduplicated by content, so that units sharing the same capabilities share the same curve id.
+ * A stored curve is never modified: the elements only keep the id of their curve.
+ *
+ * The ranges returned by points() are invalidated when a curve is added.
+ */
+class ReactiveCurveStore {
+ public:
+  using CurveId = std::uint32_t;  ///< alias for the id of a curve
+
+  /// @brief Reactive capability curve point
+  struct ReactiveCurvePoint {
+    /**
+     * @brief Constructor
+     *
+     * @param p active power
+     * @param qmin minimum reactive power
+     * @param qmax maximum reactive power
+     */
+    ReactiveCurvePoint(double p, double qmin, double qmax) : p{p}, qmin{qmin}, qmax{qmax} {}
+
+    double p;     ///< active power
+    double qmin;  ///< minimum reactive power
+    double qmax;  ///< maximum reactive power
+  };
+
+  /**
+   * @brief Points of a curve, inside the point buffer of the store
+   */
+  class Points {
+   public:
+    using const_iterator = const ReactiveCurvePoint*;  ///< alias for iterator
+
+    /**
+     * @brief Constructor
+     *
+     * @param first the first point
+     * @param last past the last point
+     */
+    Points(const ReactiveCurvePoint* first, const ReactiveCurvePoint* last) : first_{first}, last_{last} {}
+
+    /**
+     * @brief Retrieve the beginning of the points
+     * @returns iterator to the first point
+     */
+    const_iterator begin() const {
+      return first_;
+    }
+
+    /**
+     * @brief Retrieve the end of the points
+     * @returns iterator past the last point
+     */
+    const_iterator end() const {
+      return last_;
+    }
+
+    /**
+     * @brief Retrieve the number of points
+     * @returns number of points
+     */
+    std::size_t size() const {
+      return static_cast<std::size_t>(last_ - first_);
+    }
+
+    /**
+     * @brief Determines if there is no point
+     * @returns @b true if there is no point, @b false if not
+     */
+    bool empty() const {
+      return first_ == last_;
+    }
+
+    /**
+     * @brief Access a point
+     * @param i the position of the point
+     * @returns the point
+     */
+    const ReactiveCurvePoint& operator[](std::size_t i) const {
+      assert(i < size());
+      return first_[i];
+    }
+
+    /**
+     * @brief Access the first point
+     * @returns the point with the lowest active power
+     */
+    const ReactiveCurvePoint& front() const {
+      return (*this)[0];
+    }
+
+   private:
+    const ReactiveCurvePoint* first_;  ///< first point
+    const ReactiveCurvePoint* last_;   ///< past the last point
+  };
+
+  static constexpr CurveId emptyCurve = 0;  ///< id of the curve without points, always present in the store
+
+  /**
+   * @brief Add a curve
+   *
+   * The points are sorted by active power. If the store already contains a curve with the same points, its id is returned
+   * and nothing is added.
+   *
+   * @param points the points of the curve, in any order
+   * @returns the id of the curve
+   */
+  CurveId add(std::vector<ReactiveCurvePoint> points);
+
+  /**
+   * @brief Add a curve given with another point type
+   *
+   * the type Point requires to have the double fields "p", "qmin" and "qmax"
+   *
+   * @param points the points of the curve, in any order
+   * @returns the id of the curve
+   */
+  template<class Point>
+  CurveId add(const std::vector<Point>& points) {
+    std::vector<ReactiveCurvePoint> converted;
+    converted.reserve(points.size());
+    for (const auto& point : points) {
+      converted.emplace_back(point.p, point.qmin, point.qmax);
+    }
+    return add(std::move(converted));
+  }
+
+  /**
+   * @brief Retrieve the points of a curve
+   * @param curve the id of the curve
+   * @returns the points of the curve, sorted by active power
+   */
+  Points points(CurveId curve) const {
+    assert(curve + 1 < offsets_.size());
+    return Points(points_.data() + offsets_[curve], points_.data() + offsets_[curve + 1]);
+  }
+
+  /**
+   * @brief Retrieve the number of distinct curves, including the empty curve
+   * @returns number of curves
+   */
+  std::size_t size() const {
+    return offsets_.size() - 1;
+  }
+
+  /// @brief Remove all the curves but the empty curve
+  void clear();
+
+  /**
+   * @brief Estimate the memory retained by the store
+   *
+   * @returns number of bytes of the points and of the deduplication index
+   */
+  std::size_t memoryBytes() const;
+
+ private:
+  /**
+   * @brief Compute the hash of the content of a curve
+   * @param points the sorted points of the curve
+   * @returns the hash value
+   */
+  static std::size_t hash(const std::vector<ReactiveCurvePoint>& points);
+
+ private:
+  std::vector<std::uint32_t> offsets_{0, 0};                    ///< offset of the points of each curve in the point buffer, followed by the size of the buffer
+  std::vector<ReactiveCurvePoint> points_;                      ///< points of all the curves
+  std::unordered_multimap<std::size_t, CurveId> curvesByHash_;  ///< ids of the curves by hash of their content
+};
+
+}  // namespace inputs
+}  // namespace dfl
@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Bridges.cpp
+ *
+ * @brief Topological bridges and articulation points implementation file
+ *
+ */
+
+#include "Bridges.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace dfl {
+namespace inputs {
+
+constexpr Graph::EdgeIndex Bridges::noEdge;
+
+Bridges
+Bridges::compute(const Graph& graph) {
+  const auto nbNodes = graph.nbNodes();
+  Bridges bridges;
+  bridges.bridges_.assign(graph.nbEdges(), 0);
+  bridges.articulationPoints_.assign(nbNodes, 0);
+  bridges.orderedNodes_.reserve(nbNodes);
+  bridges.orders_.assign(nbNodes, std::numeric_limits<std::uint32_t>::max());
+  bridges.subtreeSizes_.assign(nbNodes, 1);
+  bridges.parentEdges_.assign(nbNodes, noEdge);
+
+  // lowest order reachable from the subtree of each node with at most one edge outside the search tree
+  std::vector<std::uint32_t> lows(nbNodes);
+  // explicit stack of the search: node and position of the next neighbour to explore
+  std::vector<std::pair<Graph::NodeIndex, std::size_t>> stack;
+  for (Graph::NodeIndex root = 0; root < nbNodes; ++root) {
+    if (bridges.orders_[root] != std::numeric_limits<std::uint32_t>::max()) {
+      continue;
+    }
+    bridges.orders_[root] = lows[root] = static_cast<std::uint32_t>(bridges.orderedNodes_.size());
+    bridges.orderedNodes_.push_back(root);
+    std::size_t nbRootChildren = 0;
+    stack.emplace_back(root, 0);
+
+    while (!stack.empty()) {
+      const auto index = stack.back().first;
+      auto& next = stack.back().second;
+      const auto neighbours = graph.neighbours(index);
+      const auto edges = graph.incidentEdges(index);
+      if (next < neighbours.size()) {
+        const auto neighbour = neighbours[next];
+        const auto edge = edges[next];
+        ++next;
+        // parallel edges are distinguished from the edge to the parent
+        if (graph.isEdgeOpen(edge) || edge == bridges.parentEdges_[index]) {
+          continue;
+        }
+        if (bridges.orders_[neighbour] == std::numeric_limits<std::uint32_t>::max()) {
+          bridges.orders_[neighbour] = lows[neighbour] = static_cast<std::uint32_t>(bridges.orderedNodes_.size());
+          bridges.orderedNodes_.push_back(neighbour);
+          bridges.parentEdges_[neighbour] = edge;
+          stack.emplace_back(neighbour, 0);
+        } else {
+          lows[index] = std::min(lows[index], bridges.orders_[neighbour]);
+        }
+        continue;
+      }
+
+      // subtree of the node fully explored: its lowpoint is propagated to its parent
+      stack.pop_back();
+      if (stack.empty()) {
+        break;
+      }
+      const auto parent = stack.back().first;
+      lows[parent] = std::min(lows[parent], lows[index]);
+      bridges.subtreeSizes_[parent] += bridges.subtreeSizes_[index];
+      if (lows[index] > bridges.orders_[parent]) {
+        bridges.bridges_[bridges.parentEdges_[index]] = 1;
+      }
+      if (parent == root) {
+        ++nbRootChildren;
+      } else if (lows[index] >= bridges.orders_[parent]) {
+        bridges.articulationPoints_[parent] = 1;
+      }
+    }
+    if (nbRootChildren > 1) {
+      bridges.articulationPoints_[root] = 1;
+    }
+  }
+
+  return bridges;
+}
+
+}  // namespace inputs
+}  // namespace dfl
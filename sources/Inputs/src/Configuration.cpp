@@ -88,8 +88,11 @@ Configuration::Configuration(const boost::filesystem::path& filepath) {
     helper::updateValue(isSVCRegulationOn_, config, "SVCRegulationOn");
     helper::updateValue(isShuntRegulationOn_, config, "ShuntRegulationOn");
     helper::updateValue(isAutomaticSlackBusOn_, config, "AutomaticSlackBusOn");
+    helper::updateValue(isNetworkPrescanOn_, config, "NetworkPrescanOn");
     helper::updateValue(outputDir_, config, "OutputDir");
     helper::updateValue(dsoVoltageLevel_, config, "DsoVoltageLevel");
+    helper::updateValue(nbThreads_, config, "NbThreads");
+    helper::updateValue(networkCacheDir_, config, "NetworkCacheDir");
     helper::updateValue(settingFilePath_, config, "SettingPath");
     helper::updateValue(assemblingFilePath_, config, "AssemblyPath");
     helper::updateActivePowerCompensationValue(activePowerCompensation_, config);
@@ -0,0 +1,196 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  DecompressedFile.cpp
+ *
+ * @brief Decompressed input file implementation file
+ *
+ */
+
+#include "DecompressedFile.h"
+
+#include <archive.h>
+#include <array>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <pthread.h>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dfl {
+namespace inputs {
+
+/// @brief Size of the blocks read from the compressed file and written to the named pipe
+static constexpr std::size_t blockSize = 1 << 16;
+
+/// @brief Reader of libarchive, freed when going out of scope
+using ArchiveReader = std::unique_ptr<struct archive, int (*)(struct archive*)>;
+
+/// @brief Magic numbers at the beginning of the compressed files: gzip, bzip2, xz and zstd
+static const std::array<std::string, 4> compressionMagics = {std::string("\x1f\x8b", 2), std::string("BZh", 3), std::string("\xfd" "7zXZ\0", 6),
+                                                             std::string("\x28\xb5\x2f\xfd", 4)};
+
+/// @brief Raised when the named pipe cannot be written anymore, its reader having closed it before the end of the content
+struct PipeClosed {};
+
+DecompressedFile::DecompressedFile(const boost::filesystem::path& filepath) :
+    temporaryDir_{},
+    filepath_{filepath},
+    opened_{},
+    decompression_{},
+    error_{} {
+  if (!isCompressed(filepath)) {
+    return;
+  }
+
+  temporaryDir_ = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("dfl-%%%%-%%%%-%%%%-%%%%");
+  boost::filesystem::create_directories(temporaryDir_);
+  filepath_ = temporaryDir_ / uncompressedFilename(filepath);
+  if (::mkfifo(filepath_.c_str(), S_IRUSR | S_IWUSR) != 0) {
+    const std::string error = std::strerror(errno);
+    boost::system::error_code ec;
+    boost::filesystem::remove_all(temporaryDir_, ec);
+    throw std::runtime_error("Cannot create the named pipe " + filepath_.generic_string() + ": " + error);
+  }
+  decompression_ = std::thread(&DecompressedFile::feed, this, filepath);
+}
+
+DecompressedFile::~DecompressedFile() {
+  stop();
+  if (!temporaryDir_.empty()) {
+    boost::system::error_code ec;
+    boost::filesystem::remove_all(temporaryDir_, ec);
+  }
+}
+
+void
+DecompressedFile::close() {
+  stop();
+  if (error_) {
+    auto error = error_;
+    error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void
+DecompressedFile::feed(const boost::filesystem::path& filepath) {
+  // a write to a pipe without reader fails with EPIPE in this thread, instead of raising SIGPIPE in the process
+  sigset_t signals;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGPIPE);
+  pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+  // waits for the reader
+  const int pipe = ::open(filepath_.c_str(), O_WRONLY);
+  opened_.set_value();
+  if (pipe < 0) {
+    error_ = std::make_exception_ptr(std::runtime_error("Cannot open the named pipe " + filepath_.generic_string() + ": " + std::strerror(errno)));
+    return;
+  }
+
+  try {
+    read(filepath, [pipe](const char* data, std::size_t size) {
+      while (size > 0) {
+        const auto written = ::write(pipe, data, size);
+        if (written < 0 && errno == EINTR) {
+          continue;
+        }
+        if (written < 0) {
+          throw PipeClosed();
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+      }
+    });
+  } catch (const PipeClosed&) {
+    // the reader does not need the rest of the content, which is not decompressed
+  } catch (const std::exception&) {
+    error_ = std::current_exception();
+  }
+  ::close(pipe);
+}
+
+void
+DecompressedFile::stop() {
+  if (!decompression_.joinable()) {
+    return;
+  }
+  const int pipe = ::open(filepath_.c_str(), O_RDONLY | O_NONBLOCK);
+  opened_.get_future().wait();
+  if (pipe >= 0) {
+    ::close(pipe);
+  }
+  decompression_.join();
+}
+
+void
+DecompressedFile::read(const boost::filesystem::path& filepath, const std::function<void(const char* data, std::size_t size)>& onBlock) {
+  ArchiveReader reader(archive_read_new(), &archive_read_free);
+  archive_read_support_filter_all(reader.get());
+  archive_read_support_format_raw(reader.get());
+  struct archive_entry* entry = nullptr;
+  if (archive_read_open_filename(reader.get(), filepath.c_str(), blockSize) != ARCHIVE_OK || archive_read_next_header(reader.get(), &entry) != ARCHIVE_OK) {
+    throw std::runtime_error("Cannot read " + filepath.generic_string() + ": " + archive_error_string(reader.get()));
+  }
+
+  std::array<char, blockSize> block;
+  ssize_t size = 0;
+  while ((size = archive_read_data(reader.get(), block.data(), block.size())) > 0) {
+    onBlock(block.data(), static_cast<std::size_t>(size));
+  }
+  if (size < 0) {
+    throw std::runtime_error("Cannot read " + filepath.generic_string() + ": " + archive_error_string(reader.get()));
+  }
+}
+
+void
+DecompressedFile::decompress(const boost::filesystem::path& filepath, const boost::filesystem::path& decompressedFilepath) {
+  std::ofstream file(decompressedFilepath.generic_string(), std::ios::binary | std::ios::trunc);
+  read(filepath, [&file](const char* data, std::size_t size) { file.write(data, static_cast<std::streamsize>(size)); });
+  file.close();
+  if (!file) {
+    throw std::runtime_error("Cannot write " + decompressedFilepath.generic_string());
+  }
+}
+
+bool
+DecompressedFile::isCompressed(const boost::filesystem::path& filepath) {
+  std::ifstream file(filepath.generic_string(), std::ios::binary);
+  char header[6] = {};
+  file.read(header, sizeof(header));
+  const std::string start(header, static_cast<std::size_t>(file.gcount()));
+  for (const auto& magic : compressionMagics) {
+    if (start.compare(0, magic.size(), magic) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+boost::filesystem::path
+DecompressedFile::uncompressedFilename(const boost::filesystem::path& filepath) {
+  const auto extension = filepath.extension();
+  if (extension == ".gz" || extension == ".bz2" || extension == ".xz" || extension == ".zst") {
+    return filepath.stem();
+  }
+  return filepath.filename();
+}
+
+}  // namespace inputs
+}  // namespace dfl
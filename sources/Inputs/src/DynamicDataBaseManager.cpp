@@ -107,6 +107,58 @@ DynamicDataBaseManager::DynamicDataBaseManager(const boost::filesystem::path& se
   helper::parserFile(assemblingFilePath, factory, assemblingDoc_);
 }
 
+void
+DynamicDataBaseManager::addMemoryFootprint(common::MemoryFootprint& footprint) const {
+  using common::memory::optionalBytes;
+  using common::memory::stringBytes;
+  using common::memory::vectorBytes;
+
+  auto nameBytes = [](const std::string& str) { return stringBytes(str); };
+  const auto& sets = settingDoc_.sets();
+  footprint.add("dynamicDataBase.setting", sets.size(), vectorBytes(sets, [&nameBytes](const SettingXmlDocument::Set& set) {
+    return stringBytes(set.id) +
+           vectorBytes(set.counts, [](const SettingXmlDocument::Count& count) { return stringBytes(count.name) + stringBytes(count.id); }) +
+           vectorBytes(set.refs,
+                       [](const SettingXmlDocument::Ref& ref) { return stringBytes(ref.id) + stringBytes(ref.name) + stringBytes(ref.tag); }) +
+           vectorBytes(set.references,
+                       [&nameBytes](const SettingXmlDocument::Reference& reference) {
+                         return optionalBytes(reference.componentId, nameBytes) + stringBytes(reference.name) + stringBytes(reference.origName);
+                       }) +
+           vectorBytes(set.doubleParameters, [](const SettingXmlDocument::Parameter<double>& param) { return stringBytes(param.name); }) +
+           vectorBytes(set.boolParameters, [](const SettingXmlDocument::Parameter<bool>& param) { return stringBytes(param.name); }) +
+           vectorBytes(set.integerParameters, [](const SettingXmlDocument::Parameter<int>& param) { return stringBytes(param.name); }) +
+           vectorBytes(set.stringParameters,
+                       [](const SettingXmlDocument::Parameter<std::string>& param) { return stringBytes(param.name) + stringBytes(param.value); });
+  }));
+
+  const auto& macroConnections = assemblingDoc_.macroConnections();
+  const auto& singleAssociations = assemblingDoc_.singleAssociations();
+  const auto& multipleAssociations = assemblingDoc_.multipleAssociations();
+  const auto& automatons = assemblingDoc_.dynamicAutomatons();
+  std::size_t bytes = vectorBytes(macroConnections, [](const AssemblingXmlDocument::MacroConnection& macroConnection) {
+    return stringBytes(macroConnection.id) + vectorBytes(macroConnection.connections, [](const AssemblingXmlDocument::Connection& connection) {
+             return stringBytes(connection.var1) + stringBytes(connection.var2);
+           });
+  });
+  bytes += vectorBytes(singleAssociations, [](const AssemblingXmlDocument::SingleAssociation& association) {
+    return stringBytes(association.id) +
+           optionalBytes(association.bus, [](const AssemblingXmlDocument::Bus& bus) { return stringBytes(bus.voltageLevel); }) +
+           optionalBytes(association.tfo, [](const AssemblingXmlDocument::Tfo& tfo) { return stringBytes(tfo.name); }) +
+           optionalBytes(association.line, [](const AssemblingXmlDocument::Line& line) { return stringBytes(line.name); });
+  });
+  bytes += vectorBytes(multipleAssociations, [](const AssemblingXmlDocument::MultipleAssociation& association) {
+    return stringBytes(association.id) + stringBytes(association.shunt.voltageLevel);
+  });
+  bytes += vectorBytes(automatons, [](const AssemblingXmlDocument::DynamicAutomaton& automaton) {
+    return stringBytes(automaton.id) + stringBytes(automaton.lib) +
+           vectorBytes(automaton.macroConnects, [](const AssemblingXmlDocument::MacroConnect& macroConnect) {
+             return stringBytes(macroConnect.macroConnection) + stringBytes(macroConnect.id);
+           });
+  });
+  footprint.add("dynamicDataBase.assembling", macroConnections.size() + singleAssociations.size() + multipleAssociations.size() + automatons.size(),
+                bytes);
+}
+
 }  // namespace inputs
 
 }  // namespace dfl
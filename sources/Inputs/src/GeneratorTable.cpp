@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  GeneratorTable.cpp
+ *
+ * @brief Columnar generator table implementation file
+ *
+ */
+
+#include "GeneratorTable.h"
+
+#include "MemoryFootprint.h"
+
+namespace dfl {
+namespace inputs {
+
+GeneratorTable::Index
+GeneratorTable::add(const GeneratorId& id, CurveId curve, double qmin, double qmax, double pmin, double pmax, double targetP, const BusId& regulatedBusId,
+                    const BusId& connectedBusId) {
+  const auto row = static_cast<Index>(ids_.size());
+  ids_.push_back(id);
+  curveIds_.push_back(curve);
+  qmin_.push_back(qmin);
+  qmax_.push_back(qmax);
+  pmin_.push_back(pmin);
+  pmax_.push_back(pmax);
+  targetP_.push_back(targetP);
+  regulatedBusIds_.push_back(regulatedBusId);
+  connectedBusIds_.push_back(connectedBusId);
+  return row;
+}
+
+void
+GeneratorTable::clear() {
+  ids_.clear();
+  curveIds_.clear();
+  qmin_.clear();
+  qmax_.clear();
+  pmin_.clear();
+  pmax_.clear();
+  targetP_.clear();
+  regulatedBusIds_.clear();
+  connectedBusIds_.clear();
+}
+
+std::size_t
+GeneratorTable::memoryBytes() const {
+  return common::memory::vectorBytes(ids_) + common::memory::vectorBytes(curveIds_) + common::memory::vectorBytes(qmin_) + common::memory::vectorBytes(qmax_) +
+         common::memory::vectorBytes(pmin_) + common::memory::vectorBytes(pmax_) + common::memory::vectorBytes(targetP_) +
+         common::memory::vectorBytes(regulatedBusIds_) + common::memory::vectorBytes(connectedBusIds_);
+}
+
+}  // namespace inputs
+}  // namespace dfl
@@ -0,0 +1,224 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Graph.cpp
+ *
+ * @brief Topological graph implementation file
+ *
+ */
+
+#include "Graph.h"
+
+#include "MemoryFootprint.h"
+#include "Node.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <unordered_map>
+
+namespace dfl {
+namespace inputs {
+
+Graph::Builder::Builder(const Graph& graph) :
+    nodes_(graph.nodes_),
+    edgesNode1_(graph.edgesNode1_),
+    edgesNode2_(graph.edgesNode2_),
+    edgesType_(graph.edgesType_),
+    edgesOpen_(graph.edgesOpen_) {}
+
+Graph::NodeIndex
+Graph::Builder::addNode(const std::shared_ptr<Node>& node) {
+  auto index = static_cast<NodeIndex>(nodes_.size());
+  node->index = index;
+  nodes_.push_back(node);
+  return index;
+}
+
+Graph::NodeIndex
+Graph::Builder::addFictitiousNode() {
+  auto index = static_cast<NodeIndex>(nodes_.size());
+  nodes_.push_back(nullptr);
+  return index;
+}
+
+Graph::EdgeIndex
+Graph::Builder::addEdge(NodeIndex node1, NodeIndex node2, EdgeType type, bool isOpen) {
+  // Nodes existence is checked outside the builder
+  assert(node1 < nodes_.size());
+  assert(node2 < nodes_.size());
+
+  edgesNode1_.push_back(node1);
+  edgesNode2_.push_back(node2);
+  edgesType_.push_back(type);
+  edgesOpen_.push_back(isOpen ? 1 : 0);
+  return static_cast<EdgeIndex>(edgesType_.size() - 1);
+}
+
+std::vector<Graph::NodeIndex>
+Graph::Builder::renumber() {
+  const auto nbNodes = nodes_.size();
+
+  // voltage levels numbered in order of appearance, nodes without voltage level sharing the same group
+  std::unordered_map<const VoltageLevel*, std::uint32_t> levelNumbers;
+  std::vector<const VoltageLevel*> levels;
+  std::vector<std::uint32_t> nodeLevels(nbNodes);
+  std::vector<std::vector<NodeIndex>> levelNodes;
+  for (NodeIndex index = 0; index < nbNodes; ++index) {
+    const auto inserted = levelNumbers.emplace(nodes_[index]->voltageLevel, static_cast<std::uint32_t>(levels.size()));
+    if (inserted.second) {
+      levels.push_back(nodes_[index]->voltageLevel);
+      levelNodes.emplace_back();
+    }
+    nodeLevels[index] = inserted.first->second;
+    levelNodes[inserted.first->second].push_back(index);
+  }
+  for (auto& nodes : levelNodes) {
+    std::sort(nodes.begin(), nodes.end(), [this](NodeIndex lhs, NodeIndex rhs) { return nodes_[lhs]->id < nodes_[rhs]->id; });
+  }
+
+  std::vector<std::vector<std::uint32_t>> adjacency(levels.size());
+  for (std::size_t edge = 0; edge < edgesType_.size(); ++edge) {
+    const auto level1 = nodeLevels[edgesNode1_[edge]];
+    const auto level2 = nodeLevels[edgesNode2_[edge]];
+    if (level1 != level2) {
+      adjacency[level1].push_back(level2);
+      adjacency[level2].push_back(level1);
+    }
+  }
+  for (auto& neighbours : adjacency) {
+    std::sort(neighbours.begin(), neighbours.end());
+    neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+  }
+  auto levelBefore = [&levels, &adjacency](std::uint32_t lhs, std::uint32_t rhs) {
+    if (adjacency[lhs].size() != adjacency[rhs].size()) {
+      return adjacency[lhs].size() < adjacency[rhs].size();
+    }
+    if (!levels[lhs] || !levels[rhs]) {
+      return !levels[lhs] && levels[rhs];
+    }
+    return levels[lhs]->id < levels[rhs]->id;
+  };
+  for (auto& neighbours : adjacency) {
+    std::sort(neighbours.begin(), neighbours.end(), levelBefore);
+  }
+
+  std::vector<std::uint32_t> starts(levels.size());
+  std::iota(starts.begin(), starts.end(), 0);
+  std::sort(starts.begin(), starts.end(), levelBefore);
+  std::vector<bool> visited(levels.size(), false);
+  std::vector<std::uint32_t> queue;
+  queue.reserve(levels.size());
+  std::vector<NodeIndex> newIndexes(nbNodes);
+  NodeIndex nextIndex = 0;
+  for (auto start : starts) {
+    if (visited[start]) {
+      continue;
+    }
+    visited[start] = true;
+    queue.push_back(start);
+    for (auto head = queue.size() - 1; head < queue.size(); ++head) {
+      const auto level = queue[head];
+      for (auto index : levelNodes[level]) {
+        newIndexes[index] = nextIndex++;
+      }
+      for (auto neighbour : adjacency[level]) {
+        if (!visited[neighbour]) {
+          visited[neighbour] = true;
+          queue.push_back(neighbour);
+        }
+      }
+    }
+  }
+
+  std::vector<std::shared_ptr<Node>> nodes(nbNodes);
+  for (NodeIndex index = 0; index < nbNodes; ++index) {
+    nodes_[index]->index = newIndexes[index];
+    nodes[newIndexes[index]] = std::move(nodes_[index]);
+  }
+  nodes_.swap(nodes);
+  for (std::size_t edge = 0; edge < edgesType_.size(); ++edge) {
+    edgesNode1_[edge] = newIndexes[edgesNode1_[edge]];
+    edgesNode2_[edge] = newIndexes[edgesNode2_[edge]];
+  }
+  return newIndexes;
+}
+
+Graph
+Graph::Builder::build() {
+  Graph graph;
+  const auto nbNodes = nodes_.size();
+  const auto nbEdges = edgesType_.size();
+
+  // Counting sort of the edge extremities by node: the adjacency of a node keeps the order of insertion of the edges
+  graph.offsets_.assign(nbNodes + 1, 0);
+  graph.degrees_.assign(nbNodes, 0);
+  for (std::size_t edge = 0; edge < nbEdges; ++edge) {
+    ++graph.offsets_[edgesNode1_[edge] + 1];
+    ++graph.offsets_[edgesNode2_[edge] + 1];
+    if (!edgesOpen_[edge]) {
+      ++graph.degrees_[edgesNode1_[edge]];
+      ++graph.degrees_[edgesNode2_[edge]];
+    }
+  }
+  for (std::size_t index = 0; index < nbNodes; ++index) {
+    graph.offsets_[index + 1] += graph.offsets_[index];
+  }
+
+  graph.adjacentNodes_.resize(2 * nbEdges);
+  graph.adjacentEdges_.resize(2 * nbEdges);
+  std::vector<EdgeIndex> positions(graph.offsets_.begin(), graph.offsets_.end() - 1);
+  for (std::size_t edge = 0; edge < nbEdges; ++edge) {
+    auto node1 = edgesNode1_[edge];
+    auto node2 = edgesNode2_[edge];
+    auto& position1 = positions[node1];
+    graph.adjacentNodes_[position1] = node2;
+    graph.adjacentEdges_[position1] = static_cast<EdgeIndex>(edge);
+    ++position1;
+    auto& position2 = positions[node2];
+    graph.adjacentNodes_[position2] = node1;
+    graph.adjacentEdges_[position2] = static_cast<EdgeIndex>(edge);
+    ++position2;
+  }
+
+  graph.nodes_.swap(nodes_);
+  graph.edgesNode1_.swap(edgesNode1_);
+  graph.edgesNode2_.swap(edgesNode2_);
+  graph.edgesType_.swap(edgesType_);
+  graph.edgesOpen_.swap(edgesOpen_);
+  return graph;
+}
+
+bool
+Graph::setEdgeOpen(EdgeIndex edge, bool isOpen) {
+  if (isEdgeOpen(edge) == isOpen) {
+    return false;
+  }
+  edgesOpen_[edge] = isOpen ? 1 : 0;
+  if (isOpen) {
+    --degrees_[edgesNode1_[edge]];
+    --degrees_[edgesNode2_[edge]];
+  } else {
+    ++degrees_[edgesNode1_[edge]];
+    ++degrees_[edgesNode2_[edge]];
+  }
+  return true;
+}
+
+std::size_t
+Graph::memoryBytes() const {
+  return common::memory::vectorBytes(nodes_) + common::memory::vectorBytes(offsets_) + common::memory::vectorBytes(degrees_) +
+         common::memory::vectorBytes(adjacentNodes_) + common::memory::vectorBytes(adjacentEdges_) + common::memory::vectorBytes(edgesNode1_) +
+         common::memory::vectorBytes(edgesNode2_) + common::memory::vectorBytes(edgesType_) + common::memory::vectorBytes(edgesOpen_);
+}
+
+}  // namespace inputs
+}  // namespace dfl
@@ -18,8 +18,8 @@
 #include "HvdcLine.h"
 namespace dfl {
 namespace inputs {
-HvdcLine::HvdcLine(const std::string& id, const ConverterType converterType, const std::shared_ptr<Converter>& converter1,
-                   const std::shared_ptr<Converter>& converter2, const boost::optional<ActivePowerControl>& activePowerControl, double pMax) :
+HvdcLine::HvdcLine(const HvdcLineId& id, const ConverterType converterType, const Converter* converter1, const Converter* converter2,
+                   const boost::optional<ActivePowerControl>& activePowerControl, double pMax) :
     id{id},
     converterType{converterType},
     converter1(converter1),
@@ -30,26 +30,17 @@ HvdcLine::HvdcLine(const std::string& id, const ConverterType converterType, con
   assert(converter1);
   assert(converter2);
   // The converters must have the same type as the HVDC line
-  switch (converterType) {
-  case ConverterType::LCC:
-    assert(std::dynamic_pointer_cast<LCCConverter>(converter1));
-    assert(std::dynamic_pointer_cast<LCCConverter>(converter2));
-    break;
-  case ConverterType::VSC:
-    assert(std::dynamic_pointer_cast<VSCConverter>(converter1));
-    assert(std::dynamic_pointer_cast<VSCConverter>(converter2));
-    break;
-  default:  // impossible case by definition of the enum
-    break;
-  }
+  assert(converter1->type == converterType);
+  assert(converter2->type == converterType);
 }
 
 std::shared_ptr<HvdcLine>
-HvdcLine::build(const std::string& id, const ConverterType converterType, const std::shared_ptr<Converter>& converter1,
-                const std::shared_ptr<Converter>& converter2, const boost::optional<ActivePowerControl>& activePowerControl, double pMax) {
-  auto hvdcLineCreated = std::shared_ptr<HvdcLine>(new HvdcLine(id, converterType, converter1, converter2, activePowerControl, pMax));
-  converter1->hvdcLine = hvdcLineCreated;
-  converter2->hvdcLine = hvdcLineCreated;
+HvdcLine::build(const HvdcLineId& id, const ConverterType converterType, Converter* converter1, Converter* converter2,
+                const boost::optional<ActivePowerControl>& activePowerControl, double pMax, const std::shared_ptr<common::Arena>& arena) {
+  auto hvdcLineCreated = common::makeSharedWith<HvdcLine>(
+      arena, [&](void* memory) { return new (memory) HvdcLine(id, converterType, converter1, converter2, activePowerControl, pMax); });
+  converter1->hvdcLine = hvdcLineCreated.get();
+  converter2->hvdcLine = hvdcLineCreated.get();
   return hvdcLineCreated;
 }
 
@@ -0,0 +1,334 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Islands.cpp
+ *
+ * @brief Topological islands implementation file
+ *
+ */
+
+#include "Islands.h"
+
+#include "MemoryFootprint.h"
+#include "Node.h"
+#include "Parallel.h"
+
+#include <atomic>
+#include <limits>
+#include <memory>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Find the root of a node in the union-find forest
+ *
+ * Path halving is performed along the way
+ *
+ * @param parents the parent of each node
+ * @param index the node index
+ * @returns the root of the node
+ */
+static Graph::NodeIndex
+findRoot(std::vector<Graph::NodeIndex>& parents, Graph::NodeIndex index) {
+  while (parents[index] != index) {
+    parents[index] = parents[parents[index]];
+    index = parents[index];
+  }
+  return index;
+}
+
+/**
+ * @brief Find the root of a node in a union-find forest shared between threads
+ *
+ * Path halving is performed along the way. Parents only decrease so a failed halving only means that another thread already
+ * shortened the path.
+ *
+ * @param parents the parent of each node
+ * @param index the node index
+ * @returns the root of the node
+ */
+static Graph::NodeIndex
+findRootConcurrent(std::atomic<Graph::NodeIndex>* parents, Graph::NodeIndex index) {
+  auto parent = parents[index].load(std::memory_order_relaxed);
+  while (parent != index) {
+    auto grandParent = parents[parent].load(std::memory_order_relaxed);
+    if (grandParent != parent) {
+      parents[index].compare_exchange_weak(parent, grandParent, std::memory_order_relaxed);
+    }
+    index = grandParent;
+    parent = parents[index].load(std::memory_order_relaxed);
+  }
+  return index;
+}
+
+/**
+ * @brief Merge the trees of two nodes in a union-find forest shared between threads
+ *
+ * The root with the highest index is linked under the other one so that no cycle can appear.
+ *
+ * @param parents the parent of each node
+ * @param node1 the first node index
+ * @param node2 the second node index
+ */
+static void
+uniteConcurrent(std::atomic<Graph::NodeIndex>* parents, Graph::NodeIndex node1, Graph::NodeIndex node2) {
+  while (true) {
+    auto root1 = findRootConcurrent(parents, node1);
+    auto root2 = findRootConcurrent(parents, node2);
+    if (root1 == root2) {
+      return;
+    }
+    if (root1 < root2) {
+      std::swap(root1, root2);
+    }
+    // fails if another thread linked root1 in the meantime: retry from the new roots
+    if (parents[root1].compare_exchange_strong(root1, root2)) {
+      return;
+    }
+    node1 = root1;
+    node2 = root2;
+  }
+}
+
+Islands
+Islands::compute(const Graph& graph, unsigned int nbThreads) {
+  const auto nbNodes = graph.nbNodes();
+  std::vector<Graph::NodeIndex> roots(nbNodes);
+
+  if (nbThreads <= 1) {
+    std::vector<std::size_t> rootSizes(nbNodes, 1);
+    for (std::size_t index = 0; index < nbNodes; ++index) {
+      roots[index] = static_cast<Graph::NodeIndex>(index);
+    }
+
+    for (std::size_t edge = 0; edge < graph.nbEdges(); ++edge) {
+      if (graph.isEdgeOpen(static_cast<Graph::EdgeIndex>(edge))) {
+        continue;
+      }
+      auto root1 = findRoot(roots, graph.edgeNode1(static_cast<Graph::EdgeIndex>(edge)));
+      auto root2 = findRoot(roots, graph.edgeNode2(static_cast<Graph::EdgeIndex>(edge)));
+      if (root1 == root2) {
+        continue;
+      }
+      // union by size: the smallest tree is attached to the largest one
+      if (rootSizes[root1] < rootSizes[root2]) {
+        std::swap(root1, root2);
+      }
+      roots[root2] = root1;
+      rootSizes[root1] += rootSizes[root2];
+    }
+
+    for (std::size_t index = 0; index < nbNodes; ++index) {
+      roots[index] = findRoot(roots, static_cast<Graph::NodeIndex>(index));
+    }
+  } else {
+    std::unique_ptr<std::atomic<Graph::NodeIndex>[]> parents(new std::atomic<Graph::NodeIndex>[nbNodes]);
+    common::parallelFor(nbNodes, nbThreads, [&parents](std::size_t begin, std::size_t end) {
+      for (auto index = begin; index < end; ++index) {
+        parents[index].store(static_cast<Graph::NodeIndex>(index), std::memory_order_relaxed);
+      }
+    });
+    common::parallelFor(graph.nbEdges(), nbThreads, [&parents, &graph](std::size_t begin, std::size_t end) {
+      for (auto edge = begin; edge < end; ++edge) {
+        if (graph.isEdgeOpen(static_cast<Graph::EdgeIndex>(edge))) {
+          continue;
+        }
+        uniteConcurrent(parents.get(), graph.edgeNode1(static_cast<Graph::EdgeIndex>(edge)), graph.edgeNode2(static_cast<Graph::EdgeIndex>(edge)));
+      }
+    });
+    common::parallelFor(nbNodes, nbThreads, [&parents, &roots](std::size_t begin, std::size_t end) {
+      for (auto index = begin; index < end; ++index) {
+        roots[index] = findRootConcurrent(parents.get(), static_cast<Graph::NodeIndex>(index));
+      }
+    });
+  }
+
+  return label(graph, roots);
+}
+
+Islands
+Islands::label(const Graph& graph, const std::vector<Graph::NodeIndex>& roots) {
+  const auto nbNodes = graph.nbNodes();
+  Islands islands;
+  static const auto noIsland = std::numeric_limits<IslandId>::max();
+  std::vector<IslandId> rootIslands(nbNodes, noIsland);
+  auto& lowestIdNodes = islands.lowestIdNodes_;
+  islands.labels_.resize(nbNodes);
+  for (std::size_t index = 0; index < nbNodes; ++index) {
+    auto nodeIndex = static_cast<Graph::NodeIndex>(index);
+    auto& island = rootIslands[roots[index]];
+    if (island == noIsland) {
+      island = static_cast<IslandId>(islands.sizes_.size());
+      islands.sizes_.push_back(0);
+      lowestIdNodes.push_back(nodeIndex);
+    } else if (graph.node(nodeIndex)->id < graph.node(lowestIdNodes[island])->id) {
+      lowestIdNodes[island] = nodeIndex;
+    }
+    islands.labels_[index] = island;
+    ++islands.sizes_[island];
+  }
+
+  islands.updateMainIsland(graph);
+  return islands;
+}
+
+void
+Islands::updateMainIsland(const Graph& graph) {
+  mainIsland_ = 0;
+  for (IslandId island = 0; island < sizes_.size(); ++island) {
+    auto mainSize = sizes_[mainIsland_];
+    if (sizes_[island] == 0) {
+      continue;
+    }
+    if (mainSize < sizes_[island] || (mainSize == sizes_[island] && graph.node(lowestIdNodes_[island])->id < graph.node(lowestIdNodes_[mainIsland_])->id)) {
+      mainIsland_ = island;
+    }
+  }
+}
+
+void
+Islands::update(const Graph& graph, Graph::EdgeIndex edge) {
+  const auto node1 = graph.edgeNode1(edge);
+  const auto node2 = graph.edgeNode2(edge);
+  if (graph.isEdgeOpen(edge)) {
+    split(graph, node1, node2);
+  } else {
+    merge(graph, node1, node2);
+  }
+  updateMainIsland(graph);
+}
+
+void
+Islands::merge(const Graph& graph, Graph::NodeIndex node1, Graph::NodeIndex node2) {
+  auto island1 = labels_[node1];
+  auto island2 = labels_[node2];
+  if (island1 == island2) {
+    return;
+  }
+  if (sizes_[island1] < sizes_[island2]) {
+    std::swap(island1, island2);
+    std::swap(node1, node2);
+  }
+
+  // the smallest island is relabelled: its nodes are the ones reached from node2 without leaving the island
+  std::vector<Graph::NodeIndex> toVisit{node2};
+  labels_[node2] = island1;
+  while (!toVisit.empty()) {
+    const auto index = toVisit.back();
+    toVisit.pop_back();
+    const auto neighbours = graph.neighbours(index);
+    const auto edges = graph.incidentEdges(index);
+    for (std::size_t i = 0; i < neighbours.size(); ++i) {
+      if (!graph.isEdgeOpen(edges[i]) && labels_[neighbours[i]] == island2) {
+        labels_[neighbours[i]] = island1;
+        toVisit.push_back(neighbours[i]);
+      }
+    }
+  }
+
+  sizes_[island1] += sizes_[island2];
+  sizes_[island2] = 0;
+  if (graph.node(lowestIdNodes_[island2])->id < graph.node(lowestIdNodes_[island1])->id) {
+    lowestIdNodes_[island1] = lowestIdNodes_[island2];
+  }
+  freeIslands_.push_back(island2);
+}
+
+void
+Islands::split(const Graph& graph, Graph::NodeIndex node1, Graph::NodeIndex node2) {
+  if (node1 == node2) {
+    return;
+  }
+  if (visits_.size() != labels_.size() || visitStamp_ > std::numeric_limits<std::uint32_t>::max() - 2) {
+    visits_.assign(labels_.size(), 0);
+    visitStamp_ = 0;
+  }
+  const std::uint32_t stamps[2] = {visitStamp_ + 1, visitStamp_ + 2};
+  visitStamp_ += 2;
+
+  // breadth-first explorations from both extremities, one node at a time each: the first one to end without meeting the other
+  // has visited the part split from the island
+  std::vector<Graph::NodeIndex> visited[2] = {{node1}, {node2}};
+  std::size_t next[2] = {0, 0};
+  visits_[node1] = stamps[0];
+  visits_[node2] = stamps[1];
+  int splitSide = -1;
+  while (splitSide < 0) {
+    for (int side = 0; side < 2 && splitSide < 0; ++side) {
+      if (next[side] == visited[side].size()) {
+        splitSide = side;
+        break;
+      }
+      const auto index = visited[side][next[side]++];
+      const auto neighbours = graph.neighbours(index);
+      const auto edges = graph.incidentEdges(index);
+      for (std::size_t i = 0; i < neighbours.size(); ++i) {
+        if (graph.isEdgeOpen(edges[i])) {
+          continue;
+        }
+        const auto visit = visits_[neighbours[i]];
+        if (visit == stamps[1 - side]) {
+          // the extremities are still connected
+          return;
+        }
+        if (visit != stamps[side]) {
+          visits_[neighbours[i]] = stamps[side];
+          visited[side].push_back(neighbours[i]);
+        }
+      }
+    }
+  }
+
+  const auto island = labels_[node1];
+  IslandId newIsland;
+  if (freeIslands_.empty()) {
+    newIsland = static_cast<IslandId>(sizes_.size());
+    sizes_.push_back(0);
+    lowestIdNodes_.push_back(0);
+  } else {
+    newIsland = freeIslands_.back();
+    freeIslands_.pop_back();
+  }
+
+  const auto& splitNodes = visited[splitSide];
+  bool lowestIdNodeMoved = false;
+  lowestIdNodes_[newIsland] = splitNodes.front();
+  for (const auto index : splitNodes) {
+    labels_[index] = newIsland;
+    lowestIdNodeMoved = lowestIdNodeMoved || index == lowestIdNodes_[island];
+    if (graph.node(index)->id < graph.node(lowestIdNodes_[newIsland])->id) {
+      lowestIdNodes_[newIsland] = index;
+    }
+  }
+  sizes_[newIsland] = splitNodes.size();
+  sizes_[island] -= splitNodes.size();
+
+  if (lowestIdNodeMoved) {
+    // rare case where the remaining part has lost its node with the lowest id: it is searched among all the nodes
+    bool found = false;
+    for (Graph::NodeIndex index = 0; index < labels_.size(); ++index) {
+      if (labels_[index] == island && (!found || graph.node(index)->id < graph.node(lowestIdNodes_[island])->id)) {
+        lowestIdNodes_[island] = index;
+        found = true;
+      }
+    }
+  }
+}
+
+std::size_t
+Islands::memoryBytes() const {
+  return common::memory::vectorBytes(labels_) + common::memory::vectorBytes(sizes_) + common::memory::vectorBytes(lowestIdNodes_) +
+         common::memory::vectorBytes(freeIslands_) + common::memory::vectorBytes(visits_);
+}
+
+}  // namespace inputs
+}  // namespace dfl
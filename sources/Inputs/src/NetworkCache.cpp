@@ -0,0 +1,173 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NetworkCache.cpp
+ *
+ * @brief Binary cache of the network tree implementation file
+ *
+ */
+
+#include "NetworkCache.h"
+
+#include "Fingerprint.h"
+
+#include <boost/interprocess/exceptions.hpp>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace dfl {
+namespace inputs {
+
+constexpr std::uint32_t NetworkCache::version;
+
+/// @brief Header of a cache file
+struct CacheHeader {
+  char magic[8];              ///< magic string identifying cache files
+  std::uint32_t version;      ///< version of the format
+  std::uint32_t byteOrder;    ///< byte order marker, to reject files written on a machine with another byte order
+  NetworkCache::Key key;      ///< key of the network file
+  std::uint64_t nbStrings;    ///< number of strings in the string table
+  std::uint64_t stringsSize;  ///< size of the string table, in bytes
+  std::uint64_t bodySize;     ///< size of the body, in bytes
+};
+
+/// @brief Magic string at the beginning of cache files
+static const char cacheMagic[8] = {'D', 'F', 'L', 'C', 'A', 'C', 'H', 'E'};
+/// @brief Byte order marker
+static constexpr std::uint32_t cacheByteOrder = 0x01020304;
+
+NetworkCache::Key
+NetworkCache::computeKey(const boost::filesystem::path& networkFilepath) {
+  common::Fingerprint fingerprint;
+  const std::uint64_t size = boost::filesystem::file_size(networkFilepath);
+  if (size > 0) {
+    boost::interprocess::file_mapping file(networkFilepath.c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(file, boost::interprocess::read_only);
+    fingerprint.add(static_cast<const char*>(region.get_address()), region.get_size());
+  }
+  fingerprint.add(size);
+  return fingerprint.value();
+}
+
+boost::filesystem::path
+NetworkCache::cacheFilepath(const boost::filesystem::path& cacheDir, Key key) {
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << key << ".dflcache";
+  boost::filesystem::path filepath(cacheDir);
+  filepath.append(ss.str());
+  return filepath;
+}
+
+void
+NetworkCache::Writer::writeString(const std::string& str) {
+  auto found = positions_.find(str);
+  if (found == positions_.end()) {
+    found = positions_.insert({str, static_cast<std::uint32_t>(strings_.size())}).first;
+    strings_.push_back(str);
+  }
+  write(found->second);
+}
+
+void
+NetworkCache::Writer::save(const boost::filesystem::path& filepath, Key key) const {
+  std::vector<char> strings;
+  for (const auto& str : strings_) {
+    const auto length = static_cast<std::uint32_t>(str.size());
+    strings.insert(strings.end(), reinterpret_cast<const char*>(&length), reinterpret_cast<const char*>(&length) + sizeof(length));
+    strings.insert(strings.end(), str.begin(), str.end());
+  }
+
+  CacheHeader header;
+  std::memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+  header.version = version;
+  header.byteOrder = cacheByteOrder;
+  header.key = key;
+  header.nbStrings = strings_.size();
+  header.stringsSize = strings.size();
+  header.bodySize = body_.size();
+
+  if (filepath.has_parent_path()) {
+    boost::filesystem::create_directories(filepath.parent_path());
+  }
+  boost::filesystem::path temporaryFilepath(filepath.generic_string() + "." + boost::filesystem::unique_path().generic_string());
+  {
+    std::ofstream file(temporaryFilepath.generic_string(), std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(strings.data(), strings.size());
+    file.write(body_.data(), body_.size());
+    if (!file) {
+      throw std::runtime_error("Cannot write network cache file " + temporaryFilepath.generic_string());
+    }
+  }
+  boost::filesystem::rename(temporaryFilepath, filepath);
+}
+
+NetworkCache::Reader::Reader(const boost::filesystem::path& filepath, Key key) : region_{}, current_{nullptr}, end_{nullptr}, symbols_{} {
+  boost::system::error_code error;
+  const auto size = boost::filesystem::file_size(filepath, error);
+  if (error || size < sizeof(CacheHeader)) {
+    return;
+  }
+
+  try {
+    boost::interprocess::file_mapping file(filepath.c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(file, boost::interprocess::read_only);
+    region_.swap(region);
+  } catch (const boost::interprocess::interprocess_exception&) {
+    return;
+  }
+
+  const char* begin = static_cast<const char*>(region_.get_address());
+  CacheHeader header;
+  std::memcpy(&header, begin, sizeof(header));
+  if (std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0 || header.version != version || header.byteOrder != cacheByteOrder ||
+      header.key != key || sizeof(header) + header.stringsSize + header.bodySize != region_.get_size()) {
+    return;
+  }
+
+  current_ = begin + sizeof(header);
+  end_ = current_ + header.stringsSize;
+  try {
+    symbols_.reserve(header.nbStrings);
+    for (std::uint64_t i = 0; i < header.nbStrings; ++i) {
+      const auto length = read<std::uint32_t>();
+      const char* str = advance(length);
+      symbols_.emplace_back(std::string(str, length));
+    }
+  } catch (const std::runtime_error&) {
+    current_ = nullptr;
+    return;
+  }
+  end_ = current_ + header.bodySize;
+}
+
+const common::Symbol&
+NetworkCache::Reader::readSymbol() {
+  const auto position = read<std::uint32_t>();
+  if (position >= symbols_.size()) {
+    throw std::runtime_error("Invalid string in network cache file");
+  }
+  return symbols_[position];
+}
+
+const char*
+NetworkCache::Reader::advance(std::size_t size) {
+  if (current_ == nullptr || static_cast<std::size_t>(end_ - current_) < size) {
+    throw std::runtime_error("Unexpected end of network cache file");
+  }
+  const char* position = current_;
+  current_ += size;
+  return position;
+}
+
+}  // namespace inputs
+}  // namespace dfl
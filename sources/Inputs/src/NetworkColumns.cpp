@@ -0,0 +1,330 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NetworkColumns.cpp
+ *
+ * @brief Columnar extract of the network data interface implementation file
+ *
+ */
+
+#include "NetworkColumns.h"
+
+#include "SymbolIndex.h"
+
+#include <DYNBusInterface.h>
+#include <DYNLineInterface.h>
+#include <DYNLoadInterface.h>
+#include <DYNShuntCompensatorInterface.h>
+#include <DYNSwitchInterface.h>
+#include <DYNThreeWTransformerInterface.h>
+#include <DYNTwoWTransformerInterface.h>
+#include <DYNVoltageLevelInterface.h>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace dfl {
+namespace inputs {
+
+constexpr NetworkColumns::BusIndex NetworkColumns::noBus;
+
+/**
+ * @brief Resolution of bus interfaces into positions in the bus columns
+ *
+ * Buses are found by the address of their interface, the data interface sharing the bus objects between the voltage levels and their elements.
+ * A bus interface not found by address is found by its id, so that the resolution does not rely on this sharing.
+ */
+class BusResolver {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param scope the description of the buses, for the error messages
+   * @param nbBuses the number of buses expected
+   */
+  BusResolver(const std::string& scope, std::size_t nbBuses) : scope_(scope) {
+    byAddress_.reserve(nbBuses);
+    byId_.reserve(nbBuses);
+  }
+
+  /**
+   * @brief Add a bus
+   *
+   * @param bus the bus interface
+   * @param id the id of the bus
+   * @param index the position of the bus in the bus columns
+   */
+  void add(const DYN::BusInterface* bus, const common::Symbol& id, NetworkColumns::BusIndex index) {
+    byAddress_.emplace(bus, index);
+    byId_.insert(id, index);
+  }
+
+  /**
+   * @brief Find a bus interface
+   *
+   * @param bus the bus interface, possibly null
+   * @returns the position of the bus in the bus columns, or noBus if the bus was not added
+   */
+  NetworkColumns::BusIndex find(const boost::shared_ptr<DYN::BusInterface>& bus) const {
+    if (!bus) {
+      return NetworkColumns::noBus;
+    }
+    auto found = byAddress_.find(bus.get());
+    if (found != byAddress_.end()) {
+      return found->second;
+    }
+    const auto position = byId_.find(bus->getID());
+    return (position == common::SymbolIndex::npos) ? NetworkColumns::noBus : position;
+  }
+
+  /**
+   * @brief Resolve a bus interface
+   *
+   * @param bus the bus interface
+   * @returns the position of the bus in the bus columns
+   * @throws std::out_of_range if the bus was not added
+   */
+  NetworkColumns::BusIndex resolve(const boost::shared_ptr<DYN::BusInterface>& bus) const {
+    const auto index = find(bus);
+    if (index == NetworkColumns::noBus) {
+      throw std::out_of_range("Node " + (bus ? bus->getID() : std::string("<none>")) + " not found in " + scope_);
+    }
+    return index;
+  }
+
+ private:
+  const std::string scope_;                                                          ///< description of the buses
+  std::unordered_map<const DYN::BusInterface*, NetworkColumns::BusIndex> byAddress_;  ///< positions of the buses by address of their interface
+  common::SymbolIndex byId_;                                                         ///< positions of the buses by id
+};
+
+/**
+ * @brief Size the columns of an element category of the voltage levels from their offsets
+ *
+ * @param offsets the offsets of the category, holding the number of elements of each voltage level
+ * @returns the number of elements of the category
+ */
+static std::size_t
+accumulateOffsets(std::vector<std::uint32_t>& offsets) {
+  std::uint32_t total = 0;
+  for (auto& offset : offsets) {
+    const auto count = offset;
+    offset = total;
+    total += count;
+  }
+  return total;
+}
+
+/**
+ * @brief Extract the columns of the elements of a voltage level
+ *
+ * Only writes in the ranges of the voltage level
+ *
+ * @param networkVL the voltage level in the data interface
+ * @param vl the position of the voltage level
+ * @param columns the columns to fill, already sized
+ * @param busInterfaces the interfaces of the buses, by position in the bus columns, to fill
+ */
+static void
+extractVoltageLevel(DYN::VoltageLevelInterface& networkVL, std::size_t vl, NetworkColumns& columns, std::vector<const DYN::BusInterface*>& busInterfaces) {
+  columns.voltageLevels.ids[vl] = networkVL.getID();
+  columns.voltageLevels.nominalVoltages[vl] = networkVL.getVNom();
+  const bool isNodeBreaker = networkVL.getVoltageLevelTopologyKind() == DYN::VoltageLevelInterface::NODE_BREAKER;
+  columns.voltageLevels.isNodeBreaker[vl] = isNodeBreaker;
+
+  // by construction, the elements of a voltage level are connected to the buses of this voltage level
+  const auto& buses = networkVL.getBuses();
+  BusResolver resolver("voltage level " + columns.voltageLevels.ids[vl].str(), buses.size());
+  auto busIndex = columns.buses.offsets[vl];
+  for (const auto& bus : buses) {
+    columns.buses.ids[busIndex] = bus->getID();
+    busInterfaces[busIndex] = bus.get();
+    resolver.add(bus.get(), columns.buses.ids[busIndex], busIndex);
+    ++busIndex;
+  }
+
+  auto& loads = columns.loads;
+  auto loadIndex = loads.offsets[vl];
+  for (const auto& load : networkVL.getLoads()) {
+    loads.connected[loadIndex] = load->getInitialConnected();
+    if (loads.connected[loadIndex]) {
+      loads.ids[loadIndex] = load->getID();
+      loads.buses[loadIndex] = resolver.resolve(load->getBusInterface());
+      loads.activePowers[loadIndex] = load->getP0();
+    }
+    ++loadIndex;
+  }
+
+  auto& shunts = columns.shunts;
+  auto shuntIndex = shunts.offsets[vl];
+  for (const auto& shunt : networkVL.getShuntCompensators()) {
+    shunts.ids[shuntIndex] = shunt->getID();
+    // a shunt whose bus is not known is kept without bus, and not attached to a node
+    shunts.buses[shuntIndex] = resolver.find(shunt->getBusInterface());
+    ++shuntIndex;
+  }
+
+  auto& switches = columns.switches;
+  auto switchIndex = switches.offsets[vl];
+  for (const auto& sw : networkVL.getSwitches()) {
+    switches.ids[switchIndex] = sw->getID();
+    switches.buses1[switchIndex] = resolver.resolve(sw->getBusInterface1());
+    switches.buses2[switchIndex] = resolver.resolve(sw->getBusInterface2());
+    switches.open[switchIndex] = sw->isOpen();
+    ++switchIndex;
+  }
+
+  auto& generators = columns.generators;
+  auto generatorIndex = generators.offsets[vl];
+  for (const auto& generator : networkVL.getGenerators()) {
+    generators.connected[generatorIndex] = generator->getInitialConnected();
+    if (generators.connected[generatorIndex]) {
+      generators.buses[generatorIndex] = resolver.resolve(generator->getBusInterface());
+      generators.interfaces[generatorIndex] = generator;
+    }
+    ++generatorIndex;
+  }
+
+  auto& svarcs = columns.svarcs;
+  auto svarcIndex = svarcs.offsets[vl];
+  for (const auto& svarc : networkVL.getStaticVarCompensators()) {
+    svarcs.connected[svarcIndex] = svarc->getInitialConnected();
+    if (svarcs.connected[svarcIndex]) {
+      svarcs.buses[svarcIndex] = resolver.resolve(svarc->getBusInterface());
+      svarcs.interfaces[svarcIndex] = svarc;
+    }
+    ++svarcIndex;
+  }
+}
+
+/**
+ * @brief Size the columns of the lines or of the two windings transformers
+ *
+ * @param branches the columns to size
+ * @param nbBranches the number of branches
+ */
+static void
+resizeBranches(NetworkColumns::Branches& branches, std::size_t nbBranches) {
+  branches.connected.resize(nbBranches);
+  branches.ids.resize(nbBranches);
+  branches.buses1.resize(nbBranches, NetworkColumns::noBus);
+  branches.buses2.resize(nbBranches, NetworkColumns::noBus);
+}
+
+NetworkColumns
+NetworkColumns::extract(const DYN::NetworkInterface& network) {
+  NetworkColumns columns;
+  const auto& voltageLevels = network.getVoltageLevels();
+  const std::size_t nbVoltageLevels = voltageLevels.size();
+
+  // element counts of the voltage levels, turned into offsets so that each voltage level fills its own ranges
+  columns.buses.offsets.resize(nbVoltageLevels + 1, 0);
+  columns.loads.offsets.resize(nbVoltageLevels + 1, 0);
+  columns.shunts.offsets.resize(nbVoltageLevels + 1, 0);
+  columns.switches.offsets.resize(nbVoltageLevels + 1, 0);
+  columns.generators.offsets.resize(nbVoltageLevels + 1, 0);
+  columns.svarcs.offsets.resize(nbVoltageLevels + 1, 0);
+  for (std::size_t vl = 0; vl < nbVoltageLevels; ++vl) {
+    const auto& networkVL = voltageLevels[vl];
+    columns.buses.offsets[vl] = static_cast<std::uint32_t>(networkVL->getBuses().size());
+    columns.loads.offsets[vl] = static_cast<std::uint32_t>(networkVL->getLoads().size());
+    columns.shunts.offsets[vl] = static_cast<std::uint32_t>(networkVL->getShuntCompensators().size());
+    columns.switches.offsets[vl] = static_cast<std::uint32_t>(networkVL->getSwitches().size());
+    columns.generators.offsets[vl] = static_cast<std::uint32_t>(networkVL->getGenerators().size());
+    columns.svarcs.offsets[vl] = static_cast<std::uint32_t>(networkVL->getStaticVarCompensators().size());
+  }
+
+  columns.voltageLevels.ids.resize(nbVoltageLevels);
+  columns.voltageLevels.nominalVoltages.resize(nbVoltageLevels);
+  columns.voltageLevels.isNodeBreaker.resize(nbVoltageLevels);
+  const auto nbBuses = accumulateOffsets(columns.buses.offsets);
+  columns.buses.ids.resize(nbBuses);
+  const auto nbLoads = accumulateOffsets(columns.loads.offsets);
+  columns.loads.connected.resize(nbLoads);
+  columns.loads.ids.resize(nbLoads);
+  columns.loads.buses.resize(nbLoads, noBus);
+  columns.loads.activePowers.resize(nbLoads, 0.);
+  const auto nbShunts = accumulateOffsets(columns.shunts.offsets);
+  columns.shunts.ids.resize(nbShunts);
+  columns.shunts.buses.resize(nbShunts);
+  const auto nbSwitches = accumulateOffsets(columns.switches.offsets);
+  columns.switches.ids.resize(nbSwitches);
+  columns.switches.buses1.resize(nbSwitches);
+  columns.switches.buses2.resize(nbSwitches);
+  columns.switches.open.resize(nbSwitches);
+  const auto nbGenerators = accumulateOffsets(columns.generators.offsets);
+  columns.generators.connected.resize(nbGenerators);
+  columns.generators.buses.resize(nbGenerators, noBus);
+  columns.generators.interfaces.resize(nbGenerators);
+  const auto nbSvarcs = accumulateOffsets(columns.svarcs.offsets);
+  columns.svarcs.connected.resize(nbSvarcs);
+  columns.svarcs.buses.resize(nbSvarcs, noBus);
+  columns.svarcs.interfaces.resize(nbSvarcs);
+
+  std::vector<const DYN::BusInterface*> busInterfaces(nbBuses);
+  for (std::size_t vl = 0; vl < nbVoltageLevels; ++vl) {
+    extractVoltageLevel(*voltageLevels[vl], vl, columns, busInterfaces);
+  }
+
+  // lines and transformers connect buses of different voltage levels
+  BusResolver resolver("network", nbBuses);
+  for (std::size_t bus = 0; bus < nbBuses; ++bus) {
+    resolver.add(busInterfaces[bus], columns.buses.ids[bus], static_cast<BusIndex>(bus));
+  }
+
+  const auto& lines = network.getLines();
+  resizeBranches(columns.lines, lines.size());
+  columns.lines.seasons.resize(lines.size());
+  for (std::size_t i = 0; i < lines.size(); ++i) {
+    const auto& line = lines[i];
+    columns.lines.connected[i] = line->getInitialConnected1() && line->getInitialConnected2();
+    if (columns.lines.connected[i]) {
+      columns.lines.ids[i] = line->getID();
+      columns.lines.buses1[i] = resolver.resolve(line->getBusInterface1());
+      columns.lines.buses2[i] = resolver.resolve(line->getBusInterface2());
+      columns.lines.seasons[i] = line->getActiveSeason();
+    }
+  }
+
+  const auto& transfos = network.getTwoWTransformers();
+  resizeBranches(columns.twoWTransformers, transfos.size());
+  for (std::size_t i = 0; i < transfos.size(); ++i) {
+    const auto& transfo = transfos[i];
+    columns.twoWTransformers.connected[i] = transfo->getInitialConnected1() && transfo->getInitialConnected2();
+    if (columns.twoWTransformers.connected[i]) {
+      columns.twoWTransformers.ids[i] = transfo->getID();
+      columns.twoWTransformers.buses1[i] = resolver.resolve(transfo->getBusInterface1());
+      columns.twoWTransformers.buses2[i] = resolver.resolve(transfo->getBusInterface2());
+    }
+  }
+
+  const auto& transfosThree = network.getThreeWTransformers();
+  auto& threeWTransformers = columns.threeWTransformers;
+  threeWTransformers.connected.resize(transfosThree.size());
+  threeWTransformers.ids.resize(transfosThree.size());
+  threeWTransformers.buses1.resize(transfosThree.size(), noBus);
+  threeWTransformers.buses2.resize(transfosThree.size(), noBus);
+  threeWTransformers.buses3.resize(transfosThree.size(), noBus);
+  for (std::size_t i = 0; i < transfosThree.size(); ++i) {
+    const auto& transfo = transfosThree[i];
+    threeWTransformers.connected[i] = transfo->getInitialConnected1() && transfo->getInitialConnected2() && transfo->getInitialConnected3();
+    if (threeWTransformers.connected[i]) {
+      threeWTransformers.ids[i] = transfo->getID();
+      threeWTransformers.buses1[i] = resolver.resolve(transfo->getBusInterface1());
+      threeWTransformers.buses2[i] = resolver.resolve(transfo->getBusInterface2());
+      threeWTransformers.buses3[i] = resolver.resolve(transfo->getBusInterface3());
+    }
+  }
+
+  return columns;
+}
+
+}  // namespace inputs
+}  // namespace dfl
@@ -17,8 +17,11 @@
 
 #include "NetworkManager.h"
 
+#include "DecompressedFile.h"
 #include "Log.h"
 #include "Message.hpp"
+#include "NetworkColumns.h"
+#include "Parallel.h"
 
 #include <DYNBusInterface.h>
 #include <DYNCommon.h>
@@ -27,225 +30,790 @@
 #include <DYNGeneratorInterface.h>
 #include <DYNHvdcLineInterface.h>
 #include <DYNLccConverterInterface.h>
-#include <DYNLineInterface.h>
-#include <DYNLoadInterface.h>
 #include <DYNNetworkInterface.h>
-#include <DYNShuntCompensatorInterface.h>
 #include <DYNStaticVarCompensatorInterface.h>
-#include <DYNSwitchInterface.h>
-#include <DYNThreeWTransformerInterface.h>
-#include <DYNTwoWTransformerInterface.h>
-#include <DYNVoltageLevelInterface.h>
 #include <DYNVscConverterInterface.h>
+#include <algorithm>
 #include <boost/make_shared.hpp>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_set>
 
 namespace dfl {
 namespace inputs {
 
-NetworkManager::NetworkManager(const boost::filesystem::path& filepath) :
-    interface_(DYN::DataInterfaceFactory::build(DYN::DataInterfaceFactory::DATAINTERFACE_IIDM, filepath.generic_string())),
+/**
+ * @brief Service manager answering from the node tree of a network manager
+ */
+class TopologyServiceManager : public DYN::ServiceManagerInterface {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param manager the network manager, to retrieve its data interface
+   * @param graph the topological graph of the network manager
+   * @param nodesIndex the positions of the nodes in the graph by node id
+   */
+  TopologyServiceManager(const NetworkManager& manager, const Graph& graph, const common::SymbolIndex& nodesIndex) :
+      manager_(manager),
+      graph_(graph),
+      nodesIndex_(nodesIndex) {}
+
+  /**
+   * @brief Retrieve the buses connected to a bus by closed switches
+   *
+   * @param busId the bus id
+   * @param VLId the id of the voltage level of the bus
+   * @returns the ids of the buses connected to the bus, without the bus itself
+   */
+  std::vector<std::string> getBusesConnectedBySwitch(const std::string& busId, const std::string& VLId) const final {
+    std::vector<std::string> buses;
+    const auto start = nodesIndex_.find(busId);
+    if (start == common::SymbolIndex::npos || graph_.node(start)->voltageLevel->id.str() != VLId) {
+      return buses;
+    }
+
+    std::unordered_set<Graph::NodeIndex> visited{start};
+    std::vector<Graph::NodeIndex> toVisit{start};
+    while (!toVisit.empty()) {
+      const auto index = toVisit.back();
+      toVisit.pop_back();
+      const auto neighbours = graph_.neighbours(index);
+      const auto edges = graph_.incidentEdges(index);
+      for (std::size_t i = 0; i < neighbours.size(); ++i) {
+        if (graph_.edgeType(edges[i]) == Graph::EdgeType::SWITCH && !graph_.isEdgeOpen(edges[i]) && visited.insert(neighbours[i]).second) {
+          toVisit.push_back(neighbours[i]);
+          buses.push_back(graph_.node(neighbours[i])->id.str());
+        }
+      }
+    }
+    return buses;
+  }
+
+  /**
+   * @brief Retrieve the bus regulated by a component, from the data interface
+   *
+   * @param regulatingComponent the id of the regulating component
+   * @returns the regulated bus
+   */
+  boost::shared_ptr<DYN::BusInterface> getRegulatedBus(const std::string& regulatingComponent) const final {
+    return manager_.dataInterface()->getServiceManager()->getRegulatedBus(regulatingComponent);
+  }
+
+ private:
+  const NetworkManager& manager_;          ///< network manager
+  const Graph& graph_;                     ///< topological graph
+  const common::SymbolIndex& nodesIndex_;  ///< positions of the nodes by id
+};
+
+/**
+ * @brief Remove an element from a list of elements by its id
+ *
+ * @param elements the list of elements
+ * @param id the id of the element to remove
+ * @returns @b true if the element was found, @b false if not
+ */
+template<class T, std::size_t N>
+static bool
+removeById(common::SmallVector<T, N>& elements, const common::Symbol& id) {
+  auto found = std::find_if(elements.begin(), elements.end(), [&id](const T& element) { return element.id == id; });
+  if (found == elements.end()) {
+    return false;
+  }
+  elements.erase(found);
+  return true;
+}
+
+/**
+ * @brief Move the elements satisfying a predicate out of a list of elements
+ *
+ * @param elements the list of elements, keeping the other elements in their order
+ * @param predicate the predicate
+ * @returns the elements satisfying the predicate, in their order
+ */
+template<class T, class Predicate>
+static std::vector<T>
+takeIf(std::vector<T>& elements, const Predicate& predicate) {
+  auto first = std::stable_partition(elements.begin(), elements.end(), [&predicate](const T& element) { return !predicate(element); });
+  std::vector<T> taken(std::make_move_iterator(first), std::make_move_iterator(elements.end()));
+  elements.erase(first, elements.end());
+  return taken;
+}
+
+/**
+ * @brief Merge the buses of a node-breaker voltage level connected by closed switches
+ *
+ * The buses at the extremities of the closed switches, retained or not, are merged with a union-find, by size and with path halving,
+ * in a time linear in practice in the number of buses and switches. The data interface has no accessor for the internal connections:
+ * it either gives them as closed switches, merged the same way, or already groups the nodes they connect into a single bus.
+ *
+ * @param columns the columns of the network
+ * @param vl the position of the voltage level
+ * @returns for each bus of the voltage level, the position in the voltage level of the first bus of its merged set
+ */
+static std::vector<std::size_t>
+mergeNodeBreakerBuses(const NetworkColumns& columns, std::size_t vl) {
+  const std::size_t firstBus = columns.buses.offsets[vl];
+  const std::size_t nbBuses = columns.buses.offsets[vl + 1] - firstBus;
+  std::vector<std::size_t> parents(nbBuses);
+  std::iota(parents.begin(), parents.end(), 0);
+  std::vector<std::size_t> sizes(nbBuses, 1);
+  auto findRoot = [&parents](std::size_t bus) {
+    while (parents[bus] != bus) {
+      parents[bus] = parents[parents[bus]];
+      bus = parents[bus];
+    }
+    return bus;
+  };
+
+  const auto& switches = columns.switches;
+  for (auto sw = switches.offsets[vl]; sw < switches.offsets[vl + 1]; ++sw) {
+    if (switches.open[sw]) {
+      continue;
+    }
+    auto root1 = findRoot(switches.buses1[sw] - firstBus);
+    auto root2 = findRoot(switches.buses2[sw] - firstBus);
+    if (root1 == root2) {
+      continue;
+    }
+    if (sizes[root1] < sizes[root2]) {
+      std::swap(root1, root2);
+    }
+    parents[root2] = root1;
+    sizes[root1] += sizes[root2];
+  }
+
+  // each set is represented by its first bus, so that the merged node does not depend on the order of the switches
+  std::vector<std::size_t> firstBuses(nbBuses, nbBuses);
+  std::vector<std::size_t> busFirstBuses(nbBuses);
+  for (std::size_t bus = 0; bus < nbBuses; ++bus) {
+    auto& first = firstBuses[findRoot(bus)];
+    if (first == nbBuses) {
+      first = bus;
+    }
+    busFirstBuses[bus] = first;
+  }
+  return busFirstBuses;
+}
+
+/**
+ * @brief Write reactive curve points in a cache file
+ *
+ * @param writer the cache file writer
+ * @param points the points to write
+ */
+static void
+writePoints(NetworkCache::Writer& writer, const ReactiveCurveStore::Points& points) {
+  writer.write(static_cast<std::uint32_t>(points.size()));
+  for (const auto& point : points) {
+    writer.write(point.p);
+    writer.write(point.qmin);
+    writer.write(point.qmax);
+  }
+}
+
+/**
+ * @brief Read reactive curve points from a cache file
+ *
+ * @param reader the cache file reader
+ * @returns the points read
+ */
+static std::vector<ReactiveCurveStore::ReactiveCurvePoint>
+readPoints(NetworkCache::Reader& reader) {
+  std::vector<ReactiveCurveStore::ReactiveCurvePoint> points;
+  const auto nbPoints = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbPoints; ++i) {
+    const auto p = reader.read<double>();
+    const auto qmin = reader.read<double>();
+    const auto qmax = reader.read<double>();
+    points.emplace_back(p, qmin, qmax);
+  }
+  return points;
+}
+
+/**
+ * @brief Part of the main island split by an outage, as positions of its nodes in the depth-first order of the bridges
+ *
+ * The part is a range of positions, without the subtrees of some of its nodes, which are ranges of positions too
+ */
+struct SplitPart {
+  std::size_t first;                                          ///< position of the first node of the range
+  std::size_t last;                                           ///< position past the last node of the range
+  std::vector<std::pair<std::size_t, std::size_t>> excluded;  ///< ranges of the subtrees excluded from the range
+};
+
+/**
+ * @brief Sum a value over the nodes of a split part
+ *
+ * @param prefixSums the sums of the value over the first nodes in depth-first order, of size the number of nodes + 1
+ * @param part the split part
+ * @returns the sum of the value over the nodes of the part
+ */
+template<class T>
+static T
+sumOver(const std::vector<T>& prefixSums, const SplitPart& part) {
+  T sum = prefixSums[part.last] - prefixSums[part.first];
+  for (const auto& range : part.excluded) {
+    sum -= prefixSums[range.second] - prefixSums[range.first];
+  }
+  return sum;
+}
+
+/**
+ * @brief Find the node with the lowest id of a split part
+ *
+ * The nodes of the part are scanned: this is only needed when two parts have the same number of nodes
+ *
+ * @param graph the graph of the bridges, whose fictitious nodes are skipped
+ * @param bridges the bridges of the graph
+ * @param part the split part
+ * @returns the node with the lowest id, null if the part has no node
+ */
+static const Node*
+lowestIdNode(const Graph& graph, const Bridges& bridges, const SplitPart& part) {
+  const Node* lowest = nullptr;
+  for (auto position = part.first; position < part.last; ++position) {
+    auto isExcluded = [position](const std::pair<std::size_t, std::size_t>& range) { return range.first <= position && position < range.second; };
+    const auto& node = graph.node(bridges.orderedNodes()[position]);
+    if (!node || std::any_of(part.excluded.begin(), part.excluded.end(), isExcluded)) {
+      continue;
+    }
+    if (!lowest || node->id < lowest->id) {
+      lowest = node.get();
+    }
+  }
+  return lowest;
+}
+
+NetworkManager::NetworkManager(const boost::filesystem::path& filepath, unsigned int nbThreads, const boost::filesystem::path& cacheDir) :
+    filepath_{filepath},
+    nbThreads_{nbThreads},
+    interface_{},
+    loadedFromCache_{false},
+    arena_(std::make_shared<common::Arena>()),
     slackNode_{},
     nodes_{},
-    nodesCallbacks_{} {
+    nodesIndex_{},
+    nodeAliases_{} {
+  if (cacheDir.empty()) {
+    buildTree();
+    return;
+  }
+
+  const auto key = NetworkCache::computeKey(filepath_);
+  const auto cacheFilepath = NetworkCache::cacheFilepath(cacheDir, key);
+  NetworkCache::Reader reader(cacheFilepath, key);
+  if (reader.isValid()) {
+    try {
+      loadCache(reader);
+      loadedFromCache_ = true;
+      LOG(info) << MESS(NetworkCacheLoaded, filepath_.generic_string(), cacheFilepath.generic_string()) << LOG_ENDL;
+      return;
+    } catch (const std::exception& e) {
+      LOG(warn) << MESS(NetworkCacheInvalid, cacheFilepath.generic_string(), e.what()) << LOG_ENDL;
+      clearTree();
+    }
+  }
+
   buildTree();
+  // the cache does not depend on the islands: it contains the equipment of all of them, the regulations outside the main island staying pending
+  extractEquipment(true);
+  try {
+    saveCache(cacheFilepath, key);
+  } catch (const std::exception& e) {
+    LOG(warn) << MESS(NetworkCacheNotWritten, cacheFilepath.generic_string(), e.what()) << LOG_ENDL;
+  }
+}
+
+boost::shared_ptr<DYN::DataInterface>
+NetworkManager::dataInterface() const {
+  if (!interface_) {
+    // compressed network files are decompressed while the parser reads them, through a named pipe, without any decompressed copy on disk
+    DecompressedFile file(filepath_);
+    try {
+      interface_ = DYN::DataInterfaceFactory::build(DYN::DataInterfaceFactory::DATAINTERFACE_IIDM, file.filepath().generic_string());
+    } catch (...) {
+      // the decompression error, if any, explains the parsing error
+      file.close();
+      throw;
+    }
+    file.close();
+  }
+  return interface_;
+}
+
+boost::shared_ptr<DYN::ServiceManagerInterface>
+NetworkManager::serviceManager() const {
+  return boost::make_shared<TopologyServiceManager>(*this, graph_, nodesIndex_);
 }
 
 auto
-NetworkManager::updateMapRegulatingBuses(BusMapRegulating& map, const std::string& elementId, const boost::shared_ptr<DYN::DataInterface>& dataInterface)
-    -> BusId {
-  auto regulatedBus = dataInterface->getServiceManager()->getRegulatedBus(elementId)->getID();
+NetworkManager::resolveRegulatedBuses(const std::vector<std::string>& elementIds) const -> std::vector<BusId> {
+  // the service manager is retrieved once for all the elements. It builds its topology caches lazily: it is called from a single thread
+  auto serviceManager = dataInterface()->getServiceManager();
+  std::vector<BusId> regulatedBuses;
+  regulatedBuses.reserve(elementIds.size());
+  for (const auto& elementId : elementIds) {
+    regulatedBuses.push_back(serviceManager->getRegulatedBus(elementId)->getID());
+  }
+  // buses merged into another node are regulated through this node
+  for (auto& regulatedBus : regulatedBuses) {
+    const auto position = nodesIndex_.find(regulatedBus);
+    if (position != common::SymbolIndex::npos) {
+      regulatedBus = nodes_[position]->id;
+    }
+  }
+  return regulatedBuses;
+}
+
+void
+NetworkManager::updateMapRegulatingBuses(BusMapRegulating& map, const BusId& regulatedBus) {
   auto it = map.find(regulatedBus);
   if (it == map.end()) {
     map.insert({regulatedBus, NbOfRegulating::ONE});
   } else {
     it->second = NbOfRegulating::MULTIPLES;
   }
-  return regulatedBus;
+}
+
+const std::shared_ptr<Node>&
+NetworkManager::findNode(const Node::NodeId& nodeId) const {
+  auto position = nodesIndex_.find(nodeId);
+  if (position == common::SymbolIndex::npos) {
+    throw std::out_of_range("Node " + nodeId.str() + " not found in network");
+  }
+  return nodes_[position];
+}
+
+void
+NetworkManager::extractVoltageLevel(const NetworkColumns& columns, std::size_t vl, const std::shared_ptr<common::Arena>& arena, VoltageLevelExtract& extract) {
+  extract.voltageLevel = common::makeShared<VoltageLevel>(arena, columns.voltageLevels.ids[vl]);
+
+  const std::size_t firstBus = columns.buses.offsets[vl];
+  const std::size_t nbBuses = columns.buses.offsets[vl + 1] - firstBus;
+  extract.nodes.reserve(nbBuses);
+  std::vector<std::size_t> firstBuses(nbBuses);
+  std::iota(firstBuses.begin(), firstBuses.end(), 0);
+  if (columns.voltageLevels.isNodeBreaker[vl]) {
+    firstBuses = mergeNodeBreakerBuses(columns, vl);
+  }
+
+  // shunts of the merged buses are gathered on the node of the first bus
+  std::vector<std::vector<Shunt>> busesShunts(nbBuses);
+  const auto& shunts = columns.shunts;
+  for (auto shunt = shunts.offsets[vl]; shunt < shunts.offsets[vl + 1]; ++shunt) {
+    if (shunts.buses[shunt] != NetworkColumns::noBus) {
+      busesShunts[firstBuses[shunts.buses[shunt] - firstBus]].emplace_back(shunts.ids[shunt]);
+    }
+  }
+
+  extract.busNodes.resize(nbBuses);
+  for (std::size_t bus = 0; bus < nbBuses; ++bus) {
+    const auto& nodeId = columns.buses.ids[firstBus + bus];
+    if (firstBuses[bus] == bus) {
+      extract.busNodes[bus] = extract.nodes.size();
+      extract.nodes.push_back(Node::build(nodeId, extract.voltageLevel, columns.voltageLevels.nominalVoltages[vl], busesShunts[bus], arena));
+    } else {
+      extract.busNodes[bus] = extract.busNodes[firstBuses[bus]];
+      extract.aliases.emplace_back(nodeId, extract.busNodes[bus]);
+      LOG(debug) << "Node " << nodeId << " merged into node " << extract.nodes[extract.busNodes[bus]]->id << LOG_ENDL;
+    }
+  }
+  auto nodePosition = [&extract, firstBus](NetworkColumns::BusIndex bus) { return extract.busNodes[bus - firstBus]; };
+
+  const auto& loads = columns.loads;
+  for (auto load = loads.offsets[vl]; load < loads.offsets[vl + 1]; ++load) {
+    // if load is not connected, it is ignored
+    if (!loads.connected[load])
+      continue;
+    const auto& node = extract.nodes[nodePosition(loads.buses[load])];
+    node->loads.emplace_back(loads.ids[load], loads.activePowers[load]);
+    LOG(debug) << "Node " << node->id << " contains load " << loads.ids[load] << LOG_ENDL;
+  }
+
+  const auto& generators = columns.generators;
+  for (auto generator = generators.offsets[vl]; generator < generators.offsets[vl + 1]; ++generator) {
+    // if generator is not connected, it is ignored
+    if (!generators.connected[generator])
+      continue;
+    // the generator is added to its node once its island is known, if it regulates the voltage
+    extract.generators.emplace_back(nodePosition(generators.buses[generator]), generators.interfaces[generator]);
+  }
+
+  const auto& switches = columns.switches;
+  for (auto sw = switches.offsets[vl]; sw < switches.offsets[vl + 1]; ++sw) {
+    // open switches are kept, as open edges of the graph, so that they can be closed afterwards
+    const auto node1 = nodePosition(switches.buses1[sw]);
+    const auto node2 = nodePosition(switches.buses2[sw]);
+    if (node1 == node2) {
+      // closed switch of a node-breaker voltage level, or open switch in parallel with a closed one: it does not connect distinct nodes
+      continue;
+    }
+    extract.switches.push_back({switches.ids[sw], node1, node2, static_cast<bool>(switches.open[sw])});
+    if (!switches.open[sw]) {
+      LOG(debug) << "Node " << extract.nodes[node1]->id << " connected to " << extract.nodes[node2]->id << " by switch " << switches.ids[sw] << LOG_ENDL;
+    }
+  }
+
+  const auto& svarcs = columns.svarcs;
+  for (auto svarc = svarcs.offsets[vl]; svarc < svarcs.offsets[vl + 1]; ++svarc) {
+    if (!svarcs.connected[svarc]) {
+      continue;
+    }
+    // the extensions of the static var compensator are read once its island is known
+    extract.svarcs.emplace_back(nodePosition(svarcs.buses[svarc]), svarcs.interfaces[svarc]);
+  }
 }
 
 void
 NetworkManager::buildTree() {
-  auto network = interface_->getNetwork();
+  auto network = dataInterface()->getNetwork();
 
   auto opt_id = network->getSlackNodeBusId();
+  Graph::Builder builder;
+
+  // the data interface is read once, in columns, and the node tree is built from the columns without calling it again
+  const auto extractionStart = std::chrono::steady_clock::now();
+  const auto columns = NetworkColumns::extract(*network);
+  const auto buildStart = std::chrono::steady_clock::now();
 
-  const auto& voltageLevels = network->getVoltageLevels();
-  for (const auto& networkVL : voltageLevels) {
-    const auto& shunts = networkVL->getShuntCompensators();
-    std::unordered_map<Node::NodeId, std::vector<Shunt>> shuntsMap;
-    for (const auto& shunt : shunts) {
-      // We take into account even disconnected shunts as dynamic models may aim to connect them
-      (shuntsMap[shunt->getBusInterface()->getID()]).push_back(std::move(Shunt(shunt->getID())));
+  // voltage levels are independent from each other: they are split into contiguous chunks built in parallel, each chunk using its own arena
+  const std::size_t nbVoltageLevels = columns.nbVoltageLevels();
+  const std::size_t nbChunks = std::max<std::size_t>(1, std::min<std::size_t>(nbThreads_, nbVoltageLevels));
+  std::vector<std::shared_ptr<common::Arena>> arenas(nbChunks);
+  arenas.front() = arena_;
+  std::vector<VoltageLevelExtract> extracts(nbVoltageLevels);
+  common::parallelFor(nbChunks, nbThreads_, [&columns, &arenas, &extracts, nbChunks, nbVoltageLevels](std::size_t begin, std::size_t end) {
+    for (auto chunk = begin; chunk < end; ++chunk) {
+      if (!arenas[chunk]) {
+        arenas[chunk] = std::make_shared<common::Arena>();
+      }
+      for (auto i = chunk * nbVoltageLevels / nbChunks; i < (chunk + 1) * nbVoltageLevels / nbChunks; ++i) {
+        extractVoltageLevel(columns, i, arenas[chunk], extracts[i]);
+      }
     }
+  });
 
-    auto vl = std::make_shared<VoltageLevel>(networkVL->getID());
-    voltagelevels_.push_back(vl);
+  // merge in network order, so that the node indexes do not depend on the number of threads
+  std::vector<Graph::NodeIndex> busNodes(columns.buses.ids.size());
+  for (std::size_t vl = 0; vl < nbVoltageLevels; ++vl) {
+    const auto& extract = extracts[vl];
+    voltagelevels_.push_back(extract.voltageLevel);
 
-    const auto& buses = networkVL->getBuses();
-    for (const auto& bus : buses) {
-      const auto& nodeId = bus->getID();
+    for (const auto& node : extract.nodes) {
 #if _DEBUG_
       // ids of nodes should be unique
-      assert(nodes_.count(nodeId) == 0);
+      assert(!nodesIndex_.contains(node->id));
 #endif
-      auto found = shuntsMap.find(nodeId);
-      nodes_[nodeId] = Node::build(nodeId, vl, networkVL->getVNom(), (found != shuntsMap.end()) ? found->second : std::vector<Shunt>{});
-      LOG(debug) << "Node " << nodeId << " created" << LOG_ENDL;
-      if (opt_id && *opt_id == nodeId) {
+      // nodes_ follows the indexes of the graph
+      nodesIndex_.insert(node->id, builder.addNode(node));
+      nodes_.push_back(node);
+      LOG(debug) << "Node " << node->id << " created" << LOG_ENDL;
+      if (opt_id && *opt_id == node->id.str()) {
         LOG(debug) << "Slack node with id " << *opt_id << " found in network" << LOG_ENDL;
-        slackNode_ = nodes_[nodeId];
+        slackNode_ = node;
       }
     }
-
-    const auto& loads = networkVL->getLoads();
-    for (const auto& load : loads) {
-      // if load is not connected, it is ignored
-      if (!load->getInitialConnected())
-        continue;
-      auto nodeid = load->getBusInterface()->getID();
-#if _DEBUG_
-      // node should exist at this point
-      assert(nodes_.count(nodeid));
-#endif
-      nodes_[nodeid]->loads.emplace_back(load->getID());
-      LOG(debug) << "Node " << nodeid << " contains load " << load->getID() << LOG_ENDL;
+    for (std::size_t bus = 0; bus < extract.busNodes.size(); ++bus) {
+      busNodes[columns.buses.offsets[vl] + bus] = extract.nodes[extract.busNodes[bus]]->index;
     }
 
-    const auto& generators = networkVL->getGenerators();
-    for (const auto& generator : generators) {
-      // if generator is not connected, it is ignored
-      if (!generator->getInitialConnected())
-        continue;
-      auto nodeid = generator->getBusInterface()->getID();
-#if _DEBUG_
-      // node should exist at this point
-      assert(nodes_.count(nodeid));
-#endif
-      auto targetP = generator->getTargetP();
-      auto pmin = generator->getPMin();
-      auto pmax = generator->getPMax();
-      if (generator->isVoltageRegulationOn() && (DYN::doubleEquals(-targetP, pmin) || -targetP > pmin) &&
-          (DYN::doubleEquals(-targetP, pmax) || -targetP < pmax)) {
-        // We don't use dynamic models for generators with voltage regulation disabled and an active power reference outside the generator's PQ diagram
-        auto regulated_bus = updateMapRegulatingBuses(mapBusGeneratorsBusId_, generator->getID(), interface_);
-        nodes_[nodeid]->generators.emplace_back(generator->getID(), generator->getReactiveCurvesPoints(), generator->getQMin(), generator->getQMax(), pmin,
-                                                pmax, targetP, regulated_bus, nodeid);
-        LOG(debug) << "Node " << nodeid << " contains generator " << generator->getID() << LOG_ENDL;
+    for (const auto& alias : extract.aliases) {
+      const auto& node = extract.nodes[alias.second];
+      nodesIndex_.insert(alias.first, node->index);
+      nodeAliases_.emplace_back(alias.first, node->index);
+      if (opt_id && *opt_id == alias.first.str()) {
+        LOG(debug) << "Slack node with id " << *opt_id << " found in network, merged into node " << node->id << LOG_ENDL;
+        slackNode_ = node;
       }
     }
 
-    const auto& switches = networkVL->getSwitches();
-    for (const auto& sw : switches) {
-      if (!sw->isOpen()) {
-        auto bus1 = sw->getBusInterface1();
-        auto bus2 = sw->getBusInterface2();
-#ifdef _DEBUG_
-        // By construction buses in switches are all inside the voltage level, so the nodes already exist
-        assert(nodes_.count(bus1->getID()) > 0);
-        assert(nodes_.count(bus2->getID()) > 0);
-#endif
-        nodes_[bus1->getID()]->neighbours.push_back(nodes_.at(bus2->getID()));
-        nodes_[bus2->getID()]->neighbours.push_back(nodes_.at(bus1->getID()));
-        LOG(debug) << "Node " << bus1->getID() << " connected to " << bus2->getID() << " by switch " << sw->getID() << LOG_ENDL;
-      }
+    for (const auto& sw : extract.switches) {
+      addElementEdge(builder, sw.id, extract.nodes[sw.node1]->index, extract.nodes[sw.node2]->index, Graph::EdgeType::SWITCH, sw.isOpen);
     }
 
-    const auto& svarcs = networkVL->getStaticVarCompensators();
-    for (const auto& svarc : svarcs) {
-      if (!svarc->getInitialConnected()) {
-        continue;
-      }
-      if (!svarc->hasStandbyAutomaton()) {
-        LOG(warn) << MESS(SVarCIIDMExtensionNotFound, "standByAutomaton", svarc->getID()) << LOG_ENDL;
-        continue;
-      }
-      if (!svarc->hasVoltagePerReactivePowerControl()) {
-        LOG(warn) << MESS(SVarCIIDMExtensionNotFound, "voltagePerReactivePowerControl", svarc->getID()) << LOG_ENDL;
-        continue;
-      }
-      auto nodeid = svarc->getBusInterface()->getID();
-      nodes_[nodeid]->svarcs.emplace_back(svarc->getID(), svarc->getBMin(), svarc->getBMax(), svarc->getVSetPoint(), svarc->getVNom(),
-                                          svarc->getUMinActivation(), svarc->getUMaxActivation(), svarc->getUSetPointMin(), svarc->getUSetPointMax(),
-                                          svarc->getB0(), svarc->getSlope());
-      LOG(debug) << "Node " << nodeid << " contains static var compensator " << svarc->getID() << LOG_ENDL;
+    for (const auto& generator : extract.generators) {
+      pendingGenerators_.emplace_back(extract.nodes[generator.first]->index, generator.second);
+    }
+    for (const auto& svarc : extract.svarcs) {
+      pendingSvarcs_.emplace_back(extract.nodes[svarc.first]->index, svarc.second);
     }
   }
 
   // perform connections
-  const auto& lines = network->getLines();
-  for (const auto& line : lines) {
-    auto bus1 = line->getBusInterface1();
-    auto bus2 = line->getBusInterface2();
-    if (line->getInitialConnected1() && line->getInitialConnected2()) {
-#if _DEBUG_
-      assert(nodes_.count(bus1->getID()) > 0);
-      assert(nodes_.count(bus2->getID()) > 0);
-#endif
-      LOG(debug) << "Node " << bus1->getID() << " connected to " << bus2->getID() << " by line " << line->getID() << LOG_ENDL;
-      auto season = line->getActiveSeason();
-      auto new_line = Line::build(line->getID(), nodes_.at(bus1->getID()), nodes_.at(bus2->getID()), season);
-      lines_.push_back(new_line);
+  const auto& lines = columns.lines;
+  for (std::size_t i = 0; i < lines.ids.size(); ++i) {
+    if (!lines.connected[i]) {
+      continue;
     }
+    const auto& node1 = nodes_[busNodes[lines.buses1[i]]];
+    const auto& node2 = nodes_[busNodes[lines.buses2[i]]];
+    LOG(debug) << "Node " << node1->id << " connected to " << node2->id << " by line " << lines.ids[i] << LOG_ENDL;
+    auto new_line = Line::build(lines.ids[i], node1, node2, lines.seasons[i], arena_);
+    lines_.push_back(new_line);
+    addElementEdge(builder, new_line->id, new_line->nodes[0]->index, new_line->nodes[1]->index, Graph::EdgeType::LINE);
   }
 
-  const auto& transfos = network->getTwoWTransformers();
-  for (const auto& transfo : transfos) {
-    auto bus1 = transfo->getBusInterface1();
-    auto bus2 = transfo->getBusInterface2();
-    if (transfo->getInitialConnected1() && transfo->getInitialConnected2()) {
-      auto tfo = Tfo::build(transfo->getID(), nodes_.at(bus1->getID()), nodes_.at(bus2->getID()));
-      tfos_.push_back(tfo);
+  const auto& transfos = columns.twoWTransformers;
+  for (std::size_t i = 0; i < transfos.ids.size(); ++i) {
+    if (!transfos.connected[i]) {
+      continue;
+    }
+    const auto& node1 = nodes_[busNodes[transfos.buses1[i]]];
+    const auto& node2 = nodes_[busNodes[transfos.buses2[i]]];
+    auto tfo = Tfo::build(transfos.ids[i], node1, node2, arena_);
+    tfos_.push_back(tfo);
+    addElementEdge(builder, tfo->id, tfo->nodes[0]->index, tfo->nodes[1]->index, Graph::EdgeType::TFO);
 
-      LOG(debug) << "Node " << bus1->getID() << " connected to " << bus2->getID() << " by 2W " << transfo->getID() << LOG_ENDL;
+    LOG(debug) << "Node " << node1->id << " connected to " << node2->id << " by 2W " << transfos.ids[i] << LOG_ENDL;
+  }
+
+  const auto& transfos_three = columns.threeWTransformers;
+  for (std::size_t i = 0; i < transfos_three.ids.size(); ++i) {
+    if (!transfos_three.connected[i]) {
+      continue;
     }
+    const auto& node1 = nodes_[busNodes[transfos_three.buses1[i]]];
+    const auto& node2 = nodes_[busNodes[transfos_three.buses2[i]]];
+    const auto& node3 = nodes_[busNodes[transfos_three.buses3[i]]];
+    auto tfo = Tfo::build(transfos_three.ids[i], node1, node2, node3, arena_);
+    tfos_.push_back(tfo);
+    addElementEdge(builder, tfo->id, tfo->nodes[0]->index, tfo->nodes[1]->index, Graph::EdgeType::TFO);
+    addElementEdge(builder, tfo->id, tfo->nodes[0]->index, tfo->nodes[2]->index, Graph::EdgeType::TFO);
+    addElementEdge(builder, tfo->id, tfo->nodes[1]->index, tfo->nodes[2]->index, Graph::EdgeType::TFO);
+
+    LOG(debug) << "Node " << node1->id << " connected to " << node2->id << " and " << node3->id << " by 3W " << transfos_three.ids[i] << LOG_ENDL;
   }
 
-  const auto& transfos_three = network->getThreeWTransformers();
-  for (const auto& transfo : transfos_three) {
-    auto bus1 = transfo->getBusInterface1();
-    auto bus2 = transfo->getBusInterface2();
-    auto bus3 = transfo->getBusInterface3();
-    if (transfo->getInitialConnected1() && transfo->getInitialConnected2() && transfo->getInitialConnected3()) {
-      auto tfo = Tfo::build(transfo->getID(), nodes_.at(bus1->getID()), nodes_.at(bus2->getID()), nodes_.at(bus3->getID()));
-      tfos_.push_back(tfo);
+  const auto& hvdcLines = network->getHvdcLines();
+  for (const auto& hvdcLine : hvdcLines) {
+    if (hvdcLine->getConverter1()->getInitialConnected() && hvdcLine->getConverter2()->getInitialConnected()) {
+      pendingHvdcLines_.push_back(hvdcLine);
+    }
+  }
+
+  // HVDC lines do not connect the nodes of the AC network so they are not part of the graph
+  computeTopology(builder);
+  extractEquipment(false);
+  LOG(debug) << "Network contains " << pendingGenerators_.size() << " generators, " << pendingSvarcs_.size() << " static var compensators and "
+             << pendingHvdcLines_.size() << " hvdc lines outside the main island, not extracted" << LOG_ENDL;
+
+  std::size_t nbAllocations = 0;
+  std::size_t nbBlocks = 0;
+  std::size_t size = 0;
+  for (const auto& arena : arenas) {
+    nbAllocations += arena->nbAllocations();
+    nbBlocks += arena->nbBlocks();
+    size += arena->size();
+  }
+  LOG(debug) << "Network topology: " << nbAllocations << " allocations served by " << nbBlocks << " memory blocks (" << size << " bytes) in "
+             << arenas.size() << " arenas" << LOG_ENDL;
+  std::chrono::duration<double, std::milli> extractionTime = buildStart - extractionStart;
+  std::chrono::duration<double, std::milli> buildTime = std::chrono::steady_clock::now() - buildStart;
+  LOG(debug) << "Network extraction: " << extractionTime.count() << " ms reading the data interface, " << buildTime.count()
+             << " ms building the node tree" << LOG_ENDL;
+}
+
+void
+NetworkManager::addElementEdge(Graph::Builder& builder, const common::Symbol& elementId, Graph::NodeIndex node1, Graph::NodeIndex node2,
+                               Graph::EdgeType type, bool isOpen) {
+  const auto edge = builder.addEdge(node1, node2, type, isOpen);
+  const auto position = elementsIndex_.find(elementId);
+  if (position == common::SymbolIndex::npos) {
+    elementsIndex_.insert(elementId, static_cast<common::SymbolIndex::Position>(elementsEdges_.size()));
+    elementsEdges_.push_back({elementId, edge, 1});
+  } else {
+    // edges of an element are consecutive
+    assert(elementsEdges_[position].firstEdge + elementsEdges_[position].nbEdges == edge);
+    ++elementsEdges_[position].nbEdges;
+  }
+}
 
-      LOG(debug) << "Node " << bus1->getID() << " connected to " << bus2->getID() << " and " << bus3->getID() << " by 3W " << transfo->getID() << LOG_ENDL;
+void
+NetworkManager::computeTopology(Graph::Builder& builder) {
+  // nodes are stored and walked in a locality-aware order, so that consecutive nodes are electrically close
+  const auto newIndexes = builder.renumber();
+  graph_ = builder.build();
+  nodes_ = graph_.nodes();
+  nodesIndex_ = common::SymbolIndex();
+  nodesIndex_.reserve(nodes_.size());
+  for (Graph::NodeIndex index = 0; index < nodes_.size(); ++index) {
+    nodesIndex_.insert(nodes_[index]->id, index);
+  }
+  for (auto& alias : nodeAliases_) {
+    alias.second = newIndexes[alias.second];
+    nodesIndex_.insert(alias.first, alias.second);
+  }
+  for (auto& generator : pendingGenerators_) {
+    generator.first = newIndexes[generator.first];
+  }
+  for (auto& svarc : pendingSvarcs_) {
+    svarc.first = newIndexes[svarc.first];
+  }
+  // voltage levels follow the order of their nodes, so that the cache file lists the nodes in the order of their indexes
+  for (const auto& voltageLevel : voltagelevels_) {
+    std::sort(voltageLevel->nodes.begin(), voltageLevel->nodes.end(), [](const Node* lhs, const Node* rhs) { return lhs->index < rhs->index; });
+  }
+  std::stable_sort(voltagelevels_.begin(), voltagelevels_.end(),
+                   [](const std::shared_ptr<VoltageLevel>& lhs, const std::shared_ptr<VoltageLevel>& rhs) {
+                     return !rhs->nodes.empty() && (lhs->nodes.empty() ? false : lhs->nodes.front()->index < rhs->nodes.front()->index);
+                   });
+
+  for (Graph::NodeIndex index = 0; index < nodes_.size(); ++index) {
+    const auto& node = nodes_[index];
+    for (const auto& load : node->loads) {
+      injectionsIndex_.insert(load.id, index);
+    }
+    for (auto row : node->generators) {
+      injectionsIndex_.insert(generators_.ids()[row], index);
+    }
+    for (const auto& svarc : node->svarcs) {
+      injectionsIndex_.insert(svarc.id, index);
     }
   }
 
-  const auto& hvdcLines = network->getHvdcLines();
+  // order of the walk by id, independent of the order of the storage, for the algorithms whose results depend on the walk order
+  sortedNodes_.resize(nodes_.size());
+  std::iota(sortedNodes_.begin(), sortedNodes_.end(), 0);
+  std::sort(sortedNodes_.begin(), sortedNodes_.end(), [this](Graph::NodeIndex lhs, Graph::NodeIndex rhs) { return nodes_[lhs]->id < nodes_[rhs]->id; });
+
+  islands_ = Islands::compute(graph_, nbThreads_);
+  LOG(debug) << "Network contains " << islands_.nbIslands() << " islands" << LOG_ENDL;
+  LOG(debug) << "Symbol table contains " << common::Symbol::nbSymbols() << " ids" << LOG_ENDL;
+}
+
+void
+NetworkManager::countPendingRegulations(bool all) {
+  const auto regulations = takeIf(pendingRegulations_, [this, all](const PendingRegulation& regulation) {
+    return all || islands_.isInMainIsland(findNode(regulation.nodeId1)->index) || islands_.isInMainIsland(findNode(regulation.nodeId2)->index);
+  });
+  for (const auto& regulation : regulations) {
+    updateMapRegulatingBuses(regulation.isVSCConverter ? mapBusVSCConvertersBusId_ : mapBusGeneratorsBusId_, regulation.regulatedBus);
+  }
+}
+
+void
+NetworkManager::extractEquipment(bool all) {
+  countPendingRegulations(false);
+  auto isExtracted = [this, all](Graph::NodeIndex index) { return all || islands_.isInMainIsland(index); };
+  const auto generators =
+      takeIf(pendingGenerators_, [&isExtracted](const PendingEquipment<DYN::GeneratorInterface>& generator) { return isExtracted(generator.first); });
+  const auto svarcs =
+      takeIf(pendingSvarcs_, [&isExtracted](const PendingEquipment<DYN::StaticVarCompensatorInterface>& svarc) { return isExtracted(svarc.first); });
+  const auto hvdcLines = takeIf(pendingHvdcLines_, [this, &isExtracted](const boost::shared_ptr<DYN::HvdcLineInterface>& hvdcLine) {
+    return isExtracted(findNode(hvdcLine->getConverter1()->getBusInterface()->getID())->index) ||
+           isExtracted(findNode(hvdcLine->getConverter2()->getBusInterface()->getID())->index);
+  });
+  if (generators.empty() && svarcs.empty() && hvdcLines.empty()) {
+    return;
+  }
+
+  // regulated buses of all the regulating elements are resolved in a single pass: generators in network order, then VSC converters of the hvdc lines
+  std::vector<const PendingEquipment<DYN::GeneratorInterface>*> regulatingGenerators;
+  std::vector<std::string> regulatingElements;
+  for (const auto& pendingGenerator : generators) {
+    const auto& generator = pendingGenerator.second;
+    auto targetP = generator->getTargetP();
+    auto pmin = generator->getPMin();
+    auto pmax = generator->getPMax();
+    if (generator->isVoltageRegulationOn() && (DYN::doubleEquals(-targetP, pmin) || -targetP > pmin) &&
+        (DYN::doubleEquals(-targetP, pmax) || -targetP < pmax)) {
+      // We don't use dynamic models for generators with voltage regulation disabled and an active power reference outside the generator's PQ diagram
+      regulatingGenerators.push_back(&pendingGenerator);
+      regulatingElements.push_back(generator->getID());
+    } else {
+      unmodelledInjections_.insert(generator->getID());
+    }
+  }
   for (const auto& hvdcLine : hvdcLines) {
-    const auto& converterDyn1 = hvdcLine->getConverter1();
-    const auto& converterDyn2 = hvdcLine->getConverter2();
-    if (!converterDyn1->getInitialConnected() || !converterDyn2->getInitialConnected()) {
+    if (hvdcLine->getConverter1()->getConverterType() == DYN::ConverterInterface::ConverterType_t::VSC_CONVERTER) {
+      regulatingElements.push_back(hvdcLine->getConverter1()->getID());
+      regulatingElements.push_back(hvdcLine->getConverter2()->getID());
+    }
+  }
+  const auto regulatedBuses = resolveRegulatedBuses(regulatingElements);
+  auto nextRegulatedBus = regulatedBuses.begin();
+
+  for (const auto* regulatingGenerator : regulatingGenerators) {
+    const auto& node = nodes_[regulatingGenerator->first];
+    const auto& generator = regulatingGenerator->second;
+    const auto& regulatedBus = *nextRegulatedBus++;
+    const auto curve = curves_.add(generator->getReactiveCurvesPoints());
+    node->generators.push_back(generators_.add(generator->getID(), curve, generator->getQMin(), generator->getQMax(), generator->getPMin(),
+                                               generator->getPMax(), generator->getTargetP(), regulatedBus, node->id));
+    injectionsIndex_.insert(generator->getID(), regulatingGenerator->first);
+    if (islands_.isInMainIsland(regulatingGenerator->first)) {
+      updateMapRegulatingBuses(mapBusGeneratorsBusId_, regulatedBus);
+    } else {
+      pendingRegulations_.push_back(PendingRegulation{generator->getID(), node->id, node->id, regulatedBus, false});
+    }
+    LOG(debug) << "Node " << node->id << " contains generator " << generator->getID() << LOG_ENDL;
+  }
+
+  for (const auto& pendingSvarc : svarcs) {
+    const auto& node = nodes_[pendingSvarc.first];
+    const auto& svarc = pendingSvarc.second;
+    if (!svarc->hasStandbyAutomaton()) {
+      LOG(warn) << MESS(SVarCIIDMExtensionNotFound, "standByAutomaton", svarc->getID()) << LOG_ENDL;
+      unmodelledInjections_.insert(svarc->getID());
       continue;
     }
-    std::shared_ptr<Converter> converter1;
-    std::shared_ptr<Converter> converter2;
+    if (!svarc->hasVoltagePerReactivePowerControl()) {
+      LOG(warn) << MESS(SVarCIIDMExtensionNotFound, "voltagePerReactivePowerControl", svarc->getID()) << LOG_ENDL;
+      unmodelledInjections_.insert(svarc->getID());
+      continue;
+    }
+    node->svarcs.emplace_back(svarc->getID(), svarc->getBMin(), svarc->getBMax(), svarc->getVSetPoint(), svarc->getVNom(), svarc->getUMinActivation(),
+                              svarc->getUMaxActivation(), svarc->getUSetPointMin(), svarc->getUSetPointMax(), svarc->getB0(), svarc->getSlope());
+    injectionsIndex_.insert(svarc->getID(), pendingSvarc.first);
+    LOG(debug) << "Node " << node->id << " contains static var compensator " << svarc->getID() << LOG_ENDL;
+  }
+
+  for (const auto& hvdcLine : hvdcLines) {
+    const auto& converterDyn1 = hvdcLine->getConverter1();
+    const auto& converterDyn2 = hvdcLine->getConverter2();
+    // converters refer to the nodes, in which the buses of the data interface may have been merged
+    const auto& node1 = findNode(converterDyn1->getBusInterface()->getID());
+    const auto& node2 = findNode(converterDyn2->getBusInterface()->getID());
+    const bool isInMainIsland = islands_.isInMainIsland(node1->index) || islands_.isInMainIsland(node2->index);
+    auto addRegulation = [this, &node1, &node2, isInMainIsland](const std::string& converterId, const BusId& regulatedBus) {
+      if (isInMainIsland) {
+        updateMapRegulatingBuses(mapBusVSCConvertersBusId_, regulatedBus);
+      } else {
+        pendingRegulations_.push_back(PendingRegulation{converterId, node1->id, node2->id, regulatedBus, true});
+      }
+    };
+    Converter* converter1;
+    Converter* converter2;
 
     HvdcLine::ConverterType converterType;
     if (converterDyn1->getConverterType() == DYN::ConverterInterface::ConverterType_t::VSC_CONVERTER) {
       converterType = HvdcLine::ConverterType::VSC;
       auto vscConverterDyn1 = boost::dynamic_pointer_cast<DYN::VscConverterInterface>(converterDyn1);
       bool voltageRegulationOn = vscConverterDyn1->getVoltageRegulatorOn();
-      converter1 = std::make_shared<VSCConverter>(converterDyn1->getID(), converterDyn1->getBusInterface()->getID(), nullptr, voltageRegulationOn,
-                                                  vscConverterDyn1->getQMax(), vscConverterDyn1->getQMin(), vscConverterDyn1->getReactiveCurvesPoints());
-      updateMapRegulatingBuses(mapBusVSCConvertersBusId_, converterDyn1->getID(), interface_);
+      auto curve = curves_.add(vscConverterDyn1->getReactiveCurvesPoints());
+      converters_.emplace_back(converterDyn1->getID(), node1->id, nullptr,
+                               VSCConverter(voltageRegulationOn, vscConverterDyn1->getQMax(), vscConverterDyn1->getQMin(), curve));
+      converter1 = &converters_.back();
+      addRegulation(converterDyn1->getID(), *nextRegulatedBus++);
 
       auto vscConverterDyn2 = boost::dynamic_pointer_cast<DYN::VscConverterInterface>(converterDyn2);
       voltageRegulationOn = vscConverterDyn2->getVoltageRegulatorOn();
-      converter2 = std::make_shared<VSCConverter>(converterDyn2->getID(), converterDyn2->getBusInterface()->getID(), nullptr, voltageRegulationOn,
-                                                  vscConverterDyn2->getQMax(), vscConverterDyn2->getQMin(), vscConverterDyn2->getReactiveCurvesPoints());
-      updateMapRegulatingBuses(mapBusVSCConvertersBusId_, converterDyn2->getID(), interface_);
+      curve = curves_.add(vscConverterDyn2->getReactiveCurvesPoints());
+      converters_.emplace_back(converterDyn2->getID(), node2->id, nullptr,
+                               VSCConverter(voltageRegulationOn, vscConverterDyn2->getQMax(), vscConverterDyn2->getQMin(), curve));
+      converter2 = &converters_.back();
+      addRegulation(converterDyn2->getID(), *nextRegulatedBus++);
     } else {
       converterType = HvdcLine::ConverterType::LCC;
       auto lccConverterDyn1 = boost::dynamic_pointer_cast<DYN::LccConverterInterface>(converterDyn1);
-      converter1 =
-          std::make_shared<LCCConverter>(converterDyn1->getID(), converterDyn1->getBusInterface()->getID(), nullptr, lccConverterDyn1->getPowerFactor());
+      converters_.emplace_back(converterDyn1->getID(), node1->id, nullptr, LCCConverter(lccConverterDyn1->getPowerFactor()));
+      converter1 = &converters_.back();
 
       auto lccConverterDyn2 = boost::dynamic_pointer_cast<DYN::LccConverterInterface>(converterDyn2);
-      converter2 =
-          std::make_shared<LCCConverter>(converterDyn2->getID(), converterDyn2->getBusInterface()->getID(), nullptr, lccConverterDyn2->getPowerFactor());
+      converters_.emplace_back(converterDyn2->getID(), node2->id, nullptr, LCCConverter(lccConverterDyn2->getPowerFactor()));
+      converter2 = &converters_.back();
     }
 
     // active power control external IIDM extension
@@ -255,22 +823,640 @@ NetworkManager::buildTree() {
             ? boost::optional<HvdcLine::ActivePowerControl>(HvdcLine::ActivePowerControl(hvdcLine->getDroop().value(), hvdcLine->getP0().value()))
             : boost::none;
 
-    auto hvdcLineCreated = HvdcLine::build(hvdcLine->getID(), converterType, converter1, converter2, activePowerControl, hvdcLine->getPmax());
+    auto hvdcLineCreated = HvdcLine::build(hvdcLine->getID(), converterType, converter1, converter2, activePowerControl, hvdcLine->getPmax(), arena_);
     hvdcLines_.emplace_back(hvdcLineCreated);
-    nodes_[converterDyn1->getBusInterface()->getID()]->converters.push_back(converter1);
-    nodes_[converterDyn2->getBusInterface()->getID()]->converters.push_back(converter2);
+    node1->converters.push_back(converter1);
+    node2->converters.push_back(converter2);
     LOG(debug) << "Network contains hvdcLine " << hvdcLine->getID() << " with converterStation " << hvdcLine->getIdConverter1() << " and converterStation "
                << hvdcLine->getIdConverter2() << LOG_ENDL;
   }
 }
 
 void
-NetworkManager::walkNodes() const {
-  for (const auto& node : nodes_) {
-    for (const auto& cbk : nodesCallbacks_) {
-      cbk(node.second);
+NetworkManager::saveCache(const boost::filesystem::path& filepath, NetworkCache::Key key) const {
+  NetworkCache::Writer writer;
+
+  // nodes by voltage level, in the order of the graph
+  writer.write(static_cast<std::uint64_t>(voltagelevels_.size()));
+  for (const auto& vl : voltagelevels_) {
+    writer.writeSymbol(vl->id);
+    writer.write(static_cast<std::uint64_t>(vl->nodes.size()));
+    for (const auto* node : vl->nodes) {
+      writer.writeSymbol(node->id);
+      writer.write(node->nominalVoltage);
+      writer.write(static_cast<std::uint32_t>(node->shunts.size()));
+      for (const auto& shunt : node->shunts) {
+        writer.writeSymbol(shunt.id);
+      }
+      writer.write(static_cast<std::uint32_t>(node->loads.size()));
+      for (const auto& load : node->loads) {
+        writer.writeSymbol(load.id);
+        writer.write(load.p0);
+      }
+      writer.write(static_cast<std::uint32_t>(node->generators.size()));
+      for (auto row : node->generators) {
+        writer.writeSymbol(generators_.ids()[row]);
+        writePoints(writer, generators_.points(row));
+        writer.write(generators_.qmin()[row]);
+        writer.write(generators_.qmax()[row]);
+        writer.write(generators_.pmin()[row]);
+        writer.write(generators_.pmax()[row]);
+        writer.write(generators_.targetP()[row]);
+        writer.writeSymbol(generators_.regulatedBusIds()[row]);
+        writer.writeSymbol(generators_.connectedBusIds()[row]);
+      }
+      writer.write(static_cast<std::uint32_t>(node->svarcs.size()));
+      for (const auto& svarc : node->svarcs) {
+        writer.writeSymbol(svarc.id);
+        for (auto value : {svarc.bMin, svarc.bMax, svarc.voltageSetPoint, svarc.VNom, svarc.UMinActivation, svarc.UMaxActivation, svarc.USetPointMin,
+                           svarc.USetPointMax, svarc.b0, svarc.slope}) {
+          writer.write(value);
+        }
+      }
+    }
+  }
+
+  // buses merged into another node, by the id of this node, so that they do not depend on the indexes of the nodes
+  writer.write(static_cast<std::uint64_t>(nodeAliases_.size()));
+  for (const auto& alias : nodeAliases_) {
+    writer.writeSymbol(alias.first);
+    writer.writeSymbol(nodes_[alias.second]->id);
+  }
+
+  writer.write(static_cast<std::uint8_t>(slackNode_ ? 1 : 0));
+  if (slackNode_) {
+    writer.write(slackNode_->index);
+  }
+
+  // edges in the order of the graph, grouped by element
+  writer.write(static_cast<std::uint64_t>(graph_.nbEdges()));
+  for (const auto& element : elementsEdges_) {
+    for (auto edge = element.firstEdge; edge < element.firstEdge + element.nbEdges; ++edge) {
+      writer.writeSymbol(element.id);
+      writer.write(graph_.edgeNode1(edge));
+      writer.write(graph_.edgeNode2(edge));
+      writer.write(graph_.edgeType(edge));
+      writer.write(static_cast<std::uint8_t>(graph_.isEdgeOpen(edge) ? 1 : 0));
+    }
+  }
+
+  writer.write(static_cast<std::uint64_t>(lines_.size()));
+  for (const auto& line : lines_) {
+    writer.writeSymbol(line->id);
+    writer.writeString(line->activeSeason);
+    writer.write(line->nodes[0]->index);
+    writer.write(line->nodes[1]->index);
+  }
+
+  writer.write(static_cast<std::uint64_t>(tfos_.size()));
+  for (const auto& tfo : tfos_) {
+    writer.writeSymbol(tfo->id);
+    writer.write(static_cast<std::uint8_t>(tfo->nodes.size()));
+    for (const auto* node : tfo->nodes) {
+      writer.write(node->index);
+    }
+  }
+
+  writer.write(static_cast<std::uint64_t>(hvdcLines_.size()));
+  for (const auto& hvdcLine : hvdcLines_) {
+    writer.writeSymbol(hvdcLine->id);
+    writer.write(hvdcLine->converterType);
+    writer.write(hvdcLine->pMax);
+    writer.write(static_cast<std::uint8_t>(hvdcLine->activePowerControl ? 1 : 0));
+    writer.write(hvdcLine->activePowerControl ? hvdcLine->activePowerControl->droop : 0.);
+    writer.write(hvdcLine->activePowerControl ? hvdcLine->activePowerControl->p0 : 0.);
+    for (const auto& converter : {hvdcLine->converter1, hvdcLine->converter2}) {
+      writer.writeSymbol(converter->converterId);
+      writer.writeSymbol(converter->busId);
+      if (hvdcLine->converterType == HvdcLine::ConverterType::VSC) {
+        const auto& vscConverter = converter->vsc();
+        writer.write(static_cast<std::uint8_t>(vscConverter.voltageRegulationOn ? 1 : 0));
+        writer.write(vscConverter.qMax);
+        writer.write(vscConverter.qMin);
+        writePoints(writer, curves_.points(vscConverter.curve));
+      } else {
+        writer.write(converter->lcc().powerFactor);
+      }
+    }
+  }
+
+  for (const auto* map : {&mapBusGeneratorsBusId_, &mapBusVSCConvertersBusId_}) {
+    writer.write(static_cast<std::uint64_t>(map->size()));
+    for (const auto& regulatedBus : *map) {
+      writer.writeSymbol(regulatedBus.first);
+      writer.write(regulatedBus.second);
+    }
+  }
+  writer.write(static_cast<std::uint64_t>(unmodelledInjections_.size()));
+  for (const auto& injectionId : unmodelledInjections_) {
+    writer.writeSymbol(injectionId);
+  }
+  writer.write(static_cast<std::uint64_t>(pendingRegulations_.size()));
+  for (const auto& regulation : pendingRegulations_) {
+    writer.writeSymbol(regulation.elementId);
+    writer.writeSymbol(regulation.nodeId1);
+    writer.writeSymbol(regulation.nodeId2);
+    writer.writeSymbol(regulation.regulatedBus);
+    writer.write(static_cast<std::uint8_t>(regulation.isVSCConverter ? 1 : 0));
+  }
+
+  writer.save(filepath, key);
+}
+
+void
+NetworkManager::loadCache(NetworkCache::Reader& reader) {
+  auto nodeAt = [this](Graph::NodeIndex index) -> const std::shared_ptr<Node>& {
+    if (index >= nodes_.size()) {
+      throw std::runtime_error("Invalid node index in network cache file");
+    }
+    return nodes_[index];
+  };
+
+  Graph::Builder builder;
+  const auto nbVoltageLevels = reader.read<std::uint64_t>();
+  for (std::uint64_t i = 0; i < nbVoltageLevels; ++i) {
+    auto vl = common::makeShared<VoltageLevel>(arena_, reader.readSymbol());
+    voltagelevels_.push_back(vl);
+    const auto nbNodes = reader.read<std::uint64_t>();
+    for (std::uint64_t j = 0; j < nbNodes; ++j) {
+      const auto& nodeId = reader.readSymbol();
+      const auto nominalVoltage = reader.read<double>();
+      std::vector<Shunt> shunts;
+      const auto nbShunts = reader.read<std::uint32_t>();
+      for (std::uint32_t k = 0; k < nbShunts; ++k) {
+        shunts.emplace_back(reader.readSymbol());
+      }
+      auto node = Node::build(nodeId, vl, nominalVoltage, shunts, arena_);
+      if (!nodesIndex_.insert(nodeId, builder.addNode(node))) {
+        throw std::runtime_error("Duplicated node " + nodeId.str() + " in network cache file");
+      }
+      nodes_.push_back(node);
+
+      const auto nbLoads = reader.read<std::uint32_t>();
+      for (std::uint32_t k = 0; k < nbLoads; ++k) {
+        const auto& loadId = reader.readSymbol();
+        node->loads.emplace_back(loadId, reader.read<double>());
+      }
+      const auto nbGenerators = reader.read<std::uint32_t>();
+      for (std::uint32_t k = 0; k < nbGenerators; ++k) {
+        const auto& generatorId = reader.readSymbol();
+        const auto curve = curves_.add(readPoints(reader));
+        const auto qmin = reader.read<double>();
+        const auto qmax = reader.read<double>();
+        const auto pmin = reader.read<double>();
+        const auto pmax = reader.read<double>();
+        const auto targetP = reader.read<double>();
+        const auto& regulatedBusId = reader.readSymbol();
+        const auto& connectedBusId = reader.readSymbol();
+        node->generators.push_back(generators_.add(generatorId, curve, qmin, qmax, pmin, pmax, targetP, regulatedBusId, connectedBusId));
+      }
+      const auto nbSvarcs = reader.read<std::uint32_t>();
+      for (std::uint32_t k = 0; k < nbSvarcs; ++k) {
+        const auto& svarcId = reader.readSymbol();
+        double values[10];
+        for (auto& value : values) {
+          value = reader.read<double>();
+        }
+        node->svarcs.emplace_back(svarcId, values[0], values[1], values[2], values[3], values[4], values[5], values[6], values[7], values[8], values[9]);
+      }
+    }
+  }
+
+  const auto nbAliases = reader.read<std::uint64_t>();
+  for (std::uint64_t i = 0; i < nbAliases; ++i) {
+    const auto& alias = reader.readSymbol();
+    const auto& nodeId = reader.readSymbol();
+    const auto position = nodesIndex_.find(nodeId);
+    if (position == common::SymbolIndex::npos || !nodesIndex_.insert(alias, position)) {
+      throw std::runtime_error("Invalid merged bus " + alias.str() + " in network cache file");
+    }
+    nodeAliases_.emplace_back(alias, position);
+  }
+
+  if (reader.read<std::uint8_t>() != 0) {
+    slackNode_ = nodeAt(reader.read<Graph::NodeIndex>());
+  }
+
+  const auto nbEdges = reader.read<std::uint64_t>();
+  for (std::uint64_t i = 0; i < nbEdges; ++i) {
+    const auto& elementId = reader.readSymbol();
+    const auto& node1 = nodeAt(reader.read<Graph::NodeIndex>());
+    const auto& node2 = nodeAt(reader.read<Graph::NodeIndex>());
+    const auto type = reader.read<Graph::EdgeType>();
+    if (type != Graph::EdgeType::SWITCH && type != Graph::EdgeType::LINE && type != Graph::EdgeType::TFO) {
+      throw std::runtime_error("Invalid edge type in network cache file");
+    }
+    const bool isOpen = reader.read<std::uint8_t>() != 0;
+    const auto position = elementsIndex_.find(elementId);
+    if (position != common::SymbolIndex::npos && position + 1 != elementsEdges_.size()) {
+      throw std::runtime_error("Invalid edges of element " + elementId.str() + " in network cache file");
+    }
+    addElementEdge(builder, elementId, node1->index, node2->index, type, isOpen);
+  }
+
+  const auto nbLines = reader.read<std::uint64_t>();
+  for (std::uint64_t i = 0; i < nbLines; ++i) {
+    const auto& lineId = reader.readSymbol();
+    const auto& season = reader.readSymbol();
+    const auto& node1 = nodeAt(reader.read<Graph::NodeIndex>());
+    const auto& node2 = nodeAt(reader.read<Graph::NodeIndex>());
+    lines_.push_back(Line::build(lineId, node1, node2, season.str(), arena_));
+  }
+
+  const auto nbTfos = reader.read<std::uint64_t>();
+  for (std::uint64_t i = 0; i < nbTfos; ++i) {
+    const auto& tfoId = reader.readSymbol();
+    const auto nbTfoNodes = reader.read<std::uint8_t>();
+    if (nbTfoNodes == 2) {
+      const auto& node1 = nodeAt(reader.read<Graph::NodeIndex>());
+      const auto& node2 = nodeAt(reader.read<Graph::NodeIndex>());
+      tfos_.push_back(Tfo::build(tfoId, node1, node2, arena_));
+    } else if (nbTfoNodes == 3) {
+      const auto& node1 = nodeAt(reader.read<Graph::NodeIndex>());
+      const auto& node2 = nodeAt(reader.read<Graph::NodeIndex>());
+      const auto& node3 = nodeAt(reader.read<Graph::NodeIndex>());
+      tfos_.push_back(Tfo::build(tfoId, node1, node2, node3, arena_));
+    } else {
+      throw std::runtime_error("Invalid transformer in network cache file");
     }
   }
+
+  const auto nbHvdcLines = reader.read<std::uint64_t>();
+  for (std::uint64_t i = 0; i < nbHvdcLines; ++i) {
+    const auto& hvdcLineId = reader.readSymbol();
+    const auto converterType = reader.read<HvdcLine::ConverterType>();
+    if (converterType != HvdcLine::ConverterType::VSC && converterType != HvdcLine::ConverterType::LCC) {
+      throw std::runtime_error("Invalid converter type in network cache file");
+    }
+    const auto pMax = reader.read<double>();
+    const bool activePowerEnabled = reader.read<std::uint8_t>() != 0;
+    const auto droop = reader.read<double>();
+    const auto p0 = reader.read<double>();
+    Converter* converters[2];
+    for (auto& converter : converters) {
+      const auto& converterId = reader.readSymbol();
+      const auto& busId = reader.readSymbol();
+      if (converterType == HvdcLine::ConverterType::VSC) {
+        const bool voltageRegulationOn = reader.read<std::uint8_t>() != 0;
+        const auto qMax = reader.read<double>();
+        const auto qMin = reader.read<double>();
+        const auto curve = curves_.add(readPoints(reader));
+        converters_.emplace_back(converterId, busId, nullptr, VSCConverter(voltageRegulationOn, qMax, qMin, curve));
+      } else {
+        converters_.emplace_back(converterId, busId, nullptr, LCCConverter(reader.read<double>()));
+      }
+      converter = &converters_.back();
+    }
+    auto activePowerControl = activePowerEnabled ? boost::optional<HvdcLine::ActivePowerControl>(HvdcLine::ActivePowerControl(droop, p0)) : boost::none;
+    hvdcLines_.push_back(HvdcLine::build(hvdcLineId, converterType, converters[0], converters[1], activePowerControl, pMax, arena_));
+    findNode(converters[0]->busId)->converters.push_back(converters[0]);
+    findNode(converters[1]->busId)->converters.push_back(converters[1]);
+  }
+
+  for (auto* map : {&mapBusGeneratorsBusId_, &mapBusVSCConvertersBusId_}) {
+    const auto nbRegulatedBuses = reader.read<std::uint64_t>();
+    for (std::uint64_t i = 0; i < nbRegulatedBuses; ++i) {
+      const auto& regulatedBus = reader.readSymbol();
+      const auto nbRegulating = reader.read<NbOfRegulating>();
+      if (nbRegulating != NbOfRegulating::ONE && nbRegulating != NbOfRegulating::MULTIPLES) {
+        throw std::runtime_error("Invalid regulated bus in network cache file");
+      }
+      map->insert({regulatedBus, nbRegulating});
+    }
+  }
+  const auto nbUnmodelledInjections = reader.read<std::uint64_t>();
+  for (std::uint64_t i = 0; i < nbUnmodelledInjections; ++i) {
+    unmodelledInjections_.insert(reader.readSymbol());
+  }
+  const auto nbPendingRegulations = reader.read<std::uint64_t>();
+  for (std::uint64_t i = 0; i < nbPendingRegulations; ++i) {
+    PendingRegulation regulation;
+    regulation.elementId = reader.readSymbol();
+    regulation.nodeId1 = reader.readSymbol();
+    regulation.nodeId2 = reader.readSymbol();
+    regulation.regulatedBus = reader.readSymbol();
+    regulation.isVSCConverter = reader.read<std::uint8_t>() != 0;
+    if (nodesIndex_.find(regulation.nodeId1) == common::SymbolIndex::npos || nodesIndex_.find(regulation.nodeId2) == common::SymbolIndex::npos) {
+      throw std::runtime_error("Invalid pending regulation in network cache file");
+    }
+    pendingRegulations_.push_back(regulation);
+  }
+
+  if (!reader.isAtEnd()) {
+    throw std::runtime_error("Unexpected data at the end of network cache file");
+  }
+
+  computeTopology(builder);
+}
+
+void
+NetworkManager::clearTree() {
+  slackNode_.reset();
+  nodes_.clear();
+  nodesIndex_ = common::SymbolIndex();
+  nodeAliases_.clear();
+  elementsIndex_ = common::SymbolIndex();
+  elementsEdges_.clear();
+  injectionsIndex_ = common::SymbolIndex();
+  sortedNodes_.clear();
+  graph_ = Graph();
+  islands_ = Islands();
+  hvdcLines_.clear();
+  converters_.clear();
+  voltagelevels_.clear();
+  lines_.clear();
+  tfos_.clear();
+  generators_.clear();
+  curves_.clear();
+  mapBusGeneratorsBusId_.clear();
+  mapBusVSCConvertersBusId_.clear();
+  pendingGenerators_.clear();
+  pendingSvarcs_.clear();
+  pendingHvdcLines_.clear();
+  pendingRegulations_.clear();
+  unmodelledInjections_.clear();
+  disconnectedInjections_.clear();
+}
+
+auto
+NetworkManager::computeDetachedParts() const -> std::vector<DetachedPart> {
+  // The outage of a three windings transformer removes the loop of its three edges: the bridges are computed on a copy of the graph where
+  // each loop is replaced by a star around a fictitious node. The side of a winding only connected through the transformer is split by its star edge
+  Graph::Builder builder(graph_);
+  std::vector<std::pair<const ElementEdges*, Graph::EdgeIndex>> stars;
+  for (const auto& element : elementsEdges_) {
+    const auto loop = element.firstEdge;
+    if (element.nbEdges != 3 || graph_.isEdgeOpen(loop)) {
+      continue;
+    }
+    const auto center = builder.addFictitiousNode();
+    const auto firstStarEdge = builder.addEdge(graph_.edgeNode1(loop), center, Graph::EdgeType::TFO);
+    builder.addEdge(graph_.edgeNode2(loop), center, Graph::EdgeType::TFO);
+    builder.addEdge(graph_.edgeNode2(loop + 1), center, Graph::EdgeType::TFO);
+    stars.emplace_back(&element, firstStarEdge);
+  }
+  auto starGraph = builder.build();
+  for (const auto& star : stars) {
+    for (auto edge = star.first->firstEdge; edge < star.first->firstEdge + star.first->nbEdges; ++edge) {
+      starGraph.setEdgeOpen(edge, true);
+    }
+  }
+  const auto bridges = Bridges::compute(starGraph);
+
+  // nodes and active powers summed in depth-first order: the sums over the subtree of a node are the difference of two sums
+  const auto& orderedNodes = bridges.orderedNodes();
+  std::vector<std::size_t> counts(orderedNodes.size() + 1, 0);
+  std::vector<double> generations(orderedNodes.size() + 1, 0.);
+  std::vector<double> loads(orderedNodes.size() + 1, 0.);
+  for (std::size_t order = 0; order < orderedNodes.size(); ++order) {
+    counts[order + 1] = counts[order];
+    generations[order + 1] = generations[order];
+    loads[order + 1] = loads[order];
+    if (orderedNodes[order] >= nodes_.size()) {
+      // center of a star
+      continue;
+    }
+    const auto& node = nodes_[orderedNodes[order]];
+    for (auto row : node->generators) {
+      // target active power is given in receptor convention
+      generations[order + 1] -= generators_.targetP()[row];
+    }
+    for (const auto& nodeLoad : node->loads) {
+      loads[order + 1] += nodeLoad.p0;
+    }
+    ++counts[order + 1];
+  }
+
+  // the main island is a single tree of the search, rooted at its node of lowest index
+  Graph::NodeIndex mainRoot = 0;
+  while (mainRoot < nodes_.size() && !islands_.isInMainIsland(mainRoot)) {
+    ++mainRoot;
+  }
+  if (mainRoot == nodes_.size()) {
+    return {};
+  }
+  const SplitPart mainIsland{bridges.order(mainRoot), bridges.order(mainRoot) + bridges.subtreeSize(mainRoot), {}};
+  auto subtree = [&bridges](Graph::NodeIndex root) { return std::make_pair(bridges.order(root), bridges.order(root) + bridges.subtreeSize(root)); };
+
+  // the largest part remains the main island, or on equality the part containing the node with the lowest id, as for the islands
+  auto addDetachedPart = [&](const ElementEdges& element, const std::vector<SplitPart>& splitParts, std::vector<DetachedPart>& parts) {
+    std::size_t remaining = 0;
+    for (std::size_t index = 1; index < splitParts.size(); ++index) {
+      const auto size = sumOver(counts, splitParts[index]);
+      const auto remainingSize = sumOver(counts, splitParts[remaining]);
+      if (size > remainingSize ||
+          (size == remainingSize && lowestIdNode(starGraph, bridges, splitParts[index])->id < lowestIdNode(starGraph, bridges, splitParts[remaining])->id)) {
+        remaining = index;
+      }
+    }
+    DetachedPart part{element.id, graph_.edgeType(element.firstEdge), 0, 0., 0.};
+    for (std::size_t index = 0; index < splitParts.size(); ++index) {
+      if (index != remaining) {
+        part.nbNodes += sumOver(counts, splitParts[index]);
+        part.generation += sumOver(generations, splitParts[index]);
+        part.load += sumOver(loads, splitParts[index]);
+      }
+    }
+    parts.push_back(part);
+  };
+
+  std::vector<DetachedPart> parts;
+  for (const auto& element : elementsEdges_) {
+    const auto edge = element.firstEdge;
+    if (graph_.edgeType(edge) == Graph::EdgeType::SWITCH || element.nbEdges != 1 || !bridges.isBridge(edge) ||
+        !islands_.isInMainIsland(graph_.edgeNode1(edge))) {
+      continue;
+    }
+    const auto below = subtree(bridges.subtreeRoot(starGraph, edge));
+    addDetachedPart(element, {SplitPart{below.first, below.second, {}}, SplitPart{mainIsland.first, mainIsland.last, {below}}}, parts);
+  }
+  for (const auto& star : stars) {
+    const auto firstStarEdge = star.second;
+    const auto center = starGraph.edgeNode2(firstStarEdge);
+    if (!islands_.isInMainIsland(starGraph.edgeNode1(firstStarEdge))) {
+      continue;
+    }
+    // each winding side split by its star edge is a part, the windings still connected together form the last one
+    std::vector<SplitPart> splitParts;
+    SplitPart connected{mainIsland.first, mainIsland.last, {}};
+    for (auto edge = firstStarEdge; edge < firstStarEdge + 3; ++edge) {
+      if (!bridges.isBridge(edge)) {
+        continue;
+      }
+      if (bridges.subtreeRoot(starGraph, edge) == center) {
+        // the winding is the parent of the center in the search tree: its side is the main island without the subtree of the center
+        const auto centerSubtree = subtree(center);
+        splitParts.push_back(SplitPart{mainIsland.first, mainIsland.last, {centerSubtree}});
+        connected.first = centerSubtree.first;
+        connected.last = centerSubtree.second;
+      } else {
+        const auto windingSubtree = subtree(bridges.subtreeRoot(starGraph, edge));
+        splitParts.push_back(SplitPart{windingSubtree.first, windingSubtree.second, {}});
+        connected.excluded.push_back(windingSubtree);
+      }
+    }
+    if (splitParts.empty()) {
+      continue;
+    }
+    if (sumOver(counts, connected) > 0) {
+      splitParts.push_back(connected);
+    }
+    addDetachedPart(*star.first, splitParts, parts);
+  }
+  std::sort(parts.begin(), parts.end(), [](const DetachedPart& lhs, const DetachedPart& rhs) { return lhs.branchId < rhs.branchId; });
+  LOG(debug) << "Network contains " << parts.size() << " branches detaching a part of the main island" << LOG_ENDL;
+  return parts;
+}
+
+bool
+NetworkManager::setSwitchOpen(const common::Symbol& switchId, bool isOpen) {
+  const auto position = elementsIndex_.find(switchId);
+  if (position == common::SymbolIndex::npos || graph_.edgeType(elementsEdges_[position].firstEdge) != Graph::EdgeType::SWITCH) {
+    throw std::out_of_range("Switch " + switchId.str() + " not found in network");
+  }
+  const auto edge = elementsEdges_[position].firstEdge;
+  if (!graph_.setEdgeOpen(edge, isOpen)) {
+    return false;
+  }
+  islands_.update(graph_, edge);
+  extractEquipment(false);
+  LOG(debug) << "Switch " << switchId << (isOpen ? " opened" : " closed") << ", network contains " << islands_.nbIslands() << " islands" << LOG_ENDL;
+  return true;
+}
+
+bool
+NetworkManager::disconnectBranch(const common::Symbol& branchId) {
+  const auto position = elementsIndex_.find(branchId);
+  if (position == common::SymbolIndex::npos || graph_.edgeType(elementsEdges_[position].firstEdge) == Graph::EdgeType::SWITCH) {
+    throw std::out_of_range("Branch " + branchId.str() + " not found in network");
+  }
+  bool changed = false;
+  const auto& edges = elementsEdges_[position];
+  for (auto edge = edges.firstEdge; edge < edges.firstEdge + edges.nbEdges; ++edge) {
+    if (graph_.setEdgeOpen(edge, true)) {
+      islands_.update(graph_, edge);
+      changed = true;
+    }
+  }
+  if (!changed) {
+    return false;
+  }
+  extractEquipment(false);
+
+  // the branch is no longer seen from its nodes
+  for (auto edge = edges.firstEdge; edge < edges.firstEdge + edges.nbEdges; ++edge) {
+    for (auto index : {graph_.edgeNode1(edge), graph_.edgeNode2(edge)}) {
+      auto& lines = nodes_[index]->lines;
+      lines.erase(std::remove_if(lines.begin(), lines.end(), [&branchId](const Line* line) { return line->id == branchId; }), lines.end());
+      auto& tfos = nodes_[index]->tfos;
+      tfos.erase(std::remove_if(tfos.begin(), tfos.end(), [&branchId](const Tfo* tfo) { return tfo->id == branchId; }), tfos.end());
+    }
+  }
+  LOG(debug) << "Branch " << branchId << " disconnected, network contains " << islands_.nbIslands() << " islands" << LOG_ENDL;
+  return true;
+}
+
+bool
+NetworkManager::disconnectInjection(const common::Symbol& injectionId) {
+  if (disconnectedInjections_.count(injectionId) > 0) {
+    return false;
+  }
+  const auto position = injectionsIndex_.find(injectionId);
+  if (position == common::SymbolIndex::npos) {
+    // the equipment outside the main island is not extracted yet: it is removed from the pending equipment
+    const auto& id = injectionId.str();
+    auto isGenerator = [&id](const PendingEquipment<DYN::GeneratorInterface>& generator) { return generator.second->getID() == id; };
+    auto isSvarc = [&id](const PendingEquipment<DYN::StaticVarCompensatorInterface>& svarc) { return svarc.second->getID() == id; };
+    const auto generators = takeIf(pendingGenerators_, isGenerator);
+    const auto svarcs = takeIf(pendingSvarcs_, isSvarc);
+    if (!generators.empty() || !svarcs.empty()) {
+      disconnectedInjections_.insert(injectionId);
+      LOG(debug) << "Injection " << injectionId << " disconnected outside the main island" << LOG_ENDL;
+      return true;
+    }
+    // generators and static var compensators extracted without a model have nothing to remove from the node tree
+    if (unmodelledInjections_.erase(injectionId) > 0) {
+      disconnectedInjections_.insert(injectionId);
+      LOG(debug) << "Injection " << injectionId << " disconnected, not modelled" << LOG_ENDL;
+      return true;
+    }
+    throw std::out_of_range("Injection " + injectionId.str() + " not found in network");
+  }
+  const auto& node = nodes_[position];
+  if (removeById(node->loads, injectionId) || removeById(node->svarcs, injectionId)) {
+    disconnectedInjections_.insert(injectionId);
+    LOG(debug) << "Injection " << injectionId << " disconnected from node " << node->id << LOG_ENDL;
+    return true;
+  }
+
+  const auto& ids = generators_.ids();
+  auto generator =
+      std::find_if(node->generators.begin(), node->generators.end(), [&ids, &injectionId](GeneratorTable::Index row) { return ids[row] == injectionId; });
+  if (generator == node->generators.end()) {
+    throw std::out_of_range("Injection " + injectionId.str() + " not found in node " + node->id.str());
+  }
+  disconnectedInjections_.insert(injectionId);
+  const auto regulatedBus = generators_.regulatedBusIds()[*generator];
+  node->generators.erase(generator);
+  auto isRegulationOf = [&injectionId](const PendingRegulation& regulation) { return regulation.elementId == injectionId; };
+  if (!takeIf(pendingRegulations_, isRegulationOf).empty()) {
+    // extracted outside the main island from the network cache: its regulated bus is not counted
+    LOG(debug) << "Generator " << injectionId << " disconnected from node " << node->id << LOG_ENDL;
+    return true;
+  }
+
+  // the generators regulating the same bus are counted again only if there were several of them
+  auto found = mapBusGeneratorsBusId_.find(regulatedBus);
+  if (found != mapBusGeneratorsBusId_.end() && found->second == NbOfRegulating::ONE) {
+    mapBusGeneratorsBusId_.erase(found);
+  } else if (found != mapBusGeneratorsBusId_.end()) {
+    const auto& regulatedBusIds = generators_.regulatedBusIds();
+    std::size_t nbRegulating = 0;
+    for (const auto& otherNode : nodes_) {
+      nbRegulating += std::count_if(otherNode->generators.begin(), otherNode->generators.end(),
+                                    [&regulatedBusIds, &regulatedBus](GeneratorTable::Index row) { return regulatedBusIds[row] == regulatedBus; });
+    }
+    nbRegulating -= std::count_if(pendingRegulations_.begin(), pendingRegulations_.end(), [&regulatedBus](const PendingRegulation& regulation) {
+      return !regulation.isVSCConverter && regulation.regulatedBus == regulatedBus;
+    });
+    found->second = NbOfRegulating::MULTIPLES;
+    if (nbRegulating == 1) {
+      found->second = NbOfRegulating::ONE;
+    }
+  }
+  LOG(debug) << "Generator " << injectionId << " disconnected from node " << node->id << LOG_ENDL;
+  return true;
+}
+
+void
+NetworkManager::addMemoryFootprint(common::MemoryFootprint& footprint) const {
+  using common::memory::sharedVectorBytes;
+  using common::memory::smallVectorBytes;
+  using common::memory::vectorBytes;
+
+  footprint.add("network.nodes", nodes_.size(), sharedVectorBytes(nodes_, [](const Node& node) {
+    return smallVectorBytes(node.shunts) + smallVectorBytes(node.lines) + smallVectorBytes(node.tfos) + smallVectorBytes(node.loads) +
+           smallVectorBytes(node.generators) + smallVectorBytes(node.converters) + smallVectorBytes(node.svarcs);
+  }));
+  footprint.add("network.voltageLevels", voltagelevels_.size(),
+                sharedVectorBytes(voltagelevels_, [](const VoltageLevel& voltageLevel) { return vectorBytes(voltageLevel.nodes); }));
+  footprint.add("network.lines", lines_.size(), sharedVectorBytes(lines_, [](const Line& line) { return common::memory::stringBytes(line.activeSeason); }));
+  footprint.add("network.transformers", tfos_.size(), sharedVectorBytes(tfos_, [](const Tfo& tfo) { return vectorBytes(tfo.nodes); }));
+  footprint.add("network.hvdcLines", hvdcLines_.size(), sharedVectorBytes(hvdcLines_, [](const HvdcLine&) { return std::size_t{0}; }));
+  footprint.add("network.converters", converters_.size(), converters_.size() * sizeof(Converter));
+  footprint.add("network.generators", generators_.size(), generators_.memoryBytes());
+  footprint.add("network.reactiveCurves", curves_.size(), curves_.memoryBytes());
+  footprint.add("network.graph", graph_.nbEdges(), graph_.memoryBytes());
+  footprint.add("network.islands", islands_.nbIslands(), islands_.memoryBytes());
+  footprint.add("network.indexes", nodesIndex_.size() + elementsIndex_.size() + injectionsIndex_.size(),
+                nodesIndex_.memoryBytes() + vectorBytes(nodeAliases_) + elementsIndex_.memoryBytes() + injectionsIndex_.memoryBytes() +
+                    vectorBytes(elementsEdges_) + vectorBytes(sortedNodes_) + common::memory::hashBytes(unmodelledInjections_) +
+                    common::memory::hashBytes(disconnectedInjections_));
+  footprint.add("network.pendingEquipment", nbPendingEquipment(),
+                vectorBytes(pendingGenerators_) + vectorBytes(pendingSvarcs_) + vectorBytes(pendingHvdcLines_));
+  footprint.add("network.regulatedBuses", mapBusGeneratorsBusId_.size() + mapBusVSCConvertersBusId_.size(),
+                common::memory::hashBytes(mapBusGeneratorsBusId_) + common::memory::hashBytes(mapBusVSCConvertersBusId_) +
+                    vectorBytes(pendingRegulations_));
 }
 
 }  // namespace inputs
@@ -0,0 +1,430 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NetworkPrescan.cpp
+ *
+ * @brief Topology pre-scan of a network file implementation file
+ *
+ */
+
+#include "NetworkPrescan.h"
+
+#include "DecompressedFile.h"
+#include "Log.h"
+
+#include <DYNCommon.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <libxml/parser.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace dfl {
+namespace inputs {
+
+/// @brief Extremity of a branch or connection point of a generator, as written in the network file
+struct Terminal {
+  std::string voltageLevelId;  ///< id of the voltage level
+  std::string busId;           ///< id of the bus, for bus-breaker voltage levels
+  long node = -1;              ///< node number, for node-breaker voltage levels
+};
+
+/// @brief Voltage level of the network file
+struct PrescanVoltageLevel {
+  std::shared_ptr<VoltageLevel> voltageLevel;  ///< voltage level
+  double nominalVoltage = 0.;                  ///< nominal voltage
+  bool isNodeBreaker = false;                  ///< topology kind of the voltage level
+  std::vector<std::string> busIds;             ///< ids of the buses, for bus-breaker voltage levels
+  std::vector<std::size_t> parents;            ///< union-find of the nodes connected by closed switches, for node-breaker voltage levels
+  std::vector<Graph::NodeIndex> nodeIndexes;   ///< graph node of each node, for node-breaker voltage levels
+};
+
+/**
+ * @brief SAX handler of the pre-scan
+ *
+ * Elements are identified by their local name, so that all the versions of the IIDM namespace are accepted
+ */
+class PrescanHandler {
+ public:
+  /**
+   * @brief Build the graph once the whole file is read
+   *
+   * Throws a std::runtime_error if a branch or a generator refers to an unknown bus
+   *
+   * @param regulatingNodes the nodes holding a regulating generator, by node index, to fill
+   * @param voltageLevels the voltage levels owning the nodes, to fill
+   * @returns the graph
+   */
+  Graph build(std::vector<bool>& regulatingNodes, std::vector<std::shared_ptr<VoltageLevel>>& voltageLevels);
+
+  /**
+   * @brief Process the start of an element
+   *
+   * @param name the local name of the element
+   * @param nbAttributes the number of attributes
+   * @param attributes the attributes, as libxml2 (local name, prefix, URI, value, end) tuples
+   */
+  void startElement(const char* name, int nbAttributes, const xmlChar** attributes);
+
+  /**
+   * @brief Process the end of an element
+   *
+   * @param name the local name of the element
+   */
+  void endElement(const char* name);
+
+ private:
+  /// @brief Branch between terminals
+  struct Branch {
+    Graph::EdgeType type;             ///< type of the branch
+    std::vector<Terminal> terminals;  ///< terminals of the branch
+  };
+
+  /**
+   * @brief Find an attribute of the current element
+   *
+   * @param name the name of the attribute
+   * @returns the value of the attribute, or an empty string if the element has no such attribute
+   */
+  std::string attribute(const char* name) const;
+
+  /**
+   * @brief Retrieve the terminal of an element
+   *
+   * @param index the index of the terminal, 0 for elements with a single terminal, 1, 2 or 3 for branches
+   * @param terminal the terminal to fill
+   * @returns @b true if the terminal is connected, @b false if not
+   */
+  bool terminal(unsigned int index, Terminal& terminal) const;
+
+  /**
+   * @brief Retrieve the root of a node of a node-breaker voltage level, growing the union-find if needed
+   *
+   * @param vl the voltage level
+   * @param node the node number
+   * @returns the root node
+   */
+  static std::size_t root(PrescanVoltageLevel& vl, std::size_t node);
+
+  /**
+   * @brief Retrieve the graph node of a terminal
+   *
+   * @param terminal the terminal
+   * @returns the index of the node in the graph
+   */
+  Graph::NodeIndex nodeOf(const Terminal& terminal);
+
+ private:
+  int nbAttributes_ = 0;                                              ///< number of attributes of the current element
+  const xmlChar** attributes_ = nullptr;                              ///< attributes of the current element
+  std::vector<PrescanVoltageLevel> voltageLevels_;                    ///< voltage levels, in file order
+  std::unordered_map<std::string, std::size_t> voltageLevelIndexes_;  ///< positions of the voltage levels by id
+  PrescanVoltageLevel* currentVoltageLevel_ = nullptr;                ///< voltage level being read
+  bool inBusBreakerTopology_ = false;                                 ///< whether the bus-breaker topology of the voltage level is being read
+  bool inNodeBreakerTopology_ = false;                                ///< whether the node-breaker topology of the voltage level is being read
+  std::vector<Branch> branches_;                                      ///< closed switches and connected lines and transformers
+  std::vector<Terminal> regulatingGenerators_;                        ///< terminals of the regulating generators
+  std::unordered_map<std::string, Graph::NodeIndex> busIndexes_;      ///< graph nodes of the buses by id
+};
+
+std::string
+PrescanHandler::attribute(const char* name) const {
+  for (int i = 0; i < nbAttributes_; ++i) {
+    const xmlChar** attribute = attributes_ + 5 * i;
+    if (std::strcmp(reinterpret_cast<const char*>(attribute[0]), name) == 0) {
+      return std::string(reinterpret_cast<const char*>(attribute[3]), reinterpret_cast<const char*>(attribute[4]));
+    }
+  }
+  return std::string();
+}
+
+bool
+PrescanHandler::terminal(unsigned int index, Terminal& terminal) const {
+  const std::string suffix = (index == 0) ? "" : std::to_string(index);
+  terminal.voltageLevelId = (index == 0) ? currentVoltageLevel_->voltageLevel->id.str() : attribute(("voltageLevelId" + suffix).c_str());
+  terminal.busId = attribute(("bus" + suffix).c_str());
+  const auto node = attribute(("node" + suffix).c_str());
+  terminal.node = node.empty() ? -1 : std::strtol(node.c_str(), nullptr, 10);
+  // in node-breaker voltage levels, the connection state depends on the switches: the terminal is considered connected
+  return !terminal.busId.empty() || terminal.node >= 0;
+}
+
+std::size_t
+PrescanHandler::root(PrescanVoltageLevel& vl, std::size_t node) {
+  while (vl.parents.size() <= node) {
+    vl.parents.push_back(vl.parents.size());
+  }
+  while (vl.parents[node] != node) {
+    vl.parents[node] = vl.parents[vl.parents[node]];
+    node = vl.parents[node];
+  }
+  return node;
+}
+
+void
+PrescanHandler::startElement(const char* name, int nbAttributes, const xmlChar** attributes) {
+  nbAttributes_ = nbAttributes;
+  attributes_ = attributes;
+
+  if (std::strcmp(name, "voltageLevel") == 0) {
+    const auto id = attribute("id");
+    voltageLevelIndexes_[id] = voltageLevels_.size();
+    voltageLevels_.emplace_back();
+    currentVoltageLevel_ = &voltageLevels_.back();
+    currentVoltageLevel_->voltageLevel = std::make_shared<VoltageLevel>(id);
+    currentVoltageLevel_->nominalVoltage = std::strtod(attribute("nominalV").c_str(), nullptr);
+    currentVoltageLevel_->isNodeBreaker = attribute("topologyKind") == "NODE_BREAKER";
+  } else if (currentVoltageLevel_ == nullptr) {
+    // branches are outside of the voltage levels
+    Branch branch{Graph::EdgeType::LINE, {}};
+    unsigned int nbTerminals = 0;
+    if (std::strcmp(name, "line") == 0 || std::strcmp(name, "tieLine") == 0) {
+      nbTerminals = 2;
+    } else if (std::strcmp(name, "twoWindingsTransformer") == 0) {
+      branch.type = Graph::EdgeType::TFO;
+      nbTerminals = 2;
+    } else if (std::strcmp(name, "threeWindingsTransformer") == 0) {
+      branch.type = Graph::EdgeType::TFO;
+      nbTerminals = 3;
+    }
+    for (unsigned int i = 1; i <= nbTerminals; ++i) {
+      Terminal branchTerminal;
+      if (!terminal(i, branchTerminal)) {
+        return;
+      }
+      branch.terminals.push_back(branchTerminal);
+    }
+    if (nbTerminals > 0) {
+      branches_.push_back(branch);
+    }
+  } else if (std::strcmp(name, "busBreakerTopology") == 0) {
+    inBusBreakerTopology_ = true;
+  } else if (std::strcmp(name, "nodeBreakerTopology") == 0) {
+    inNodeBreakerTopology_ = true;
+  } else if (inBusBreakerTopology_ && std::strcmp(name, "bus") == 0) {
+    currentVoltageLevel_->busIds.push_back(attribute("id"));
+  } else if (inBusBreakerTopology_ && std::strcmp(name, "switch") == 0) {
+    if (attribute("open") != "true") {
+      Branch branch{Graph::EdgeType::SWITCH, std::vector<Terminal>(2)};
+      branch.terminals[0].busId = attribute("bus1");
+      branch.terminals[1].busId = attribute("bus2");
+      branches_.push_back(branch);
+    }
+  } else if (inNodeBreakerTopology_ && (std::strcmp(name, "switch") == 0 || std::strcmp(name, "internalConnection") == 0)) {
+    if (attribute("open") != "true") {
+      const auto root1 = root(*currentVoltageLevel_, std::strtoul(attribute("node1").c_str(), nullptr, 10));
+      const auto root2 = root(*currentVoltageLevel_, std::strtoul(attribute("node2").c_str(), nullptr, 10));
+      // the smallest node is the root, so that merged nodes are named after it
+      currentVoltageLevel_->parents[std::max(root1, root2)] = std::min(root1, root2);
+    }
+  } else if (std::strcmp(name, "generator") == 0) {
+    Terminal generatorTerminal;
+    if (terminal(0, generatorTerminal) && attribute("voltageRegulatorOn") == "true") {
+      const auto targetP = std::strtod(attribute("targetP").c_str(), nullptr);
+      const auto pmin = std::strtod(attribute("minP").c_str(), nullptr);
+      const auto pmax = std::strtod(attribute("maxP").c_str(), nullptr);
+      // same criteria as the network manager
+      if ((DYN::doubleEquals(-targetP, pmin) || -targetP > pmin) && (DYN::doubleEquals(-targetP, pmax) || -targetP < pmax)) {
+        regulatingGenerators_.push_back(generatorTerminal);
+      }
+    }
+  }
+}
+
+void
+PrescanHandler::endElement(const char* name) {
+  if (std::strcmp(name, "voltageLevel") == 0) {
+    currentVoltageLevel_ = nullptr;
+  } else if (std::strcmp(name, "busBreakerTopology") == 0) {
+    inBusBreakerTopology_ = false;
+  } else if (std::strcmp(name, "nodeBreakerTopology") == 0) {
+    inNodeBreakerTopology_ = false;
+  }
+}
+
+Graph::NodeIndex
+PrescanHandler::nodeOf(const Terminal& terminal) {
+  if (!terminal.busId.empty()) {
+    auto found = busIndexes_.find(terminal.busId);
+    if (found == busIndexes_.end()) {
+      throw std::runtime_error("Bus " + terminal.busId + " not found in network file");
+    }
+    return found->second;
+  }
+
+  auto found = voltageLevelIndexes_.find(terminal.voltageLevelId);
+  if (found == voltageLevelIndexes_.end() || !voltageLevels_[found->second].isNodeBreaker) {
+    throw std::runtime_error("Node " + std::to_string(terminal.node) + " of voltage level " + terminal.voltageLevelId + " not found in network file");
+  }
+  auto& vl = voltageLevels_[found->second];
+  const auto node = static_cast<std::size_t>(terminal.node);
+  if (node >= vl.nodeIndexes.size()) {
+    throw std::runtime_error("Node " + std::to_string(terminal.node) + " of voltage level " + terminal.voltageLevelId + " not found in network file");
+  }
+  return vl.nodeIndexes[root(vl, node)];
+}
+
+Graph
+PrescanHandler::build(std::vector<bool>& regulatingNodes, std::vector<std::shared_ptr<VoltageLevel>>& voltageLevels) {
+  Graph::Builder builder;
+  for (auto& vl : voltageLevels_) {
+    if (vl.isNodeBreaker) {
+      // nodes referenced only by the equipments are not in the topology: they are added here
+      for (const auto& branch : branches_) {
+        for (const auto& terminal : branch.terminals) {
+          if (terminal.busId.empty() && terminal.voltageLevelId == vl.voltageLevel->id.str()) {
+            root(vl, static_cast<std::size_t>(terminal.node));
+          }
+        }
+      }
+      for (const auto& terminal : regulatingGenerators_) {
+        if (terminal.busId.empty() && terminal.voltageLevelId == vl.voltageLevel->id.str()) {
+          root(vl, static_cast<std::size_t>(terminal.node));
+        }
+      }
+
+      vl.nodeIndexes.assign(vl.parents.size(), 0);
+      for (std::size_t node = 0; node < vl.parents.size(); ++node) {
+        if (root(vl, node) == node) {
+          vl.nodeIndexes[node] = builder.addNode(Node::build(vl.voltageLevel->id.str() + "_" + std::to_string(node), vl.voltageLevel, vl.nominalVoltage, {}));
+        }
+      }
+    } else {
+      for (const auto& busId : vl.busIds) {
+        busIndexes_[busId] = builder.addNode(Node::build(busId, vl.voltageLevel, vl.nominalVoltage, {}));
+      }
+    }
+  }
+
+  for (const auto& branch : branches_) {
+    std::vector<Graph::NodeIndex> nodes;
+    for (const auto& terminal : branch.terminals) {
+      nodes.push_back(nodeOf(terminal));
+    }
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+      for (std::size_t j = i + 1; j < nodes.size(); ++j) {
+        builder.addEdge(nodes[i], nodes[j], branch.type);
+      }
+    }
+  }
+
+  auto graph = builder.build();
+  regulatingNodes.assign(graph.nbNodes(), false);
+  for (const auto& terminal : regulatingGenerators_) {
+    regulatingNodes[nodeOf(terminal)] = true;
+  }
+  for (const auto& vl : voltageLevels_) {
+    voltageLevels.push_back(vl.voltageLevel);
+  }
+  return graph;
+}
+
+/// @brief Parsing context given to the libxml2 callbacks
+struct PrescanContext {
+  PrescanHandler handler;   ///< SAX handler
+  xmlParserCtxtPtr parser;  ///< libxml2 parser, to stop it on error
+  std::string error;        ///< error raised by the handler, empty if none
+};
+
+/**
+ * @brief libxml2 callback for the start of an element
+ *
+ * The exceptions are not propagated through libxml2: the parser is stopped and the error is kept in the context
+ */
+static void
+onStartElement(void* ctx, const xmlChar* localname, const xmlChar*, const xmlChar*, int, const xmlChar**, int nbAttributes, int, const xmlChar** attributes) {
+  auto context = static_cast<PrescanContext*>(ctx);
+  try {
+    context->handler.startElement(reinterpret_cast<const char*>(localname), nbAttributes, attributes);
+  } catch (const std::exception& e) {
+    context->error = e.what();
+    xmlStopParser(context->parser);
+  }
+}
+
+/**
+ * @brief libxml2 callback for the end of an element
+ */
+static void
+onEndElement(void* ctx, const xmlChar* localname, const xmlChar*, const xmlChar*) {
+  static_cast<PrescanContext*>(ctx)->handler.endElement(reinterpret_cast<const char*>(localname));
+}
+
+/**
+ * @brief libxml2 callback for errors and warnings, which are reported by the exception thrown at the end of the parsing
+ */
+static void
+ignoreMessage(void*, const char*, ...) {}
+
+NetworkPrescan::NetworkPrescan(const boost::filesystem::path& filepath, unsigned int nbThreads) :
+    voltageLevels_{},
+    graph_{},
+    islands_{},
+    regulatingNodes_{} {
+  xmlSAXHandler sax;
+  std::memset(&sax, 0, sizeof(sax));
+  sax.initialized = XML_SAX2_MAGIC;
+  sax.startElementNs = &onStartElement;
+  sax.endElementNs = &onEndElement;
+  sax.warning = &ignoreMessage;
+  sax.error = &ignoreMessage;
+
+  PrescanContext context;
+  std::unique_ptr<xmlParserCtxt, void (*)(xmlParserCtxtPtr)> parser(
+      xmlCreatePushParserCtxt(&sax, &context, nullptr, 0, filepath.generic_string().c_str()), &xmlFreeParserCtxt);
+  if (!parser) {
+    throw std::runtime_error("Cannot create the parser of " + filepath.generic_string());
+  }
+  xmlCtxtUseOptions(parser.get(), XML_PARSE_NONET | XML_PARSE_HUGE);
+  context.parser = parser.get();
+
+  // the file is parsed while it is read and decompressed, without being fully loaded in memory
+  DecompressedFile::read(filepath, [&parser, &context](const char* data, std::size_t size) {
+    if (context.error.empty() && parser->wellFormed) {
+      xmlParseChunk(parser.get(), data, static_cast<int>(size), 0);
+    }
+  });
+  if (context.error.empty() && parser->wellFormed) {
+    xmlParseChunk(parser.get(), nullptr, 0, 1);
+  }
+  if (!context.error.empty()) {
+    throw std::runtime_error("Cannot pre-scan " + filepath.generic_string() + ": " + context.error);
+  }
+  if (!parser->wellFormed) {
+    const auto error = xmlCtxtGetLastError(parser.get());
+    throw std::runtime_error("Cannot pre-scan " + filepath.generic_string() + ": " + ((error && error->message) ? error->message : "malformed file"));
+  }
+
+  graph_ = context.handler.build(regulatingNodes_, voltageLevels_);
+  islands_ = Islands::compute(graph_, nbThreads);
+  LOG(debug) << "Network pre-scan: " << graph_.nbNodes() << " nodes, " << graph_.nbEdges() << " edges, " << islands_.nbIslands() << " islands" << LOG_ENDL;
+}
+
+bool
+NetworkPrescan::hasAnyRegulatingGenerator() const {
+  return std::find(regulatingNodes_.begin(), regulatingNodes_.end(), true) != regulatingNodes_.end();
+}
+
+bool
+NetworkPrescan::hasRegulatingGeneratorInMainIsland() const {
+  for (Graph::NodeIndex index = 0; index < graph_.nbNodes(); ++index) {
+    if (regulatingNodes_[index] && islands_.isInMainIsland(index)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace inputs
+}  // namespace dfl
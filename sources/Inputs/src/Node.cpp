@@ -21,18 +21,19 @@ namespace dfl {
 namespace inputs {
 
 std::shared_ptr<Node>
-Node::build(const NodeId& id, const std::shared_ptr<VoltageLevel>& vl, double nominalVoltage, const std::vector<Shunt>& shunts) {
-  auto ret = std::shared_ptr<Node>(new Node(id, vl, nominalVoltage, shunts));
-  vl->nodes.push_back(ret);
+Node::build(const NodeId& id, const std::shared_ptr<VoltageLevel>& vl, double nominalVoltage, const std::vector<Shunt>& shunts,
+            const std::shared_ptr<common::Arena>& arena) {
+  auto ret = common::makeSharedWith<Node>(arena, [&](void* memory) { return new (memory) Node(id, vl, nominalVoltage, shunts); });
+  vl->nodes.push_back(ret.get());
   return ret;
 }
 
 Node::Node(const NodeId& idNode, const std::shared_ptr<VoltageLevel> vl, double nominalVoltageNode, const std::vector<Shunt>& shunts) :
     id(idNode),
-    voltageLevel(vl),
+    index{0},
+    voltageLevel(vl.get()),
     nominalVoltage{nominalVoltageNode},
-    shunts(shunts),
-    neighbours{} {}
+    shunts(shunts) {}
 
 bool
 operator==(const Node& lhs, const Node& rhs) {
@@ -71,17 +72,16 @@ VoltageLevel::VoltageLevel(const VoltageLevelId& vlid) : id(vlid) {}
 /////////////////////////////////////////////////
 
 std::shared_ptr<Line>
-Line::build(const LineId& lineId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2, const std::string& season) {
-  auto ret = std::shared_ptr<Line>(new Line(lineId, node1, node2, season));
+Line::build(const LineId& lineId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2, const std::string& season,
+            const std::shared_ptr<common::Arena>& arena) {
+  auto ret = common::makeSharedWith<Line>(arena, [&](void* memory) { return new (memory) Line(lineId, node1, node2, season); });
 
   // Nodes existence is checked outside the builder
   assert(node1);
   assert(node2);
 
-  node1->neighbours.push_back(node2);
-  node2->neighbours.push_back(node1);
-  node1->lines.push_back(ret);
-  node2->lines.push_back(ret);
+  node1->lines.push_back(ret.get());
+  node2->lines.push_back(ret.get());
 
   return ret;
 }
@@ -89,57 +89,46 @@ Line::build(const LineId& lineId, const std::shared_ptr<Node>& node1, const std:
 Line::Line(const LineId& lineId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2, const std::string& season) :
     id(lineId),
     activeSeason(season),
-    nodes{node1, node2} {}
+    nodes{{node1.get(), node2.get()}} {}
 
 ///////////////////////////////////////////////////
 
 std::shared_ptr<Tfo>
-Tfo::build(const TfoId& tfoId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2) {
-  auto ret = std::shared_ptr<Tfo>(new Tfo(tfoId, node1, node2));
+Tfo::build(const TfoId& tfoId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2, const std::shared_ptr<common::Arena>& arena) {
+  auto ret = common::makeSharedWith<Tfo>(arena, [&](void* memory) { return new (memory) Tfo(tfoId, node1, node2); });
 
   // Nodes existence is checked outside the builder
   assert(node1);
   assert(node2);
 
-  node1->neighbours.push_back(node2);
-  node2->neighbours.push_back(node1);
-
-  node1->tfos.push_back(ret);
-  node2->tfos.push_back(ret);
+  node1->tfos.push_back(ret.get());
+  node2->tfos.push_back(ret.get());
 
   return ret;
 }
 
 std::shared_ptr<Tfo>
-Tfo::build(const TfoId& tfoId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2, const std::shared_ptr<Node>& node3) {
-  auto ret = std::shared_ptr<Tfo>(new Tfo(tfoId, node1, node2, node3));
+Tfo::build(const TfoId& tfoId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2, const std::shared_ptr<Node>& node3,
+           const std::shared_ptr<common::Arena>& arena) {
+  auto ret = common::makeSharedWith<Tfo>(arena, [&](void* memory) { return new (memory) Tfo(tfoId, node1, node2, node3); });
 
   // Nodes existence is checked outside the builder
   assert(node1);
   assert(node2);
   assert(node3);
 
-  node1->neighbours.push_back(node2);
-  node1->neighbours.push_back(node3);
-
-  node2->neighbours.push_back(node1);
-  node2->neighbours.push_back(node3);
-
-  node3->neighbours.push_back(node1);
-  node3->neighbours.push_back(node2);
-
-  node1->tfos.push_back(ret);
-  node2->tfos.push_back(ret);
-  node3->tfos.push_back(ret);
+  node1->tfos.push_back(ret.get());
+  node2->tfos.push_back(ret.get());
+  node3->tfos.push_back(ret.get());
 
   return ret;
 }
 
-Tfo::Tfo(const TfoId& tfoId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2) : id(tfoId), nodes{node1, node2} {}
+Tfo::Tfo(const TfoId& tfoId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2) : id(tfoId), nodes{node1.get(), node2.get()} {}
 
 Tfo::Tfo(const TfoId& tfoId, const std::shared_ptr<Node>& node1, const std::shared_ptr<Node>& node2, const std::shared_ptr<Node>& node3) :
     id(tfoId),
-    nodes{node1, node2, node3} {}
+    nodes{node1.get(), node2.get(), node3.get()} {}
 
 }  // namespace inputs
 }  // namespace dfl
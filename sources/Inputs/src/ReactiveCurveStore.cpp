@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ReactiveCurveStore.cpp
+ *
+ * @brief Shared reactive capability curve store implementation file
+ *
+ */
+
+#include "ReactiveCurveStore.h"
+
+#include "MemoryFootprint.h"
+
+#include <algorithm>
+#include <boost/functional/hash.hpp>
+
+namespace dfl {
+namespace inputs {
+
+constexpr ReactiveCurveStore::CurveId ReactiveCurveStore::emptyCurve;
+
+ReactiveCurveStore::CurveId
+ReactiveCurveStore::add(std::vector<ReactiveCurvePoint> points) {
+  if (points.empty()) {
+    return emptyCurve;
+  }
+  std::stable_sort(points.begin(), points.end(), [](const ReactiveCurvePoint& lhs, const ReactiveCurvePoint& rhs) { return lhs.p < rhs.p; });
+
+  auto samePoint = [](const ReactiveCurvePoint& lhs, const ReactiveCurvePoint& rhs) { return lhs.p == rhs.p && lhs.qmin == rhs.qmin && lhs.qmax == rhs.qmax; };
+  const auto key = hash(points);
+  const auto range = curvesByHash_.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    const auto existing = this->points(it->second);
+    if (existing.size() == points.size() && std::equal(existing.begin(), existing.end(), points.begin(), samePoint)) {
+      return it->second;
+    }
+  }
+
+  const auto curve = static_cast<CurveId>(size());
+  points_.insert(points_.end(), points.begin(), points.end());
+  offsets_.push_back(static_cast<std::uint32_t>(points_.size()));
+  curvesByHash_.emplace(key, curve);
+  return curve;
+}
+
+void
+ReactiveCurveStore::clear() {
+  offsets_.assign(2, 0);
+  points_.clear();
+  curvesByHash_.clear();
+}
+
+std::size_t
+ReactiveCurveStore::memoryBytes() const {
+  return common::memory::vectorBytes(offsets_) + common::memory::vectorBytes(points_) + common::memory::hashBytes(curvesByHash_);
+}
+
+std::size_t
+ReactiveCurveStore::hash(const std::vector<ReactiveCurvePoint>& points) {
+  std::size_t seed = 0;
+  for (const auto& point : points) {
+    boost::hash_combine(seed, point.p);
+    boost::hash_combine(seed, point.qmin);
+    boost::hash_combine(seed, point.qmax);
+  }
+  return seed;
+}
+
+}  // namespace inputs
+}  // namespace dfl
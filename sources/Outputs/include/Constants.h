@@ -61,6 +61,8 @@ std::string diagramFilename(const std::string& id);
 
 const std::string loadParId{"GenericRestorativeLoad"};                            ///< PAR id common to all loads
 const std::string diagramDirectorySuffix{"_Diagram"};                             ///< Suffix for the diagram directory
+const std::string islandingFileSuffix{"_islanding.csv"};                          ///< Suffix for the islanding report file
+const std::string fingerprintFileSuffix{".fingerprint"};                          ///< Suffix for the file of the fingerprint of the outputs
 const std::string diagramMaxTableSuffix{"_tableqmax"};                            ///< Suffix for the table name for qmax in diagram file
 const std::string diagramMinTableSuffix{"_tableqmin"};                            ///< Suffix for the table name for qmin in diagram file
 const std::string signalNGeneratorParId{"signalNGenerator"};                      ///< PAR id for generators using signal N
@@ -19,6 +19,7 @@
 
 #include "Algo.h"
 
+#include <boost/filesystem.hpp>
 #include <string>
 #include <vector>
 namespace dfl {
@@ -38,21 +39,23 @@ class Diagram {
      *
      * @param base the basename for current file (corresponds to filepath basename)
      * @param directoryPath the directory path of the diagram files to write
-     * @param gens generators definition coming from algorithms
+     * @param gens generator definitions coming from algorithms
      * @param hvdcDefinitions the HVDC definitions to used
+     * @param curves the reactive capability curves referenced by the generators and the VSC converters
      */
-    DiagramDefinition(const std::string& base, const std::string& directoryPath, const std::vector<algo::GeneratorDefinition>& gens,
-                      const algo::HVDCLineDefinitions& hvdcDefinitions) :
+    DiagramDefinition(const std::string& base, const std::string& directoryPath, const algo::GeneratorDefinitions& gens,
+                      const algo::HVDCLineDefinitions& hvdcDefinitions, const inputs::ReactiveCurveStore& curves) :
         basename(base),
         directoryPath(directoryPath),
         generators(gens),
-        hvdcDefinitions(hvdcDefinitions) {}
+        hvdcDefinitions(hvdcDefinitions),
+        curves(curves) {}
 
-    const std::string basename;       ///< basename for file
-    const std::string directoryPath;  ///< directory path for files to write
-    // non const copies instead of const references because we need to modify them before use
-    std::vector<algo::GeneratorDefinition> generators;  ///< generators found
-    algo::HVDCLineDefinitions hvdcDefinitions;          ///< HVDC definitions
+    const std::string basename;                        ///< basename for file
+    const std::string directoryPath;                   ///< directory path for files to write
+    const algo::GeneratorDefinitions& generators;      ///< generators found
+    const algo::HVDCLineDefinitions& hvdcDefinitions;  ///< HVDC definitions
+    const inputs::ReactiveCurveStore& curves;          ///< reactive capability curves, already sorted by the store
   };
 
   /**
@@ -67,6 +70,13 @@ class Diagram {
    */
   void write() const;
 
+  /**
+   * @brief Retrieve the paths of the diagram files written by the writer
+   *
+   * @returns the paths of the diagram files, in the directory of the definition
+   */
+  std::vector<boost::filesystem::path> filepaths() const;
+
  private:
   /// @brief Different tables in the diagram, qmin or qmax
   enum class Tables {
@@ -74,33 +84,31 @@ class Diagram {
     TABLE_QMAX       ///< Table Qmax
   };
 
-  /// @brief LCC definition used to write diagrams files
-  struct LCCDefinition {
-    algo::HVDCDefinition::ConverterId id;                          ///< id
-    std::vector<inputs::VSCConverter::ReactiveCurvePoint> points;  ///< Reactive curve points (always empty for LCC)
-    double pmax;                                                   ///< maximum p
-    double qmax;                                                   ///< maximum q
-    double pmin;                                                   ///< minimum p
-    double qmin;                                                   ///< minimum q
+  /// @brief Element (generator or converter) definition used to write diagrams files
+  struct ElementDiagramDefinition {
+    const common::Symbol& id;                   ///< id
+    inputs::ReactiveCurveStore::Points points;  ///< Reactive curve points, sorted by active power (always empty for LCC)
+    double pmax;                                ///< maximum p
+    double qmax;                                ///< maximum q
+    double pmin;                                ///< minimum p
+    double qmin;                                ///< minimum q
   };
 
   /**
    * @brief Write a single table in the Diagram file
    *
-   * the type T requires to have:
-   * - a field "id" (string)
-   * - a vector of reactive curve points field "points"
-   * - a double field "pmax"
-   * - a double field "qmax"
-   * - a double field "pmin"
-   * - a double field "qmin"
-   *
    * @param element The element that will be used to write the diagram values
    * @param buffer The buffer to store the string that will be written to the file
    * @param table The enum determining if we write the Qmin or Qmax table
    */
-  template<class T>
-  static void writeTable(const T& element, std::stringstream& buffer, Tables table);
+  static void writeTable(const ElementDiagramDefinition& element, std::stringstream& buffer, Tables table);
+
+  /**
+   * @brief Write the diagram file of an element
+   *
+   * @param element The element that will be used to write the diagram values
+   */
+  void writeElement(const ElementDiagramDefinition& element) const;
 
   /// @brief Write generator diagrams
   void writeGenerators() const;
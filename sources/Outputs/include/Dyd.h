@@ -39,7 +39,7 @@ namespace std {
  * see https://en.cppreference.com/w/cpp/utility/hash for template definition
  */
 template<>
-struct hash<dfl::algo::GeneratorDefinition::ModelType> {
+struct hash<dfl::algo::GeneratorDefinitions::ModelType> {
   /// @brief Constructor
   hash() {}
   /**
@@ -50,7 +50,7 @@ struct hash<dfl::algo::GeneratorDefinition::ModelType> {
    * @param key the key to hash
    * @returns the hash value
    */
-  size_t operator()(const dfl::algo::GeneratorDefinition::ModelType& key) const {
+  size_t operator()(const dfl::algo::GeneratorDefinitions::ModelType& key) const {
     return hash<unsigned int>{}(static_cast<unsigned int>(key));
   }
 };
@@ -96,7 +96,7 @@ class Dyd {
      *
      * @param base the basename for current file (corresponds to filepath basename)
      * @param filepath the filepath of the dyd file to write
-     * @param gens generators definition coming from algorithms
+     * @param gens generator definitions coming from algorithms
      * @param loaddefs load definitions coming from algorithms
      * @param slacknode the slack node to use
      * @param hvdcDefinitions hvdc definitions coming from algorithms
@@ -105,7 +105,7 @@ class Dyd {
      * @param models the list of dynamic models to use
      * @param svarcsDefinitions the SVarC definitions to use
      */
-    DydDefinition(const std::string& base, const std::string& filepath, const std::vector<algo::GeneratorDefinition>& gens,
+    DydDefinition(const std::string& base, const std::string& filepath, const algo::GeneratorDefinitions& gens,
                   const std::vector<algo::LoadDefinition>& loaddefs, const std::shared_ptr<inputs::Node>& slacknode,
                   const algo::HVDCLineDefinitions& hvdcDefinitions, const algo::GeneratorDefinitionAlgorithm::BusGenMap& busesWithDynamicModel,
                   const inputs::DynamicDataBaseManager& dynamicDataBaseManager, const algo::DynamicModelDefinitions& models,
@@ -123,7 +123,7 @@ class Dyd {
 
     std::string basename;                                                        ///< basename for file
     std::string filename;                                                        ///< filepath for file to write
-    std::vector<algo::GeneratorDefinition> generators;                           ///< generators found
+    const algo::GeneratorDefinitions& generators;                                ///< generators found
     std::vector<algo::LoadDefinition> loads;                                     ///< list of loads
     std::shared_ptr<inputs::Node> slackNode;                                     ///< slack node to use
     const algo::HVDCLineDefinitions& hvdcDefinitions;                            ///< list of hvdc definitions
@@ -159,12 +159,14 @@ class Dyd {
   /**
    * @brief Create black box model for generator
    *
-   * @param def generator definition to use
+   * @param generators generator definitions
+   * @param index the index of the generator to use in the definitions
    * @param basename basename for file
    *
    * @returns black box model for generator
    */
-  static boost::shared_ptr<dynamicdata::BlackBoxModel> writeGenerator(const algo::GeneratorDefinition& def, const std::string& basename);
+  static boost::shared_ptr<dynamicdata::BlackBoxModel> writeGenerator(const algo::GeneratorDefinitions& generators, std::size_t index,
+                                                                      const std::string& basename);
 
   /**
    * @brief Create black box model for remote voltage regulators
@@ -229,21 +231,23 @@ class Dyd {
    *
    * Use macro connection
    *
-   * @param def the generator definition to process
-   * @param index the index of the generator in the global list of generators
+   * @param generators generator definitions
+   * @param index the index of the generator to process in the definitions
    *
    * @returns the macro connection element
    */
-  static std::vector<boost::shared_ptr<dynamicdata::MacroConnect>> writeGenMacroConnect(const algo::GeneratorDefinition& def, unsigned int index);
+  static std::vector<boost::shared_ptr<dynamicdata::MacroConnect>> writeGenMacroConnect(const algo::GeneratorDefinitions& generators, std::size_t index);
 
   /**
    * @brief Write connection for generators
    *
    * @param dynamicModelsToConnect the collection where the connections will be added
-   * @param def the generator definition to process
+   * @param generators generator definitions
+   * @param index the index of the generator to process in the definitions
    *
    */
-  static void writeGenConnect(const boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect, const algo::GeneratorDefinition& def);
+  static void writeGenConnect(const boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect,
+                              const algo::GeneratorDefinitions& generators, std::size_t index);
 
   /**
    * @brief Write connections for remote voltage regulators
@@ -303,9 +307,9 @@ class Dyd {
   static boost::shared_ptr<dynamicdata::MacroConnect> writeSVarCMacroConnect(const inputs::StaticVarCompensator& svarc);
 
  private:
-  static const std::unordered_map<algo::GeneratorDefinition::ModelType, std::string>
+  static const std::unordered_map<algo::GeneratorDefinitions::ModelType, std::string>
       correspondence_lib_;  ///< Correspondance between generator model type and library name in dyd file
-  static const std::unordered_map<algo::GeneratorDefinition::ModelType, std::string>
+  static const std::unordered_map<algo::GeneratorDefinitions::ModelType, std::string>
       correspondence_macro_connector_;  ///< Correspondence between generator model type and macro connector name in dyd file
   static const std::unordered_map<algo::HVDCDefinition::HVDCModel, std::string>
       hvdcModelsNames_;                                          ///< Correspondence between HVDC model and their library name in dyd file
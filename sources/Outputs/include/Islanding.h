@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Islanding.h
+ *
+ * @brief Islanding report writer header file
+ *
+ */
+
+#pragma once
+
+#include "NetworkManager.h"
+
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Islanding report writer
+ *
+ * Writes, for each branch whose outage detaches a part of the main connex component, the size, generation and load of the detached part,
+ * as a semicolon separated table
+ */
+class Islanding {
+ public:
+  /**
+   * @brief Islanding definition to provide informations to build the islanding report
+   */
+  struct IslandingDefinition {
+    /**
+     * @brief Constructor
+     *
+     * @param filepath the filepath of the report to write
+     * @param parts the parts of the main connex component detached by branch outages
+     */
+    IslandingDefinition(const std::string& filepath, const std::vector<inputs::NetworkManager::DetachedPart>& parts) : filepath(filepath), parts(parts) {}
+
+    const std::string filepath;                                     ///< filepath of the report to write
+    const std::vector<inputs::NetworkManager::DetachedPart> parts;  ///< detached parts, by branch
+  };
+
+  /**
+   * @brief Constructor
+   *
+   * @param def the islanding definition
+   */
+  explicit Islanding(IslandingDefinition&& def);
+
+  /**
+   * @brief Write the islanding report
+   */
+  void write() const;
+
+ private:
+  IslandingDefinition def_;  ///< islanding report information
+};
+
+}  // namespace outputs
+}  // namespace dfl
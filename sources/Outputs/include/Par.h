@@ -60,7 +60,7 @@ class Par {
      * @param svarcsDefinitions the SVarC definitions to use
      */
     ParDefinition(const std::string& base, const boost::filesystem::path& dir, const boost::filesystem::path& filename,
-                  const std::vector<algo::GeneratorDefinition>& gens, const algo::HVDCLineDefinitions& hvdcDefinitions,
+                  const algo::GeneratorDefinitions& gens, const algo::HVDCLineDefinitions& hvdcDefinitions,
                   inputs::Configuration::ActivePowerCompensation activePowerCompensation,
                   const algo::GeneratorDefinitionAlgorithm::BusGenMap& busesWithDynamicModel, const inputs::DynamicDataBaseManager& dynamicDataBaseManager,
                   const algo::ShuntCounterDefinitions& counters, const algo::DynamicModelDefinitions& models, const algo::LinesByIdDefinitions& linesById,
@@ -81,7 +81,7 @@ class Par {
     std::string basename;                                                         ///< basename
     boost::filesystem::path dirname;                                              ///< Dirname of output file relative to execution dir
     boost::filesystem::path filepath;                                             ///< file path of the output file to write
-    std::vector<algo::GeneratorDefinition> generators;                            ///< list of generators
+    const algo::GeneratorDefinitions& generators;                                 ///< list of generators
     const algo::HVDCLineDefinitions& hvdcDefinitions;                             ///< HVDC definitions
     dfl::inputs::Configuration::ActivePowerCompensation activePowerCompensation;  ///< the type of active power compensation
     const algo::GeneratorDefinitionAlgorithm::BusGenMap& busesWithDynamicModel;   ///< map of bus ids to a generator that regulates them
@@ -115,7 +115,7 @@ class Par {
     * @returns the parameter set
     */
   static boost::shared_ptr<parameters::ParametersSet> writeConstantGeneratorsSets(dfl::inputs::Configuration::ActivePowerCompensation activePowerCompensation,
-                                                                                  dfl::algo::GeneratorDefinition::ModelType modelType, bool fixedP);
+                                                                                  dfl::algo::GeneratorDefinitions::ModelType modelType, bool fixedP);
 
   /**
     * @brief Write constants parameter sets for load
@@ -144,14 +144,15 @@ class Par {
   /**
    * @brief Write generator parameter set
    *
-   * @param def the generator definition to use
+   * @param generators the generator definitions
+   * @param index the index of the generator to use in the definitions
    * @param basename the basename for the simulation
    * @param dirname the dirname of the output directory
    *
    * @returns the parameter set
    */
-  static boost::shared_ptr<parameters::ParametersSet> writeGenerator(const algo::GeneratorDefinition& def, const std::string& basename,
-                                                                     const boost::filesystem::path& dirname);
+  static boost::shared_ptr<parameters::ParametersSet> writeGenerator(const algo::GeneratorDefinitions& generators, std::size_t index,
+                                                                     const std::string& basename, const boost::filesystem::path& dirname);
   /**
    * @brief Write hvdc line parameter set
    *
@@ -21,21 +21,12 @@
 
 #include <boost/filesystem.hpp>
 #include <fstream>
+#include <utility>
 
 namespace dfl {
 namespace outputs {
 
-Diagram::Diagram(DiagramDefinition&& def) : def_{std::forward<DiagramDefinition>(def)} {
-  for (auto& generator : def_.generators) {
-    std::sort(generator.points.begin(), generator.points.end(),
-              [](const DYN::GeneratorInterface::ReactiveCurvePoint& lhs, const DYN::GeneratorInterface::ReactiveCurvePoint& rhs) { return lhs.p < rhs.p; });
-  }
-  for (auto& vscPair : def_.hvdcDefinitions.vscBusVSCDefinitionsMap) {
-    auto& points = vscPair.second.points;
-    std::sort(points.begin(), points.end(),
-              [](const algo::VSCDefinition::ReactiveCurvePoint& lhs, const algo::VSCDefinition::ReactiveCurvePoint& rhs) { return lhs.p < rhs.p; });
-  }
-}
+Diagram::Diagram(DiagramDefinition&& def) : def_{std::forward<DiagramDefinition>(def)} {}
 
 void
 Diagram::write() const {
@@ -45,47 +36,29 @@ Diagram::write() const {
 
 void
 Diagram::writeGenerators() const {
-  for (const auto& generator : def_.generators) {
-    if (!generator.isUsingDiagram())
+  const auto& generators = def_.generators;
+  const auto& table = generators.table;
+  for (std::size_t i = 0; i < generators.size(); ++i) {
+    if (!algo::GeneratorDefinitions::isUsingDiagram(generators.models[i]))
       continue;
-    if (!boost::filesystem::exists(def_.directoryPath)) {
-      boost::filesystem::create_directories(def_.directoryPath);
-    }
-
-    std::stringstream buffer;
-    //  Modelica requires this file to start with "#1", if it is not present, problems occurs
-    buffer << "#1";
-
-    writeTable(generator, buffer, Tables::TABLE_QMIN);
-    writeTable(generator, buffer, Tables::TABLE_QMAX);
-    boost::filesystem::path dir(def_.directoryPath);
-    std::string filename = dir.append(outputs::constants::diagramFilename(generator.id)).generic_string();
-    std::ofstream ofs(filename, std::ofstream::out);
-    ofs << buffer.str();
-    ofs.close();
+    const auto row = generators.rows[i];
+    writeElement({table.ids()[row], def_.curves.points(table.curveIds()[row]), table.pmax()[row], table.qmax()[row], table.pmin()[row], table.qmin()[row]});
   }
 }
 
 void
 Diagram::writeVSC(const algo::VSCDefinition& vscDefinition) const {
-  if (!boost::filesystem::exists(def_.directoryPath)) {
-    boost::filesystem::create_directories(def_.directoryPath);
-  }
-  std::stringstream buffer;
-  //  Modelica requires this file to start with "#1", if it is not present, problems occurs
-  buffer << "#1";
-
-  writeTable(vscDefinition, buffer, Tables::TABLE_QMIN);
-  writeTable(vscDefinition, buffer, Tables::TABLE_QMAX);
-  boost::filesystem::path dir(def_.directoryPath);
-  std::string filename = dir.append(outputs::constants::diagramFilename(vscDefinition.id)).generic_string();
-  std::ofstream ofs(filename, std::ofstream::out);
-  ofs << buffer.str();
-  ofs.close();
+  writeElement({vscDefinition.id, def_.curves.points(vscDefinition.curve), vscDefinition.pmax, vscDefinition.qmax, vscDefinition.pmin, vscDefinition.qmin});
 }
 
 void
 Diagram::writeLCC(const algo::HVDCDefinition::ConverterId& converterId, double powerFactor, double pMax) const {
+  auto qMax = constants::computeQmax(powerFactor, pMax);
+  writeElement({converterId, def_.curves.points(inputs::ReactiveCurveStore::emptyCurve), pMax, qMax, -pMax, -qMax});
+}
+
+void
+Diagram::writeElement(const ElementDiagramDefinition& element) const {
   if (!boost::filesystem::exists(def_.directoryPath)) {
     boost::filesystem::create_directories(def_.directoryPath);
   }
@@ -93,69 +66,93 @@ Diagram::writeLCC(const algo::HVDCDefinition::ConverterId& converterId, double p
   //  Modelica requires this file to start with "#1", if it is not present, problems occurs
   buffer << "#1";
 
-  auto qMax = constants::computeQmax(powerFactor, pMax);
-  LCCDefinition lccDefinition{converterId, {}, pMax, qMax, -pMax, -qMax};
-
-  writeTable(lccDefinition, buffer, Tables::TABLE_QMIN);
-  writeTable(lccDefinition, buffer, Tables::TABLE_QMAX);
+  writeTable(element, buffer, Tables::TABLE_QMIN);
+  writeTable(element, buffer, Tables::TABLE_QMAX);
   boost::filesystem::path dir(def_.directoryPath);
-  std::string filename = dir.append(outputs::constants::diagramFilename(converterId)).generic_string();
+  std::string filename = dir.append(outputs::constants::diagramFilename(element.id.str())).generic_string();
   std::ofstream ofs(filename, std::ofstream::out);
   ofs << buffer.str();
   ofs.close();
 }
 
+/**
+ * @brief Determine which converters of an hvdc line have a diagram file
+ *
+ * @param hvdcDef the definition of the hvdc line
+ * @returns whether the first and the second converters have a diagram file
+ */
+static std::pair<bool, bool>
+convertersWithDiagram(const algo::HVDCDefinition& hvdcDef) {
+  if (!hvdcDef.hasDiagramModel()) {
+    return std::make_pair(false, false);
+  }
+  switch (hvdcDef.position) {
+  case algo::HVDCDefinition::Position::FIRST_IN_MAIN_COMPONENT:
+    return std::make_pair(true, false);
+  case algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT:
+    return std::make_pair(false, true);
+  case algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT:
+    return std::make_pair(true, true);
+  default:  // impossible case by definition of the enum
+    return std::make_pair(false, false);
+  }
+}
+
 void
 Diagram::writeConverters() const {
   for (const auto& hvdcDefPair : def_.hvdcDefinitions.hvdcLines) {
     const auto& hvdcDef = hvdcDefPair.second;
-    if (!hvdcDef.hasDiagramModel()) {
-      continue;
-    }
+    const auto converters = convertersWithDiagram(hvdcDef);
 
     // The presence of vscDefinitions and the relevance of powerFactors array is guaranteed according the type of HVDC line
-
-    switch (hvdcDef.position) {
-    case algo::HVDCDefinition::Position::FIRST_IN_MAIN_COMPONENT: {
+    if (converters.first) {
       if (hvdcDef.vscDefinition1) {
         writeVSC(*hvdcDef.vscDefinition1);
       } else {
         writeLCC(hvdcDef.converter1Id, hvdcDef.powerFactors.at(0), hvdcDef.pMax);
       }
-      break;
     }
-    case algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT: {
+    if (converters.second) {
       if (hvdcDef.vscDefinition2) {
         writeVSC(*hvdcDef.vscDefinition2);
       } else {
         writeLCC(hvdcDef.converter2Id, hvdcDef.powerFactors.at(1), hvdcDef.pMax);
       }
-      break;
     }
-    case algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT: {
-      if (hvdcDef.vscDefinition1) {
-        writeVSC(*hvdcDef.vscDefinition1);
-      } else {
-        writeLCC(hvdcDef.converter1Id, hvdcDef.powerFactors.at(0), hvdcDef.pMax);
-      }
-      if (hvdcDef.vscDefinition2) {
-        writeVSC(*hvdcDef.vscDefinition2);
-      } else {
-        writeLCC(hvdcDef.converter2Id, hvdcDef.powerFactors.at(1), hvdcDef.pMax);
-      }
-      break;
+  }
+}
+
+std::vector<boost::filesystem::path>
+Diagram::filepaths() const {
+  std::vector<boost::filesystem::path> filepaths;
+  auto addFilepath = [this, &filepaths](const common::Symbol& id) {
+    boost::filesystem::path filepath(def_.directoryPath);
+    filepaths.push_back(filepath.append(outputs::constants::diagramFilename(id.str())));
+  };
+
+  const auto& generators = def_.generators;
+  for (std::size_t i = 0; i < generators.size(); ++i) {
+    if (algo::GeneratorDefinitions::isUsingDiagram(generators.models[i])) {
+      addFilepath(generators.table.ids()[generators.rows[i]]);
+    }
+  }
+  for (const auto& hvdcDefPair : def_.hvdcDefinitions.hvdcLines) {
+    const auto& hvdcDef = hvdcDefPair.second;
+    const auto converters = convertersWithDiagram(hvdcDef);
+    if (converters.first) {
+      addFilepath(hvdcDef.vscDefinition1 ? hvdcDef.vscDefinition1->id : hvdcDef.converter1Id);
     }
-    default:  // impossible case by definition of the enum
-      break;
+    if (converters.second) {
+      addFilepath(hvdcDef.vscDefinition2 ? hvdcDef.vscDefinition2->id : hvdcDef.converter2Id);
     }
   }
+  return filepaths;
 }
 
-template<class T>
 void
-Diagram::writeTable(const T& element, std::stringstream& buffer, Tables table) {
+Diagram::writeTable(const ElementDiagramDefinition& element, std::stringstream& buffer, Tables table) {
   buffer << "\ndouble ";
-  std::size_t hash = constants::hash(element.id);
+  std::size_t hash = constants::hash(element.id.str());
   buffer << hash;
   if (table == Tables::TABLE_QMIN)
     buffer << constants::diagramMinTableSuffix << '(';
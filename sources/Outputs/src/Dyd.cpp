@@ -36,13 +36,13 @@
 namespace dfl {
 namespace outputs {
 
-const std::unordered_map<algo::GeneratorDefinition::ModelType, std::string> Dyd::correspondence_lib_ = {
-    std::make_pair(algo::GeneratorDefinition::ModelType::SIGNALN, "GeneratorPVSignalN"),
-    std::make_pair(algo::GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "GeneratorPVDiagramPQSignalN"),
-    std::make_pair(algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN, "GeneratorPVRemoteSignalN"),
-    std::make_pair(algo::GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "GeneratorPVRemoteDiagramPQSignalN"),
-    std::make_pair(algo::GeneratorDefinition::ModelType::PROP_SIGNALN, "GeneratorPQPropSignalN"),
-    std::make_pair(algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "GeneratorPQPropDiagramPQSignalN")};
+const std::unordered_map<algo::GeneratorDefinitions::ModelType, std::string> Dyd::correspondence_lib_ = {
+    std::make_pair(algo::GeneratorDefinitions::ModelType::SIGNALN, "GeneratorPVSignalN"),
+    std::make_pair(algo::GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN, "GeneratorPVDiagramPQSignalN"),
+    std::make_pair(algo::GeneratorDefinitions::ModelType::REMOTE_SIGNALN, "GeneratorPVRemoteSignalN"),
+    std::make_pair(algo::GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "GeneratorPVRemoteDiagramPQSignalN"),
+    std::make_pair(algo::GeneratorDefinitions::ModelType::PROP_SIGNALN, "GeneratorPQPropSignalN"),
+    std::make_pair(algo::GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "GeneratorPQPropDiagramPQSignalN")};
 
 const std::string Dyd::macroConnectorLoadName_("LOAD_NETWORK_CONNECTOR");
 const std::string Dyd::macroConnectorGenName_("GEN_NETWORK_CONNECTOR");
@@ -55,13 +55,13 @@ const std::string Dyd::macroConnectorSVarCName_("StaticVarCompensatorMacroConnec
 const std::string Dyd::macroStaticRefLoadName_("LoadRef");
 const std::string Dyd::modelSignalNQprefix_("Model_Signal_NQ_");
 
-const std::unordered_map<algo::GeneratorDefinition::ModelType, std::string> Dyd::correspondence_macro_connector_ = {
-    std::make_pair(algo::GeneratorDefinition::ModelType::SIGNALN, macroConnectorGenName_),
-    std::make_pair(algo::GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, macroConnectorGenName_),
-    std::make_pair(algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN, macroConnectorGenName_),
-    std::make_pair(algo::GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, macroConnectorGenName_),
-    std::make_pair(algo::GeneratorDefinition::ModelType::PROP_SIGNALN, macroConnectorGenName_),
-    std::make_pair(algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN, macroConnectorGenName_)};
+const std::unordered_map<algo::GeneratorDefinitions::ModelType, std::string> Dyd::correspondence_macro_connector_ = {
+    std::make_pair(algo::GeneratorDefinitions::ModelType::SIGNALN, macroConnectorGenName_),
+    std::make_pair(algo::GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN, macroConnectorGenName_),
+    std::make_pair(algo::GeneratorDefinitions::ModelType::REMOTE_SIGNALN, macroConnectorGenName_),
+    std::make_pair(algo::GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, macroConnectorGenName_),
+    std::make_pair(algo::GeneratorDefinitions::ModelType::PROP_SIGNALN, macroConnectorGenName_),
+    std::make_pair(algo::GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN, macroConnectorGenName_)};
 
 const std::unordered_map<algo::HVDCDefinition::HVDCModel, std::string> Dyd::hvdcModelsNames_ = {
     std::make_pair(algo::HVDCDefinition::HVDCModel::HvdcPTanPhi, "HvdcPTanPhi"),
@@ -121,20 +121,20 @@ Dyd::write() const {
   for (const auto& const_model : const_models) {
     dynamicModelsToConnect->addModel(const_model);
   }
-  for (const auto& generator : def_.generators) {
-    dynamicModelsToConnect->addModel(writeGenerator(generator, def_.basename));
+  for (std::size_t i = 0; i < def_.generators.size(); ++i) {
+    dynamicModelsToConnect->addModel(writeGenerator(def_.generators, i, def_.basename));
   }
   for (const auto& keyValue : def_.hvdcDefinitions.hvdcLines) {
     dynamicModelsToConnect->addModel(writeHvdcLine(keyValue.second, def_.basename));
     writeHvdcLineConnect(dynamicModelsToConnect, keyValue.second);
   }
   for (const auto& keyValue : def_.busesWithDynamicModel) {
-    dynamicModelsToConnect->addModel(writeVRRemote(keyValue.first, def_.basename));
-    writeVRRemoteConnect(dynamicModelsToConnect, keyValue.first);
+    dynamicModelsToConnect->addModel(writeVRRemote(keyValue.first.str(), def_.basename));
+    writeVRRemoteConnect(dynamicModelsToConnect, keyValue.first.str());
   }
   for (const auto& keyValue : def_.hvdcDefinitions.vscBusVSCDefinitionsMap) {
-    dynamicModelsToConnect->addModel(writeVRRemote(keyValue.first, def_.basename));
-    writeVRRemoteConnect(dynamicModelsToConnect, keyValue.first);
+    dynamicModelsToConnect->addModel(writeVRRemote(keyValue.first.str(), def_.basename));
+    writeVRRemoteConnect(dynamicModelsToConnect, keyValue.first.str());
   }
   for (const auto& model : def_.dynamicModelsDefinitions.models) {
     dynamicModelsToConnect->addModel(writeDynamicModel(model.second, def_.basename));
@@ -149,11 +149,11 @@ Dyd::write() const {
     dynamicModelsToConnect->addMacroConnect(writeSVarCMacroConnect(svarc));
   }
 
-  dynamicModelsToConnect->addConnect(signalNModelName_, "signalN_thetaRef", "NETWORK", def_.slackNode->id + "_phi");
+  dynamicModelsToConnect->addConnect(signalNModelName_, "signalN_thetaRef", "NETWORK", def_.slackNode->id.str() + "_phi");
 
-  for (auto it = def_.generators.cbegin(); it != def_.generators.cend(); ++it) {
-    writeGenConnect(dynamicModelsToConnect, *it);
-    auto connections = writeGenMacroConnect(*it, static_cast<unsigned int>(it - def_.generators.cbegin()));
+  for (std::size_t i = 0; i < def_.generators.size(); ++i) {
+    writeGenConnect(dynamicModelsToConnect, def_.generators, i);
+    auto connections = writeGenMacroConnect(def_.generators, i);
     for (const auto& connection : connections) {
       dynamicModelsToConnect->addMacroConnect(connection);
     }
@@ -215,7 +215,7 @@ Dyd::writeDynamicModelMacroConnect(const algo::DynamicModelDefinition& dynModel)
 
   for (const auto& connection : connections) {
     auto macroConnect = dynamicdata::MacroConnectFactory::newMacroConnect(connection.id, dynModel.id, networkModelName_);
-    macroConnect->setName2(connection.connectedElementId);
+    macroConnect->setName2(connection.connectedElementId.str());
 #if _DEBUG_
     assert(std::get<INDEXES_CURRENT_INDEX>(indexes.at(connection.id)) < std::get<INDEXES_NB_CONNECTIONS>(indexes.at(connection.id)));
 #endif
@@ -240,12 +240,12 @@ Dyd::writeVRRemote(const std::string& busId, const std::string& basename) {
 
 boost::shared_ptr<dynamicdata::BlackBoxModel>
 Dyd::writeHvdcLine(const algo::HVDCDefinition& hvdcLine, const std::string& basename) {
-  auto model = dynamicdata::BlackBoxModelFactory::newModel(hvdcLine.id);
+  auto model = dynamicdata::BlackBoxModelFactory::newModel(hvdcLine.id.str());
 
-  model->setStaticId(hvdcLine.id);
+  model->setStaticId(hvdcLine.id.str());
   model->setLib(hvdcModelsNames_.at(hvdcLine.model));
   model->setParFile(basename + ".par");
-  model->setParId(hvdcLine.id);
+  model->setParId(hvdcLine.id.str());
   if (hvdcLine.position == algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT) {
     model->addStaticRef("hvdc_PInj1Pu", "p2");
     model->addStaticRef("hvdc_QInj1Pu", "q2");
@@ -268,9 +268,9 @@ Dyd::writeHvdcLine(const algo::HVDCDefinition& hvdcLine, const std::string& base
 
 boost::shared_ptr<dynamicdata::BlackBoxModel>
 Dyd::writeLoad(const algo::LoadDefinition& load, const std::string& basename) {
-  auto model = dynamicdata::BlackBoxModelFactory::newModel(load.id);
+  auto model = dynamicdata::BlackBoxModelFactory::newModel(load.id.str());
 
-  model->setStaticId(load.id);
+  model->setStaticId(load.id.str());
   model->setLib("DYNModelLoadRestorativeWithLimits");
   model->setParFile(basename + ".par");
   model->setParId(constants::loadParId);
@@ -280,28 +280,31 @@ Dyd::writeLoad(const algo::LoadDefinition& load, const std::string& basename) {
 }
 
 boost::shared_ptr<dynamicdata::BlackBoxModel>
-Dyd::writeGenerator(const algo::GeneratorDefinition& def, const std::string& basename) {
-  auto model = dynamicdata::BlackBoxModelFactory::newModel(def.id);
+Dyd::writeGenerator(const algo::GeneratorDefinitions& generators, std::size_t index, const std::string& basename) {
+  const auto row = generators.rows[index];
+  const auto& id = generators.table.ids()[row];
+  const auto modelType = generators.models[index];
+  auto model = dynamicdata::BlackBoxModelFactory::newModel(id.str());
   std::string parId;
-  switch (def.model) {
-  case algo::GeneratorDefinition::ModelType::SIGNALN:
-    parId = (DYN::doubleIsZero(def.targetP)) ? constants::signalNGeneratorFixedPParId : constants::signalNGeneratorParId;
+  switch (modelType) {
+  case algo::GeneratorDefinitions::ModelType::SIGNALN:
+    parId = (DYN::doubleIsZero(generators.table.targetP()[row])) ? constants::signalNGeneratorFixedPParId : constants::signalNGeneratorParId;
     break;
-  case algo::GeneratorDefinition::ModelType::PROP_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::PROP_SIGNALN:
     parId = constants::propSignalNGeneratorParId;
     break;
-  case algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::REMOTE_SIGNALN:
     parId = constants::remoteVControlParId;
     break;
   default:
-    std::size_t hashId = constants::hash(def.id);
+    std::size_t hashId = constants::hash(id.str());
     std::string hashIdStr = std::to_string(hashId);
     parId = hashIdStr;
     break;
   }
 
-  model->setStaticId(def.id);
-  model->setLib(correspondence_lib_.at(def.model));
+  model->setStaticId(id.str());
+  model->setLib(correspondence_lib_.at(modelType));
   model->setParFile(basename + ".par");
   model->setParId(parId);
   model->addMacroStaticRef(dynamicdata::MacroStaticRefFactory::newMacroStaticRef(macroStaticRefSignalNGeneratorName_));
@@ -310,12 +313,12 @@ Dyd::writeGenerator(const algo::GeneratorDefinition& def, const std::string& bas
 
 boost::shared_ptr<dynamicdata::BlackBoxModel>
 Dyd::writeSVarC(const inputs::StaticVarCompensator& svarc, const std::string& basename) {
-  auto model = dynamicdata::BlackBoxModelFactory::newModel(svarc.id);
+  auto model = dynamicdata::BlackBoxModelFactory::newModel(svarc.id.str());
 
-  model->setStaticId(svarc.id);
+  model->setStaticId(svarc.id.str());
   model->setLib("StaticVarCompensatorPV");
   model->setParFile(basename + ".par");
-  model->setParId(svarc.id);
+  model->setParId(svarc.id.str());
   model->addMacroStaticRef(dynamicdata::MacroStaticRefFactory::newMacroStaticRef(macroStaticRefSVarCName_));
 
   return model;
@@ -388,28 +391,35 @@ Dyd::writeMacroStaticRef() {
 
 boost::shared_ptr<dynamicdata::MacroConnect>
 Dyd::writeLoadConnect(const algo::LoadDefinition& loaddef) {
-  return dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorLoadName_, loaddef.id, networkModelName_);
+  return dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorLoadName_, loaddef.id.str(), networkModelName_);
 }
 
 std::vector<boost::shared_ptr<dynamicdata::MacroConnect>>
-Dyd::writeGenMacroConnect(const algo::GeneratorDefinition& def, unsigned int index) {
-  auto connection = dynamicdata::MacroConnectFactory::newMacroConnect(correspondence_macro_connector_.at(def.model), def.id, networkModelName_);
-  auto signal = dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorGenSignalNName_, def.id, signalNModelName_);
+Dyd::writeGenMacroConnect(const algo::GeneratorDefinitions& generators, std::size_t index) {
+  const auto& id = generators.table.ids()[generators.rows[index]];
+  auto connection =
+      dynamicdata::MacroConnectFactory::newMacroConnect(correspondence_macro_connector_.at(generators.models[index]), id.str(), networkModelName_);
+  auto signal = dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorGenSignalNName_, id.str(), signalNModelName_);
   signal->setIndex2(std::to_string(index));
   return {connection, signal};
 }
 
 boost::shared_ptr<dynamicdata::MacroConnect>
 Dyd::writeSVarCMacroConnect(const inputs::StaticVarCompensator& svarc) {
-  return dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorSVarCName_, svarc.id, networkModelName_);
+  return dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorSVarCName_, svarc.id.str(), networkModelName_);
 }
 
 void
-Dyd::writeGenConnect(const boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect, const algo::GeneratorDefinition& def) {
-  if (def.model == algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN || def.model == algo::GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN) {
-    dynamicModelsToConnect->addConnect(def.id, "generator_URegulated", "NETWORK", def.regulatedBusId + "_U_value");
-  } else if (def.model == algo::GeneratorDefinition::ModelType::PROP_SIGNALN || def.model == algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN) {
-    dynamicModelsToConnect->addConnect(def.id, "generator_NQ_value", modelSignalNQprefix_ + def.regulatedBusId, "vrremote_NQ");
+Dyd::writeGenConnect(const boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect, const algo::GeneratorDefinitions& generators,
+                     std::size_t index) {
+  const auto row = generators.rows[index];
+  const auto& id = generators.table.ids()[row];
+  const auto& regulatedBusId = generators.table.regulatedBusIds()[row];
+  const auto model = generators.models[index];
+  if (model == algo::GeneratorDefinitions::ModelType::REMOTE_SIGNALN || model == algo::GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN) {
+    dynamicModelsToConnect->addConnect(id.str(), "generator_URegulated", "NETWORK", regulatedBusId.str() + "_U_value");
+  } else if (model == algo::GeneratorDefinitions::ModelType::PROP_SIGNALN || model == algo::GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN) {
+    dynamicModelsToConnect->addConnect(id.str(), "generator_NQ_value", modelSignalNQprefix_ + regulatedBusId.str(), "vrremote_NQ");
   }
 }
 
@@ -422,19 +432,19 @@ void
 Dyd::writeHvdcLineConnect(const boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect, const algo::HVDCDefinition& hvdcDefinition) {
   const std::string vrremoteNqValue("vrremote_NQ");
   if (hvdcDefinition.position == algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT) {
-    dynamicModelsToConnect->addConnect("NETWORK", hvdcDefinition.converter1BusId + "_ACPIN", hvdcDefinition.id, "hvdc_terminal2");
-    dynamicModelsToConnect->addConnect("NETWORK", hvdcDefinition.converter2BusId + "_ACPIN", hvdcDefinition.id, "hvdc_terminal1");
+    dynamicModelsToConnect->addConnect("NETWORK", hvdcDefinition.converter1BusId.str() + "_ACPIN", hvdcDefinition.id.str(), "hvdc_terminal2");
+    dynamicModelsToConnect->addConnect("NETWORK", hvdcDefinition.converter2BusId.str() + "_ACPIN", hvdcDefinition.id.str(), "hvdc_terminal1");
   } else {
     // case both : 1 <-> 1 and 2 <-> 2
-    dynamicModelsToConnect->addConnect("NETWORK", hvdcDefinition.converter1BusId + "_ACPIN", hvdcDefinition.id, "hvdc_terminal1");
-    dynamicModelsToConnect->addConnect("NETWORK", hvdcDefinition.converter2BusId + "_ACPIN", hvdcDefinition.id, "hvdc_terminal2");
+    dynamicModelsToConnect->addConnect("NETWORK", hvdcDefinition.converter1BusId.str() + "_ACPIN", hvdcDefinition.id.str(), "hvdc_terminal1");
+    dynamicModelsToConnect->addConnect("NETWORK", hvdcDefinition.converter2BusId.str() + "_ACPIN", hvdcDefinition.id.str(), "hvdc_terminal2");
   }
   if (hvdcDefinition.hasPQPropModel()) {
     const auto& busId1 =
         (hvdcDefinition.position == algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT) ? hvdcDefinition.converter2BusId : hvdcDefinition.converter1BusId;
-    dynamicModelsToConnect->addConnect(hvdcDefinition.id, "hvdc_NQ1_value", modelSignalNQprefix_ + busId1, vrremoteNqValue);
+    dynamicModelsToConnect->addConnect(hvdcDefinition.id.str(), "hvdc_NQ1_value", modelSignalNQprefix_ + busId1.str(), vrremoteNqValue);
     if (hvdcDefinition.position == algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT) {
-      dynamicModelsToConnect->addConnect(hvdcDefinition.id, "hvdc_NQ2_value", modelSignalNQprefix_ + hvdcDefinition.converter2BusId, vrremoteNqValue);
+      dynamicModelsToConnect->addConnect(hvdcDefinition.id.str(), "hvdc_NQ2_value", modelSignalNQprefix_ + hvdcDefinition.converter2BusId.str(), vrremoteNqValue);
     }
   }
 }  // namespace outputs
@@ -0,0 +1,43 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Islanding.cpp
+ *
+ * @brief Islanding report writer implementation file
+ *
+ */
+
+#include "Islanding.h"
+
+#include <fstream>
+#include <sstream>
+
+namespace dfl {
+namespace outputs {
+
+Islanding::Islanding(IslandingDefinition&& def) : def_{std::forward<IslandingDefinition>(def)} {}
+
+void
+Islanding::write() const {
+  std::stringstream buffer;
+  buffer << "BRANCH;TYPE;NB_NODES;GENERATION;LOAD\n";
+  for (const auto& part : def_.parts) {
+    buffer << part.branchId.str() << ";" << ((part.branchType == inputs::Graph::EdgeType::LINE) ? "LINE" : "TFO") << ";" << part.nbNodes << ";"
+           << part.generation << ";" << part.load << "\n";
+  }
+
+  std::ofstream ofs(def_.filepath, std::ofstream::out);
+  ofs << buffer.str();
+  ofs.close();
+}
+
+}  // namespace outputs
+}  // namespace dfl
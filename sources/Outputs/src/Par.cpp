@@ -68,15 +68,15 @@ getMacroParameterSetId(const std::string& modelType) {
 }
 
 static std::string
-getMacroParameterSetId(algo::GeneratorDefinition::ModelType modelType, bool fixedP) {
+getMacroParameterSetId(algo::GeneratorDefinitions::ModelType modelType, bool fixedP) {
   std::string id;
   switch (modelType) {
-  case algo::GeneratorDefinition::ModelType::PROP_SIGNALN:
-  case algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::PROP_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN:
     id = fixedP ? getMacroParameterSetId(constants::propSignalNGeneratorFixedPParId) : getMacroParameterSetId(constants::propSignalNGeneratorParId);
     break;
-  case algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN:
-  case algo::GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::REMOTE_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN:
     id = fixedP ? getMacroParameterSetId(constants::remoteSignalNGeneratorFixedP) : getMacroParameterSetId(constants::remoteVControlParId);
     break;
   default:
@@ -87,15 +87,15 @@ getMacroParameterSetId(algo::GeneratorDefinition::ModelType modelType, bool fixe
 }
 
 static std::string
-getGeneratorParameterSetId(algo::GeneratorDefinition::ModelType modelType, bool fixedP) {
+getGeneratorParameterSetId(algo::GeneratorDefinitions::ModelType modelType, bool fixedP) {
   std::string id;
   switch (modelType) {
-  case algo::GeneratorDefinition::ModelType::PROP_SIGNALN:
-  case algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::PROP_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN:
     id = fixedP ? constants::propSignalNGeneratorFixedPParId : constants::propSignalNGeneratorParId;
     break;
-  case algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN:
-  case algo::GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::REMOTE_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN:
     id = fixedP ? constants::remoteSignalNGeneratorFixedP : constants::remoteVControlParId;
     break;
   default:
@@ -117,7 +117,7 @@ buildMacroParameterSet(const std::string& modelType) {
 }
 
 static boost::shared_ptr<parameters::MacroParameterSet>
-buildMacroParameterSet(algo::GeneratorDefinition::ModelType modelType, inputs::Configuration::ActivePowerCompensation activePowerCompensation, bool fixedP) {
+buildMacroParameterSet(algo::GeneratorDefinitions::ModelType modelType, inputs::Configuration::ActivePowerCompensation activePowerCompensation, bool fixedP) {
   boost::shared_ptr<parameters::MacroParameterSet> macroParameterSet =
       boost::shared_ptr<parameters::MacroParameterSet>(new parameters::MacroParameterSet(getMacroParameterSetId(modelType, fixedP)));
   macroParameterSet->addReference(helper::buildReference("generator_PMin", "pMin", "DOUBLE"));
@@ -145,13 +145,13 @@ buildMacroParameterSet(algo::GeneratorDefinition::ModelType modelType, inputs::C
   }
 
   switch (modelType) {
-  case algo::GeneratorDefinition::ModelType::PROP_SIGNALN:
-  case algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::PROP_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN:
     macroParameterSet->addReference(helper::buildReference("generator_QRef0Pu", "targetQ_pu", "DOUBLE"));
     macroParameterSet->addReference(helper::buildReference("generator_QPercent", "qMax_pu", "DOUBLE"));
     break;
-  case algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN:
-  case algo::GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::REMOTE_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN:
     macroParameterSet->addReference(helper::buildReference("generator_URef0", "targetV", "DOUBLE"));
     break;
   default:
@@ -177,20 +177,21 @@ Par::write() const {
   // adding load constant parameter set
   dynamicModelsToConnect->addParametersSet(writeConstantLoadsSet());
   // loop on generators
-  for (const auto& generator : def_.generators) {
+  const auto& targetP = def_.generators.table.targetP();
+  for (std::size_t i = 0; i < def_.generators.size(); ++i) {
+    const auto model = def_.generators.models[i];
+    const bool fixedP = DYN::doubleIsZero(targetP[def_.generators.rows[i]]);
+    const bool isUsingDiagram = algo::GeneratorDefinitions::isUsingDiagram(model);
     // we check if the macroParameterSet need by generator model is not already created. If not, we create a new one
-    if (!dynamicModelsToConnect->hasMacroParametersSet(helper::getMacroParameterSetId(generator.model, DYN::doubleIsZero(generator.targetP))) &&
-        generator.isUsingDiagram()) {
-      dynamicModelsToConnect->addMacroParameterSet(
-          helper::buildMacroParameterSet(generator.model, def_.activePowerCompensation, DYN::doubleIsZero(generator.targetP)));
+    if (!dynamicModelsToConnect->hasMacroParametersSet(helper::getMacroParameterSetId(model, fixedP)) && isUsingDiagram) {
+      dynamicModelsToConnect->addMacroParameterSet(helper::buildMacroParameterSet(model, def_.activePowerCompensation, fixedP));
     }
     // if generator is not using infinite diagrams, no need to create constant sets
-    if (generator.isUsingDiagram()) {
-      dynamicModelsToConnect->addParametersSet(writeGenerator(generator, def_.basename, def_.dirname));
+    if (isUsingDiagram) {
+      dynamicModelsToConnect->addParametersSet(writeGenerator(def_.generators, i, def_.basename, def_.dirname));
     } else {
-      if (!dynamicModelsToConnect->hasParametersSet(helper::getGeneratorParameterSetId(generator.model, DYN::doubleIsZero(generator.targetP)))) {
-        dynamicModelsToConnect->addParametersSet(
-            writeConstantGeneratorsSets(def_.activePowerCompensation, generator.model, DYN::doubleIsZero(generator.targetP)));
+      if (!dynamicModelsToConnect->hasParametersSet(helper::getGeneratorParameterSetId(model, fixedP))) {
+        dynamicModelsToConnect->addParametersSet(writeConstantGeneratorsSets(def_.activePowerCompensation, model, fixedP));
       }
     }
   }
@@ -210,14 +211,14 @@ Par::write() const {
     if (!dynamicModelsToConnect->hasMacroParametersSet(helper::getMacroParameterSetId(constants::remoteVControlParId + "_vr"))) {
       dynamicModelsToConnect->addMacroParameterSet(helper::buildMacroParameterSet(helper::getMacroParameterSetId(constants::remoteVControlParId + "_vr")));
     }
-    dynamicModelsToConnect->addParametersSet(writeVRRemote(keyValue.first, keyValue.second));
+    dynamicModelsToConnect->addParametersSet(writeVRRemote(keyValue.first.str(), keyValue.second.str()));
   }
   // adding parameters sets related to remote voltage control or multiple VSC regulating same bus
   for (const auto& keyValue : def_.hvdcDefinitions.vscBusVSCDefinitionsMap) {
     if (!dynamicModelsToConnect->hasMacroParametersSet(helper::getMacroParameterSetId(constants::remoteVControlParId + "_vr"))) {
       dynamicModelsToConnect->addMacroParameterSet(helper::buildMacroParameterSet(helper::getMacroParameterSetId(constants::remoteVControlParId + "_vr")));
     }
-    dynamicModelsToConnect->addParametersSet(writeVRRemote(keyValue.first, keyValue.second.id));
+    dynamicModelsToConnect->addParametersSet(writeVRRemote(keyValue.first.str(), keyValue.second.id.str()));
   }
 
   const auto& sets = def_.dynamicDataBaseManager.settingDocument().sets();
@@ -236,7 +237,7 @@ boost::optional<std::string>
 Par::getTransformerComponentId(const algo::DynamicModelDefinition& dynModelDef) {
   for (const auto& macro : dynModelDef.nodeConnections) {
     if (macro.elementType == algo::DynamicModelDefinition::MacroConnection::ElementType::TFO) {
-      return macro.connectedElementId;
+      return macro.connectedElementId.str();
     }
   }
 
@@ -378,17 +379,17 @@ Par::updateSignalNGenerator(const std::string& modelId, dfl::inputs::Configurati
 
 boost::shared_ptr<parameters::ParametersSet>
 Par::writeConstantGeneratorsSets(dfl::inputs::Configuration::ActivePowerCompensation activePowerCompensation,
-                                 dfl::algo::GeneratorDefinition::ModelType modelType, bool fixedP) {
+                                 dfl::algo::GeneratorDefinitions::ModelType modelType, bool fixedP) {
   auto set = updateSignalNGenerator(helper::getGeneratorParameterSetId(modelType, fixedP), activePowerCompensation, fixedP);
   switch (modelType) {
-  case algo::GeneratorDefinition::ModelType::PROP_SIGNALN:
-  case algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::PROP_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN:
     updatePropParameters(set);
     break;
-  case algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN:
-  case algo::GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN:
-  case algo::GeneratorDefinition::ModelType::SIGNALN:
-  case algo::GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::REMOTE_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::SIGNALN:
+  case algo::GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN:
     break;
   }
   return set;
@@ -431,10 +432,10 @@ Par::writeHdvcLine(const algo::HVDCDefinition& hvdcDefinition, const std::string
                                                              const algo::HVDCDefinition::ConverterId& converterId, unsigned int converterNumber,
                                                              unsigned int parameterNumber) {
     constexpr double factorPU = 100;
-    std::size_t hashId = constants::hash(converterId);
+    std::size_t hashId = constants::hash(converterId.str());
     std::string hashIdStr = std::to_string(hashId);
     auto dirnameDiagramLocal = dirnameDiagram;
-    dirnameDiagramLocal.append(constants::diagramFilename(converterId));
+    dirnameDiagramLocal.append(constants::diagramFilename(converterId.str()));
     set->addParameter(helper::buildParameter("hvdc_QInj" + std::to_string(parameterNumber) + "MinTableFile", dirnameDiagramLocal.generic_string()));
     set->addParameter(helper::buildParameter("hvdc_QInj" + std::to_string(parameterNumber) + "MinTableName", hashIdStr + constants::diagramMinTableSuffix));
     set->addParameter(helper::buildParameter("hvdc_QInj" + std::to_string(parameterNumber) + "MaxTableFile", dirnameDiagramLocal.generic_string()));
@@ -451,7 +452,7 @@ Par::writeHdvcLine(const algo::HVDCDefinition& hvdcDefinition, const std::string
     }
   };
 
-  auto set = boost::shared_ptr<parameters::ParametersSet>(new parameters::ParametersSet(hvdcDefinition.id));
+  auto set = boost::shared_ptr<parameters::ParametersSet>(new parameters::ParametersSet(hvdcDefinition.id.str()));
   std::string first = "1";
   std::string second = "2";
   if (hvdcDefinition.position == dfl::algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT) {
@@ -499,14 +500,14 @@ Par::writeHdvcLine(const algo::HVDCDefinition& hvdcDefinition, const std::string
   if (hvdcDefinition.hasPQPropModel()) {
     switch (hvdcDefinition.position) {
     case dfl::algo::HVDCDefinition::Position::FIRST_IN_MAIN_COMPONENT:
-      set->addReference(helper::buildReference("hvdc_QPercent1", "qMax_pu", "DOUBLE", hvdcDefinition.converter1Id));
+      set->addReference(helper::buildReference("hvdc_QPercent1", "qMax_pu", "DOUBLE", hvdcDefinition.converter1Id.str()));
       break;
     case dfl::algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT:
-      set->addReference(helper::buildReference("hvdc_QPercent1", "qMax_pu", "DOUBLE", hvdcDefinition.converter2Id));
+      set->addReference(helper::buildReference("hvdc_QPercent1", "qMax_pu", "DOUBLE", hvdcDefinition.converter2Id.str()));
       break;
     case dfl::algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT:
-      set->addReference(helper::buildReference("hvdc_QPercent1", "qMax_pu", "DOUBLE", hvdcDefinition.converter1Id));
-      set->addReference(helper::buildReference("hvdc_QPercent2", "qMax_pu", "DOUBLE", hvdcDefinition.converter2Id));
+      set->addReference(helper::buildReference("hvdc_QPercent1", "qMax_pu", "DOUBLE", hvdcDefinition.converter1Id.str()));
+      set->addReference(helper::buildReference("hvdc_QPercent2", "qMax_pu", "DOUBLE", hvdcDefinition.converter2Id.str()));
       break;
     }
   }
@@ -525,24 +526,28 @@ Par::writeHdvcLine(const algo::HVDCDefinition& hvdcDefinition, const std::string
 }
 
 boost::shared_ptr<parameters::ParametersSet>
-Par::writeGenerator(const algo::GeneratorDefinition& def, const std::string& basename, const boost::filesystem::path& dirname) {
-  std::size_t hashId = constants::hash(def.id);
+Par::writeGenerator(const algo::GeneratorDefinitions& generators, std::size_t index, const std::string& basename,
+                    const boost::filesystem::path& dirname) {
+  const auto row = generators.rows[index];
+  const auto& table = generators.table;
+  std::size_t hashId = constants::hash(table.ids()[row].str());
   std::string hashIdStr = std::to_string(hashId);
 
   //  Use the hash id in exported files to prevent use of non-ascii characters
   auto set = boost::shared_ptr<parameters::ParametersSet>(new parameters::ParametersSet(hashIdStr));
   // The macroParSet is associated to a macroParameterSet via the id
+  const bool fixedP = DYN::doubleIsZero(table.targetP()[row]);
   set->addMacroParSet(
-      boost::shared_ptr<parameters::MacroParSet>(new parameters::MacroParSet(helper::getMacroParameterSetId(def.model, DYN::doubleIsZero(def.targetP)))));
+      boost::shared_ptr<parameters::MacroParSet>(new parameters::MacroParSet(helper::getMacroParameterSetId(generators.models[index], fixedP))));
 
   // Qmax and QMin are determined in dynawo according to reactive capabilities curves and min max
   // we need a small numerical tolerance in case the starting point of the reactive injection is exactly
   // on the limit of the reactive capability curve
-  set->addParameter(helper::buildParameter("generator_QMin0", def.qmin - 1));
-  set->addParameter(helper::buildParameter("generator_QMax0", def.qmax + 1));
+  set->addParameter(helper::buildParameter("generator_QMin0", table.qmin()[row] - 1));
+  set->addParameter(helper::buildParameter("generator_QMax0", table.qmax()[row] + 1));
 
   auto dirname_diagram = dirname;
-  dirname_diagram.append(basename + constants::diagramDirectorySuffix).append(constants::diagramFilename(def.id));
+  dirname_diagram.append(basename + constants::diagramDirectorySuffix).append(constants::diagramFilename(table.ids()[row].str()));
 
   set->addParameter(helper::buildParameter("generator_QMaxTableFile", dirname_diagram.generic_string()));
   set->addParameter(helper::buildParameter("generator_QMaxTableName", hashIdStr + constants::diagramMaxTableSuffix));
@@ -560,7 +565,7 @@ Par::updatePropParameters(boost::shared_ptr<parameters::ParametersSet> set) {
 
 boost::shared_ptr<parameters::ParametersSet>
 Par::writeStaticVarCompensator(const inputs::StaticVarCompensator& svarc) {
-  auto set = boost::shared_ptr<parameters::ParametersSet>(new parameters::ParametersSet(svarc.id));
+  auto set = boost::shared_ptr<parameters::ParametersSet>(new parameters::ParametersSet(svarc.id.str()));
 
   set->addMacroParSet(boost::make_shared<parameters::MacroParSet>(macroParameterSetStaticCompensator_));
 
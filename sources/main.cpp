@@ -7,11 +7,13 @@
 // file, you can obtain one at http://mozilla.org/MPL/2.0/.
 // SPDX-License-Identifier: MPL-2.0
 
+#include "Algo.h"
 #include "Configuration.h"
 #include "Context.h"
 #include "Dico.h"
 #include "Log.h"
 #include "Message.hpp"
+#include "NetworkPrescan.h"
 #include "Options.h"
 #include "version.h"
 
@@ -21,6 +23,7 @@
 #include <boost/filesystem.hpp>
 #include <chrono>
 #include <cstdlib>
+#include <fstream>
 #include <sstream>
 
 static const char* dictPrefix = "DFLMessages_";
@@ -47,6 +50,69 @@ initializeDynawo(const std::string& locale) {
   dicos.addDico("LOG", "DYNLog", locale);
 }
 
+/**
+ * @brief Pre-scan the topology of the network file, to reject it before building the data interface
+ *
+ * The network is rejected only if no generator regulates the voltage in the whole network, the regulating generators of the context being
+ * a subset of the ones of the pre-scan. The nodes of node-breaker voltage levels differ from the ones of the context, so the main island of
+ * the pre-scan may not be the main connex component of the context: a main island without regulating generator is only reported, and the
+ * context decides once the network is built. The slack node candidate is computed with the same criteria as the context, on the main island
+ * of the pre-scan, and only reported for the same reason.
+ *
+ * The pre-scan runs before the data interface is built rather than at the same time, as its purpose is to avoid building it.
+ * A failure of the pre-scan itself is not an error: the network file is parsed anyway and its errors reported by the data interface.
+ *
+ * @param networkFilepath the network file
+ * @param config the configuration
+ * @returns @b false if the network has no generator regulating the voltage, @b true if not
+ */
+static bool
+prescanNetwork(const std::string& networkFilepath, const dfl::inputs::Configuration& config) {
+  try {
+    dfl::inputs::NetworkPrescan prescan(networkFilepath, config.getNbThreads());
+    const auto& graph = prescan.getGraph();
+    const auto& islands = prescan.getIslands();
+    std::shared_ptr<dfl::inputs::Node> slackNode;
+    dfl::algo::SlackNodeAlgorithm slackNodeAlgorithm(slackNode, graph);
+    for (const auto& node : graph.nodes()) {
+      if (islands.isInMainIsland(node->index)) {
+        slackNodeAlgorithm(node);
+      }
+    }
+    LOG(info) << MESS(NetworkPrescanInfo, networkFilepath, graph.nbNodes(), islands.nbIslands(), slackNode ? slackNode->id.str() : "-") << LOG_ENDL;
+    if (!prescan.hasAnyRegulatingGenerator()) {
+      return false;
+    }
+    if (!prescan.hasRegulatingGeneratorInMainIsland()) {
+      LOG(warn) << MESS(NetworkPrescanNoRegulatingGeneratorInMainIsland, networkFilepath) << LOG_ENDL;
+    }
+    return true;
+  } catch (const std::runtime_error& e) {
+    LOG(warn) << MESS(NetworkPrescanError, networkFilepath, e.what()) << LOG_ENDL;
+    return true;
+  }
+}
+
+/**
+ * @brief Write the memory footprint of the processed context as a JSON document
+ *
+ * A failure to open the report file is not an error: the simulation is run anyway.
+ *
+ * @param reportFilepath the report file
+ * @param context the processed context
+ */
+static void
+writeMemoryReport(const std::string& reportFilepath, const dfl::Context& context) {
+  std::ofstream report(reportFilepath);
+  if (!report) {
+    LOG(warn) << MESS(MemoryReportError, reportFilepath) << LOG_ENDL;
+    return;
+  }
+  auto footprint = context.memoryFootprint();
+  footprint.writeJson(report);
+  LOG(info) << MESS(MemoryReportWritten, context.basename(), reportFilepath, footprint.totalBytes()) << LOG_ENDL;
+}
+
 static inline double
 elapsed(const std::chrono::steady_clock::time_point& timePoint) {
   auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - timePoint);
@@ -104,6 +170,13 @@ main(int argc, char* argv[]) {
 
     LOG(info) << MESS(InputsInfo, runtimeConfig.networkFilePath, runtimeConfig.configPath) << LOG_ENDL;
 
+    if (config.isNetworkPrescanOn() && !prescanNetwork(runtimeConfig.networkFilePath, config)) {
+      // no generator is regulating the voltage in the whole network : do not build the data interface
+      LOG(error) << MESS(NetworkPrescanNoRegulatingGenerator, runtimeConfig.networkFilePath) << LOG_ENDL;
+      LOG(info) << MESS(InitEnd, elapsed(timeStart)) << LOG_ENDL;
+      return EXIT_FAILURE;
+    }
+
     boost::filesystem::path parFilesDir(root);
     parFilesDir.append("etc");
 
@@ -118,6 +191,10 @@ main(int argc, char* argv[]) {
     }
     LOG(info) << MESS(InitEnd, elapsed(timeStart)) << LOG_ENDL;
 
+    if (!runtimeConfig.memoryReportPath.empty()) {
+      writeMemoryReport(runtimeConfig.memoryReportPath, context);
+    }
+
     auto timeFilesStart = std::chrono::steady_clock::now();
     context.exportOutputs();
     LOG(info) << MESS(FilesEnd, elapsed(timeFilesStart)) << LOG_ENDL;
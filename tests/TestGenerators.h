@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#pragma once
+
+#include "Algo.h"
+#include "GeneratorTable.h"
+#include "ReactiveCurveStore.h"
+
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace test {
+
+/**
+ * @brief Add a generator to a generator table and to the generator definitions referencing it
+ *
+ * @param curves the store of the reactive capability curves
+ * @param table the generator table
+ * @param generators the generator definitions
+ * @param id the id of the generator
+ * @param model the model of the generator
+ * @param nodeId the id of the node of the generator
+ * @param points the points of the reactive capability curve
+ * @param qmin the minimum reactive power
+ * @param qmax the maximum reactive power
+ * @param pmin the minimum active power
+ * @param pmax the maximum active power
+ * @param targetP the active power target
+ * @param regulatedBusId the id of the regulated bus
+ */
+inline void
+addGenerator(inputs::ReactiveCurveStore& curves, inputs::GeneratorTable& table, algo::GeneratorDefinitions& generators, const std::string& id,
+             algo::GeneratorDefinitions::ModelType model, const std::string& nodeId, const std::vector<inputs::GeneratorTable::ReactiveCurvePoint>& points,
+             double qmin, double qmax, double pmin, double pmax, double targetP, const std::string& regulatedBusId) {
+  generators.add(table.add(id, curves.add(points), qmin, qmax, pmin, pmax, targetP, regulatedBusId, nodeId), model);
+}
+
+}  // namespace test
+}  // namespace dfl
@@ -19,6 +19,7 @@
 #include "Configuration.h"
 #include "Dico.h"
 #include "NetworkManager.h"
+#include "TestGenerators.h"
 #include "Tests.h"
 
 #include <DYNBusInterface.h>
@@ -48,6 +49,15 @@ class TestAlgoServiceManagerInterface : public DYN::ServiceManagerInterface {
     map_.clear();
   }
 
+  /**
+   * @brief Retrieve the number of calls to getBusesConnectedBySwitch
+   *
+   * @returns number of calls
+   */
+  std::size_t nbCalls() const {
+    return nbCalls_;
+  }
+
   /**
    * @brief Add a switch connection
    *
@@ -66,6 +76,7 @@ class TestAlgoServiceManagerInterface : public DYN::ServiceManagerInterface {
    * @copydoc DYN::ServiceManagerInterface::getBusesConnectedBySwitch
    */
   std::vector<std::string> getBusesConnectedBySwitch(const std::string& busId, const std::string& VLId) const final {
+    ++nbCalls_;
     auto it = map_.find(std::tie(busId, VLId));
     if (it == map_.end()) {
       return {};
@@ -106,7 +117,28 @@ class TestAlgoServiceManagerInterface : public DYN::ServiceManagerInterface {
 
  private:
   std::map<MapKey, std::vector<std::string>> map_;
+  mutable std::size_t nbCalls_ = 0;
 };
+
+/**
+ * @brief Build the topological graph of nodes
+ *
+ * @param nodes the nodes of the graph
+ * @param edges the pairs of positions in @p nodes of the connected nodes
+ *
+ * @returns the built graph
+ */
+static dfl::inputs::Graph
+buildGraph(const std::vector<std::shared_ptr<dfl::inputs::Node>>& nodes, const std::vector<std::pair<unsigned int, unsigned int>>& edges) {
+  dfl::inputs::Graph::Builder builder;
+  for (const auto& node : nodes) {
+    builder.addNode(node);
+  }
+  for (const auto& edge : edges) {
+    builder.addEdge(nodes[edge.first]->index, nodes[edge.second]->index, dfl::inputs::Graph::EdgeType::LINE);
+  }
+  return builder.build();
+}
 }  // namespace test
 
 TEST(SlackNodeAlgo, Base) {
@@ -117,16 +149,10 @@ TEST(SlackNodeAlgo, Base) {
       dfl::inputs::Node::build("6", vl, 0.0, {}),
   };
 
-  nodes[0]->neighbours.push_back(nodes[1]);
-  nodes[0]->neighbours.push_back(nodes[2]);
-  nodes[0]->neighbours.push_back(nodes[3]);
-
-  nodes[4]->neighbours.push_back(nodes[1]);
-  nodes[4]->neighbours.push_back(nodes[2]);
-  nodes[4]->neighbours.push_back(nodes[3]);
+  auto graph = test::buildGraph(nodes, {{0, 1}, {0, 2}, {0, 3}, {4, 1}, {4, 2}, {4, 3}});
 
   std::shared_ptr<dfl::inputs::Node> slack_node;
-  dfl::algo::SlackNodeAlgorithm algo(slack_node);
+  dfl::algo::SlackNodeAlgorithm algo(slack_node, graph);
 
   std::for_each(nodes.begin(), nodes.end(), algo);
 
@@ -142,16 +168,10 @@ TEST(SlackNodeAlgo, neighbours) {
       dfl::inputs::Node::build("6", vl, 0.0, {}),
   };
 
-  nodes[0]->neighbours.push_back(nodes[1]);
-  nodes[0]->neighbours.push_back(nodes[2]);
-  nodes[0]->neighbours.push_back(nodes[3]);
-
-  nodes[4]->neighbours.push_back(nodes[1]);
-  nodes[4]->neighbours.push_back(nodes[2]);
-  nodes[4]->neighbours.push_back(nodes[3]);
+  auto graph = test::buildGraph(nodes, {{0, 1}, {0, 2}, {0, 3}, {4, 1}, {4, 2}, {4, 3}});
 
   std::shared_ptr<dfl::inputs::Node> slack_node;
-  dfl::algo::SlackNodeAlgorithm algo(slack_node);
+  dfl::algo::SlackNodeAlgorithm algo(slack_node, graph);
 
   std::for_each(nodes.begin(), nodes.end(), algo);
 
@@ -167,16 +187,10 @@ TEST(SlackNodeAlgo, equivalent) {
       dfl::inputs::Node::build("6", vl, 0.0, {}),
   };
 
-  nodes[5]->neighbours.push_back(nodes[1]);
-  nodes[5]->neighbours.push_back(nodes[2]);
-  nodes[5]->neighbours.push_back(nodes[3]);
-
-  nodes[4]->neighbours.push_back(nodes[1]);
-  nodes[4]->neighbours.push_back(nodes[2]);
-  nodes[4]->neighbours.push_back(nodes[3]);
+  auto graph = test::buildGraph(nodes, {{5, 1}, {5, 2}, {5, 3}, {4, 1}, {4, 2}, {4, 3}});
 
   std::shared_ptr<dfl::inputs::Node> slack_node;
-  dfl::algo::SlackNodeAlgorithm algo(slack_node);
+  dfl::algo::SlackNodeAlgorithm algo(slack_node, graph);
 
   std::for_each(nodes.begin(), nodes.end(), algo);
 
@@ -184,6 +198,25 @@ TEST(SlackNodeAlgo, equivalent) {
   ASSERT_EQ("4", slack_node->id);  // first found
 }
 
+TEST(SlackNodeAlgo, equivalentReverseWalk) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{
+      dfl::inputs::Node::build("0", vl, 0.0, {}), dfl::inputs::Node::build("1", vl, 1.0, {}), dfl::inputs::Node::build("2", vl, 2.0, {}),
+      dfl::inputs::Node::build("3", vl, 3.0, {}), dfl::inputs::Node::build("4", vl, 5.0, {}), dfl::inputs::Node::build("5", vl, 5.0, {}),
+      dfl::inputs::Node::build("6", vl, 0.0, {}),
+  };
+
+  auto graph = test::buildGraph(nodes, {{5, 1}, {5, 2}, {5, 3}, {4, 1}, {4, 2}, {4, 3}});
+
+  std::shared_ptr<dfl::inputs::Node> slack_node;
+  dfl::algo::SlackNodeAlgorithm algo(slack_node, graph);
+
+  std::for_each(nodes.rbegin(), nodes.rend(), algo);
+
+  ASSERT_NE(nullptr, slack_node);
+  ASSERT_EQ("4", slack_node->id);  // lowest id, whatever the walk order
+}
+
 TEST(Connexity, base) {
   auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
   std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{
@@ -193,20 +226,11 @@ TEST(Connexity, base) {
   };
   std::vector<dfl::inputs::Node::NodeId> expected_nodes{"0", "1", "2", "3"};
 
-  nodes[0]->neighbours.push_back(nodes[1]);
-  nodes[0]->neighbours.push_back(nodes[2]);
-  nodes[2]->neighbours.push_back(nodes[3]);
-  nodes[1]->neighbours.push_back(nodes[0]);
-  nodes[2]->neighbours.push_back(nodes[0]);
-  nodes[3]->neighbours.push_back(nodes[2]);
-
-  nodes[4]->neighbours.push_back(nodes[5]);
-  nodes[5]->neighbours.push_back(nodes[6]);
-  nodes[5]->neighbours.push_back(nodes[4]);
-  nodes[6]->neighbours.push_back(nodes[5]);
+  auto graph = test::buildGraph(nodes, {{0, 1}, {0, 2}, {2, 3}, {4, 5}, {5, 6}});
 
   dfl::algo::MainConnexComponentAlgorithm::ConnexGroup main;
-  dfl::algo::MainConnexComponentAlgorithm algo(main);
+  auto islands = dfl::inputs::Islands::compute(graph);
+  dfl::algo::MainConnexComponentAlgorithm algo(main, graph, islands);
 
   std::for_each(nodes.begin(), nodes.end(), algo);
 
@@ -224,18 +248,11 @@ TEST(Connexity, SameSize) {
                                                         dfl::inputs::Node::build("4", vl, 5.0, {}), dfl::inputs::Node::build("5", vl, 5.0, {})};
   std::vector<dfl::inputs::Node::NodeId> expected_nodes{"0", "1", "2"};
 
-  nodes[0]->neighbours.push_back(nodes[1]);
-  nodes[0]->neighbours.push_back(nodes[2]);
-  nodes[1]->neighbours.push_back(nodes[0]);
-  nodes[2]->neighbours.push_back(nodes[0]);
-
-  nodes[3]->neighbours.push_back(nodes[4]);
-  nodes[3]->neighbours.push_back(nodes[5]);
-  nodes[4]->neighbours.push_back(nodes[3]);
-  nodes[5]->neighbours.push_back(nodes[3]);
+  auto graph = test::buildGraph(nodes, {{0, 1}, {0, 2}, {3, 4}, {3, 5}});
 
   dfl::algo::MainConnexComponentAlgorithm::ConnexGroup main;
-  dfl::algo::MainConnexComponentAlgorithm algo(main);
+  auto islands = dfl::inputs::Islands::compute(graph);
+  dfl::algo::MainConnexComponentAlgorithm algo(main, graph, islands);
 
   std::for_each(nodes.begin(), nodes.end(), algo);
 
@@ -246,19 +263,59 @@ TEST(Connexity, SameSize) {
   ASSERT_EQ(expected_nodes, nodeids_main);
 }
 
+TEST(Connexity, DiscoveryOrder) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{dfl::inputs::Node::build("0", vl, 0.0, {}), dfl::inputs::Node::build("1", vl, 1.0, {}),
+                                                        dfl::inputs::Node::build("2", vl, 2.0, {}), dfl::inputs::Node::build("3", vl, 3.0, {}),
+                                                        dfl::inputs::Node::build("4", vl, 5.0, {}), dfl::inputs::Node::build("5", vl, 5.0, {}),
+                                                        dfl::inputs::Node::build("6", vl, 5.0, {})};
+  // depth-first from the first node of the main island, not the order of the walk, without crossing open edges
+  std::vector<dfl::inputs::Node::NodeId> expected_nodes{"1", "3", "2", "4"};
+
+  dfl::inputs::Graph::Builder builder;
+  for (const auto& node : nodes) {
+    builder.addNode(node);
+  }
+  builder.addEdge(1, 3, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(3, 2, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(1, 4, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(4, 5, dfl::inputs::Graph::EdgeType::SWITCH, true);  // open switch
+  auto branch = builder.addEdge(2, 6, dfl::inputs::Graph::EdgeType::LINE);
+  auto graph = builder.build();
+  auto islands = dfl::inputs::Islands::compute(graph);
+  // disconnected branch
+  ASSERT_TRUE(graph.setEdgeOpen(branch, true));
+  islands.update(graph, branch);
+
+  dfl::algo::MainConnexComponentAlgorithm::ConnexGroup main;
+  dfl::algo::MainConnexComponentAlgorithm algo(main, graph, islands);
+
+  std::for_each(nodes.begin(), nodes.end(), algo);
+
+  std::vector<dfl::inputs::Node::NodeId> nodeids_main;
+  std::for_each(main.begin(), main.end(), [&nodeids_main](const std::shared_ptr<dfl::inputs::Node>& node) { nodeids_main.push_back(node->id); });
+  ASSERT_EQ(expected_nodes, nodeids_main);
+}
+
+using dfl::test::addGenerator;
+
 static void
-generatorsEquals(const dfl::algo::GeneratorDefinition& lhs, const dfl::algo::GeneratorDefinition& rhs) {
-  ASSERT_EQ(lhs.id, rhs.id);
-  ASSERT_EQ(lhs.model, rhs.model);
-  ASSERT_EQ(lhs.points.size(), rhs.points.size());
-  ASSERT_EQ(lhs.qmin, rhs.qmin);
-  ASSERT_EQ(lhs.qmax, rhs.qmax);
-  ASSERT_EQ(lhs.pmin, rhs.pmin);
-  ASSERT_EQ(lhs.pmax, rhs.pmax);
-  for (size_t index_p = 0; index_p < lhs.points.size(); ++index_p) {
-    ASSERT_EQ(lhs.points[index_p].p, rhs.points[index_p].p);
-    ASSERT_EQ(lhs.points[index_p].qmax, rhs.points[index_p].qmax);
-    ASSERT_EQ(lhs.points[index_p].qmin, rhs.points[index_p].qmin);
+generatorsEquals(const dfl::algo::GeneratorDefinitions& lhs, const dfl::algo::GeneratorDefinitions& rhs, size_t index) {
+  const auto lrow = lhs.rows[index];
+  const auto rrow = rhs.rows[index];
+  ASSERT_EQ(lhs.table.ids()[lrow], rhs.table.ids()[rrow]);
+  ASSERT_EQ(lhs.models[index], rhs.models[index]);
+  const auto lpoints = lhs.table.points(lrow);
+  const auto rpoints = rhs.table.points(rrow);
+  ASSERT_EQ(lpoints.size(), rpoints.size());
+  ASSERT_EQ(lhs.table.qmin()[lrow], rhs.table.qmin()[rrow]);
+  ASSERT_EQ(lhs.table.qmax()[lrow], rhs.table.qmax()[rrow]);
+  ASSERT_EQ(lhs.table.pmin()[lrow], rhs.table.pmin()[rrow]);
+  ASSERT_EQ(lhs.table.pmax()[lrow], rhs.table.pmax()[rrow]);
+  for (size_t index_p = 0; index_p < lpoints.size(); ++index_p) {
+    ASSERT_EQ(lpoints[index_p].p, rpoints[index_p].p);
+    ASSERT_EQ(lpoints[index_p].qmax, rpoints[index_p].qmax);
+    ASSERT_EQ(lpoints[index_p].qmin, rpoints[index_p].qmin);
   }
 }
 
@@ -272,40 +329,40 @@ TEST(Generators, base) {
       dfl::inputs::Node::build("6", vl2, 0.0, {}),
   };
 
-  std::vector<dfl::inputs::Generator::ReactiveCurvePoint> points(
-      {dfl::inputs::Generator::ReactiveCurvePoint(12., 44., 440.), dfl::inputs::Generator::ReactiveCurvePoint(65., 44., 440.)});
-  std::vector<dfl::inputs::Generator::ReactiveCurvePoint> points0;
-  points0.push_back(dfl::inputs::Generator::ReactiveCurvePoint(2, -10, -10));
-  points0.push_back(dfl::inputs::Generator::ReactiveCurvePoint(1, 1, 17));
+  std::vector<dfl::inputs::GeneratorTable::ReactiveCurvePoint> points(
+      {dfl::inputs::GeneratorTable::ReactiveCurvePoint(12., 44., 440.), dfl::inputs::GeneratorTable::ReactiveCurvePoint(65., 44., 440.)});
+  std::vector<dfl::inputs::GeneratorTable::ReactiveCurvePoint> points0;
+  points0.push_back(dfl::inputs::GeneratorTable::ReactiveCurvePoint(2, -10, -10));
+  points0.push_back(dfl::inputs::GeneratorTable::ReactiveCurvePoint(1, 1, 17));
 
   const std::string bus1 = "BUS_1";
   const std::string bus2 = "BUS_2";
   const std::string bus3 = "BUS_3";
-  dfl::algo::GeneratorDefinitionAlgorithm::Generators expected_gens_infinite = {
-      dfl::algo::GeneratorDefinition("00", dfl::algo::GeneratorDefinition::ModelType::PROP_SIGNALN, "0", points0, 0, 0, 0, 0, 0,
-                                     bus1),  // multiple generators on the same node
-      dfl::algo::GeneratorDefinition("01", dfl::algo::GeneratorDefinition::ModelType::PROP_SIGNALN, "0", points, -1, 1, -1, 1, 0,
-                                     bus1),  // multiple generators on the same node
-      dfl::algo::GeneratorDefinition("02", dfl::algo::GeneratorDefinition::ModelType::SIGNALN, "2", points, -2, 2, -2, 2, 0, bus2),
-      dfl::algo::GeneratorDefinition("05", dfl::algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN, "4", points, -5, 5, -5, 5, 0, bus3),
-  };
-
-  dfl::algo::GeneratorDefinitionAlgorithm::Generators expected_gens_finite = {
-      dfl::algo::GeneratorDefinition("00", dfl::algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "0", points0, 0, 0, 0, 0, 0,
-                                     bus1),  // multiple generators on the same node
-      dfl::algo::GeneratorDefinition("01", dfl::algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "0", points, -1, 1, -1, 1, 0,
-                                     bus1),  // multiple generators on the same node
-      dfl::algo::GeneratorDefinition("02", dfl::algo::GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "2", points, -2, 2, -2, 2, 0, bus2),
-      dfl::algo::GeneratorDefinition("05", dfl::algo::GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "4", points, -5, 5, -5, 5, 0, bus3),
-  };
-
-  nodes[0]->generators.emplace_back("00", points0, 0, 0, 0, 0, 0, bus1, bus1);
-  nodes[0]->generators.emplace_back("01", points, -1, 1, -1, 1, 0, bus1, bus3);
-
-  nodes[2]->generators.emplace_back("02", points, -2, 2, -2, 2, 0, bus2, bus2);
-
-  nodes[4]->generators.emplace_back("05", points, -5, 5, -5, 5, 0, bus3, bus2);
-  dfl::algo::GeneratorDefinitionAlgorithm::Generators generators;
+  using ModelType = dfl::algo::GeneratorDefinitions::ModelType;
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::inputs::GeneratorTable expectedTable(curves);
+  dfl::algo::GeneratorDefinitions expected_gens_infinite(expectedTable);
+  // multiple generators on the same node
+  addGenerator(curves, expectedTable, expected_gens_infinite, "00", ModelType::PROP_SIGNALN, "0", points0, 0, 0, 0, 0, 0, bus1);
+  addGenerator(curves, expectedTable, expected_gens_infinite, "01", ModelType::PROP_SIGNALN, "0", points, -1, 1, -1, 1, 0, bus1);
+  addGenerator(curves, expectedTable, expected_gens_infinite, "02", ModelType::SIGNALN, "2", points, -2, 2, -2, 2, 0, bus2);
+  addGenerator(curves, expectedTable, expected_gens_infinite, "05", ModelType::REMOTE_SIGNALN, "4", points, -5, 5, -5, 5, 0, bus3);
+
+  dfl::algo::GeneratorDefinitions expected_gens_finite(expectedTable);
+  // multiple generators on the same node
+  addGenerator(curves, expectedTable, expected_gens_finite, "00", ModelType::PROP_DIAGRAM_PQ_SIGNALN, "0", points0, 0, 0, 0, 0, 0, bus1);
+  addGenerator(curves, expectedTable, expected_gens_finite, "01", ModelType::PROP_DIAGRAM_PQ_SIGNALN, "0", points, -1, 1, -1, 1, 0, bus1);
+  addGenerator(curves, expectedTable, expected_gens_finite, "02", ModelType::DIAGRAM_PQ_SIGNALN, "2", points, -2, 2, -2, 2, 0, bus2);
+  addGenerator(curves, expectedTable, expected_gens_finite, "05", ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "4", points, -5, 5, -5, 5, 0, bus3);
+
+  nodes[0]->generators.push_back(table.add("00", curves.add(points0), 0, 0, 0, 0, 0, bus1, bus1));
+  nodes[0]->generators.push_back(table.add("01", curves.add(points), -1, 1, -1, 1, 0, bus1, bus3));
+
+  nodes[2]->generators.push_back(table.add("02", curves.add(points), -2, 2, -2, 2, 0, bus2, bus2));
+
+  nodes[4]->generators.push_back(table.add("05", curves.add(points), -5, 5, -5, 5, 0, bus3, bus2));
+  dfl::algo::GeneratorDefinitions generators(table);
   dfl::inputs::NetworkManager::BusMapRegulating busMap = {{bus1, dfl::inputs::NetworkManager::NbOfRegulating::MULTIPLES},
                                                           {bus2, dfl::inputs::NetworkManager::NbOfRegulating::ONE},
                                                           {bus3, dfl::inputs::NetworkManager::NbOfRegulating::ONE}};
@@ -316,8 +373,8 @@ TEST(Generators, base) {
 
   ASSERT_EQ(4, generators.size());
   for (size_t index = 0; index < generators.size(); ++index) {
-    generatorsEquals(expected_gens_infinite[index], generators[index]);
-    ASSERT_EQ(expected_gens_infinite[index].targetP, generators[index].targetP);
+    generatorsEquals(expected_gens_infinite, generators, index);
+    ASSERT_EQ(expectedTable.targetP()[expected_gens_infinite.rows[index]], table.targetP()[generators.rows[index]]);
   }
 
   generators.clear();
@@ -328,8 +385,8 @@ TEST(Generators, base) {
 
   ASSERT_EQ(4, generators.size());
   for (size_t index = 0; index < generators.size(); ++index) {
-    generatorsEquals(expected_gens_finite[index], generators[index]);
-    ASSERT_EQ(expected_gens_finite[index].targetP, generators[index].targetP);
+    generatorsEquals(expected_gens_finite, generators, index);
+    ASSERT_EQ(expectedTable.targetP()[expected_gens_finite.rows[index]], table.targetP()[generators.rows[index]]);
   }
 }
 
@@ -347,29 +404,76 @@ TEST(Generators, SwitchConnexity) {
   testServiceManager->add("1", "VL", "2");
   testServiceManager->add("4", "VL2", "5");
 
-  std::vector<dfl::inputs::Generator::ReactiveCurvePoint> points(
-      {dfl::inputs::Generator::ReactiveCurvePoint(12., 44., 440.), dfl::inputs::Generator::ReactiveCurvePoint(65., 44., 440.)});
-  std::vector<dfl::inputs::Generator::ReactiveCurvePoint> points0;
-  points0.push_back(dfl::inputs::Generator::ReactiveCurvePoint(2, -10, -10));
-  points0.push_back(dfl::inputs::Generator::ReactiveCurvePoint(1, 1, 17));
+  std::vector<dfl::inputs::GeneratorTable::ReactiveCurvePoint> points(
+      {dfl::inputs::GeneratorTable::ReactiveCurvePoint(12., 44., 440.), dfl::inputs::GeneratorTable::ReactiveCurvePoint(65., 44., 440.)});
+  std::vector<dfl::inputs::GeneratorTable::ReactiveCurvePoint> points0;
+  points0.push_back(dfl::inputs::GeneratorTable::ReactiveCurvePoint(2, -10, -10));
+  points0.push_back(dfl::inputs::GeneratorTable::ReactiveCurvePoint(1, 1, 17));
   const std::string bus1 = "BUS_1";
   const std::string bus2 = "BUS_2";
   const std::string bus3 = "BUS_3";
 
-  dfl::algo::GeneratorDefinitionAlgorithm::Generators expected_gens_infinite = {
-      dfl::algo::GeneratorDefinition("00", dfl::algo::GeneratorDefinition::ModelType::PROP_SIGNALN, "0", points0, -1, 1, -1, 1, 1,
-                                     bus1),  // due to switch connexity
-      dfl::algo::GeneratorDefinition("02", dfl::algo::GeneratorDefinition::ModelType::PROP_SIGNALN, "2", points, -2, 2, -2, 2, 2,
-                                     bus2),  // due to switch connexity
-      dfl::algo::GeneratorDefinition("04", dfl::algo::GeneratorDefinition::ModelType::SIGNALN, "4", points, -5, 5, -5, 5, 5, bus3),
+  using ModelType = dfl::algo::GeneratorDefinitions::ModelType;
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::inputs::GeneratorTable expectedTable(curves);
+  dfl::algo::GeneratorDefinitions expected_gens_infinite(expectedTable);
+  addGenerator(curves, expectedTable, expected_gens_infinite, "00", ModelType::PROP_SIGNALN, "0", points0, -1, 1, -1, 1, 1, bus1);  // due to switch connexity
+  addGenerator(curves, expectedTable, expected_gens_infinite, "02", ModelType::PROP_SIGNALN, "2", points, -2, 2, -2, 2, 2, bus2);  // due to switch connexity
+  addGenerator(curves, expectedTable, expected_gens_infinite, "04", ModelType::SIGNALN, "4", points, -5, 5, -5, 5, 5, bus3);
+
+  nodes[0]->generators.push_back(table.add("00", curves.add(points0), -1, 1, -1, 1, 1, bus1, bus1));
+
+  nodes[2]->generators.push_back(table.add("02", curves.add(points), -2, 2, -2, 2, 2, bus2, bus2));
+
+  nodes[4]->generators.push_back(table.add("04", curves.add(points), -5, 5, -5, 5, 5, bus3, bus3));
+  dfl::algo::GeneratorDefinitions generators(table);
+  dfl::inputs::NetworkManager::BusMapRegulating busMap = {{bus1, dfl::inputs::NetworkManager::NbOfRegulating::ONE},
+                                                          {bus2, dfl::inputs::NetworkManager::NbOfRegulating::ONE},
+                                                          {bus3, dfl::inputs::NetworkManager::NbOfRegulating::ONE}};
+  dfl::algo::GeneratorDefinitionAlgorithm::BusGenMap busesWithDynamicModel;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busesWithDynamicModel, busMap, true, testServiceManager);
+
+  std::for_each(nodes.begin(), nodes.end(), algo_infinite);
+
+  ASSERT_EQ(3, generators.size());
+  for (size_t index = 0; index < generators.size(); ++index) {
+    generatorsEquals(expected_gens_infinite, generators, index);
+  }
+}
+
+TEST(Generators, SwitchConnexityGroups) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  auto testServiceManager = boost::make_shared<test::TestAlgoServiceManagerInterface>();
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{
+      dfl::inputs::Node::build("0", vl, 0.0, {}), dfl::inputs::Node::build("1", vl, 1.0, {}), dfl::inputs::Node::build("2", vl, 2.0, {}),
+      dfl::inputs::Node::build("3", vl, 3.0, {}), dfl::inputs::Node::build("4", vl, 4.0, {}),
   };
 
-  nodes[0]->generators.emplace_back("00", points0, -1, 1, -1, 1, 1, bus1, bus1);
+  testServiceManager->add("0", "VL", "1");
+  testServiceManager->add("1", "VL", "2");
+  testServiceManager->add("3", "VL", "4");
 
-  nodes[2]->generators.emplace_back("02", points, -2, 2, -2, 2, 2, bus2, bus2);
+  std::vector<dfl::inputs::GeneratorTable::ReactiveCurvePoint> points(
+      {dfl::inputs::GeneratorTable::ReactiveCurvePoint(12., 44., 440.), dfl::inputs::GeneratorTable::ReactiveCurvePoint(65., 44., 440.)});
+  const std::string bus1 = "BUS_1";
+  const std::string bus2 = "BUS_2";
+  const std::string bus3 = "BUS_3";
 
-  nodes[4]->generators.emplace_back("04", points, -5, 5, -5, 5, 5, bus3, bus3);
-  dfl::algo::GeneratorDefinitionAlgorithm::Generators generators;
+  using ModelType = dfl::algo::GeneratorDefinitions::ModelType;
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::inputs::GeneratorTable expectedTable(curves);
+  dfl::algo::GeneratorDefinitions expected_gens(expectedTable);
+  addGenerator(curves, expectedTable, expected_gens, "00", ModelType::PROP_SIGNALN, "0", points, -1, 1, -1, 1, 1, bus1);  // due to switch connexity with node 2
+  addGenerator(curves, expectedTable, expected_gens, "02", ModelType::PROP_SIGNALN, "2", points, -2, 2, -2, 2, 2, bus2);  // due to switch connexity with node 0
+  // connected by switch to a node without generator
+  addGenerator(curves, expectedTable, expected_gens, "03", ModelType::SIGNALN, "3", points, -3, 3, -3, 3, 3, bus3);
+
+  nodes[0]->generators.push_back(table.add("00", curves.add(points), -1, 1, -1, 1, 1, bus1, bus1));
+  nodes[2]->generators.push_back(table.add("02", curves.add(points), -2, 2, -2, 2, 2, bus2, bus2));
+  nodes[3]->generators.push_back(table.add("03", curves.add(points), -3, 3, -3, 3, 3, bus3, bus3));
+  dfl::algo::GeneratorDefinitions generators(table);
   dfl::inputs::NetworkManager::BusMapRegulating busMap = {{bus1, dfl::inputs::NetworkManager::NbOfRegulating::ONE},
                                                           {bus2, dfl::inputs::NetworkManager::NbOfRegulating::ONE},
                                                           {bus3, dfl::inputs::NetworkManager::NbOfRegulating::ONE}};
@@ -380,8 +484,10 @@ TEST(Generators, SwitchConnexity) {
 
   ASSERT_EQ(3, generators.size());
   for (size_t index = 0; index < generators.size(); ++index) {
-    generatorsEquals(expected_gens_infinite[index], generators[index]);
+    generatorsEquals(expected_gens, generators, index);
   }
+  // the service manager is requested once for each group of nodes connected by switches
+  ASSERT_EQ(2, testServiceManager->nbCalls());
 }
 
 TEST(Loads, base) {
@@ -434,20 +540,25 @@ TEST(HvdcLine, base) {
       dfl::inputs::Node::build("3", vl, 63.0, {}), dfl::inputs::Node::build("4", vl, 56.0, {}),  dfl::inputs::Node::build("5", vl, 46.0, {}),
       dfl::inputs::Node::build("6", vl, 0.0, {}),
   };
-  auto dummyStation = std::make_shared<dfl::inputs::LCCConverter>("StationN", "_BUS___99_TN", nullptr, 99.);
-  auto dummyStationVSC = std::make_shared<dfl::inputs::VSCConverter>("StationN", "_BUS___99_TN", nullptr, false, 0., 0.,
-                                                                     std::vector<dfl::inputs::VSCConverter::ReactiveCurvePoint>{});
-  auto lccStation1 = std::make_shared<dfl::inputs::LCCConverter>("LCCStation1", "_BUS___11_TN", nullptr, 1.);
-  auto vscStation2 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation2", "_BUS___11_TN", nullptr, false, 0., 0.,
-                                                                 std::vector<dfl::inputs::VSCConverter::ReactiveCurvePoint>{});
-  auto lccStationMain1 = std::make_shared<dfl::inputs::LCCConverter>("LCCStationMain1", "_BUS__11_TN", nullptr, 1.);
-
-  auto lccStationMain2 = std::make_shared<dfl::inputs::LCCConverter>("LCCStationMain2", "_BUS__11_TN", nullptr, 2.);
-
-  auto hvdcLineLCC = dfl::inputs::HvdcLine::build("HVDCLCCLine", dfl::inputs::HvdcLine::ConverterType::LCC, lccStation1, dummyStation, boost::none, 0.0);
-  auto hvdcLineVSC = dfl::inputs::HvdcLine::build("HVDCVSCLine", dfl::inputs::HvdcLine::ConverterType::VSC, dummyStationVSC, vscStation2, boost::none, 10.);
+  auto dummyStation = std::make_shared<dfl::inputs::Converter>("StationN", "_BUS___99_TN", nullptr, dfl::inputs::LCCConverter(99.));
+  auto dummyStationVSC =
+      std::make_shared<dfl::inputs::Converter>("StationN", "_BUS___99_TN", nullptr,
+                                               dfl::inputs::VSCConverter(false, 0., 0., dfl::inputs::ReactiveCurveStore::emptyCurve));
+  auto lccStation1 = std::make_shared<dfl::inputs::Converter>("LCCStation1", "_BUS___11_TN", nullptr, dfl::inputs::LCCConverter(1.));
+  auto vscStation2 =
+      std::make_shared<dfl::inputs::Converter>("VSCStation2", "_BUS___11_TN", nullptr,
+                                               dfl::inputs::VSCConverter(false, 0., 0., dfl::inputs::ReactiveCurveStore::emptyCurve));
+  auto lccStationMain1 = std::make_shared<dfl::inputs::Converter>("LCCStationMain1", "_BUS__11_TN", nullptr, dfl::inputs::LCCConverter(1.));
+
+  auto lccStationMain2 = std::make_shared<dfl::inputs::Converter>("LCCStationMain2", "_BUS__11_TN", nullptr, dfl::inputs::LCCConverter(2.));
+
+  auto hvdcLineLCC = dfl::inputs::HvdcLine::build("HVDCLCCLine", dfl::inputs::HvdcLine::ConverterType::LCC, lccStation1.get(), dummyStation.get(), boost::none,
+                                                  0.0);
+  auto hvdcLineVSC = dfl::inputs::HvdcLine::build("HVDCVSCLine", dfl::inputs::HvdcLine::ConverterType::VSC, dummyStationVSC.get(), vscStation2.get(),
+                                                  boost::none, 10.);
   auto hvdcLineBothInMainComponent =
-      dfl::inputs::HvdcLine::build("HVDCLineBothInMain", dfl::inputs::HvdcLine::ConverterType::LCC, lccStationMain1, lccStationMain2, boost::none, 20.);
+      dfl::inputs::HvdcLine::build("HVDCLineBothInMain", dfl::inputs::HvdcLine::ConverterType::LCC, lccStationMain1.get(), lccStationMain2.get(), boost::none,
+                                   20.);
 
   // model not checked in this test : see the dedicated test
   std::vector<dfl::algo::HVDCDefinition> expected_hvdcLines = {
@@ -457,17 +568,17 @@ TEST(HvdcLine, base) {
       dfl::algo::HVDCDefinition(
           "HVDCVSCLine", dfl::inputs::HvdcLine::ConverterType::VSC, "StationN", "_BUS___99_TN", false, "VSCStation2", "_BUS___11_TN", false,
           dfl::algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT, dfl::algo::HVDCDefinition::HVDCModel::HvdcPVDangling, {0., 0.}, 10.,
-          dfl::algo::VSCDefinition(dummyStationVSC->converterId, dummyStationVSC->qMax, dummyStationVSC->qMin, 10., dummyStationVSC->points),
-          dfl::algo::VSCDefinition(vscStation2->converterId, vscStation2->qMax, vscStation2->qMin, 10., vscStation2->points), boost::none),
+          dfl::algo::VSCDefinition(dummyStationVSC->converterId, dummyStationVSC->vsc().qMax, dummyStationVSC->vsc().qMin, 10., dummyStationVSC->vsc().curve),
+          dfl::algo::VSCDefinition(vscStation2->converterId, vscStation2->vsc().qMax, vscStation2->vsc().qMin, 10., vscStation2->vsc().curve), boost::none),
       dfl::algo::HVDCDefinition("HVDCLineBothInMain", dfl::inputs::HvdcLine::ConverterType::LCC, "LCCStationMain1", "_BUS__11_TN", boost::none,
                                 "LCCStationMain2", "_BUS__11_TN", boost::none, dfl::algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT,
                                 dfl::algo::HVDCDefinition::HVDCModel::HvdcPVDangling, {1., 2.}, 20., boost::none, boost::none, boost::none),
   };
 
-  nodes[0]->converters.emplace_back(lccStation1);
-  nodes[2]->converters.emplace_back(lccStationMain1);
-  nodes[0]->converters.emplace_back(lccStationMain2);
-  nodes[4]->converters.emplace_back(vscStation2);
+  nodes[0]->converters.emplace_back(lccStation1.get());
+  nodes[2]->converters.emplace_back(lccStationMain1.get());
+  nodes[0]->converters.emplace_back(lccStationMain2.get());
+  nodes[4]->converters.emplace_back(vscStation2.get());
 
   dfl::algo::HVDCLineDefinitions hvdcDefs;
   constexpr bool useReactiveLimits = true;
@@ -489,11 +600,7 @@ TEST(HvdcLine, base) {
 
 static bool
 compareVSCDefinition(const dfl::algo::VSCDefinition& lhs, const dfl::algo::VSCDefinition& rhs) {
-  return lhs.id == rhs.id && lhs.qmax == rhs.qmax && lhs.qmin == rhs.qmin && lhs.points.size() == rhs.points.size() &&
-         std::equal(lhs.points.begin(), lhs.points.end(), rhs.points.begin(),
-                    [](const dfl::algo::VSCDefinition::ReactiveCurvePoint& lhs, const dfl::algo::VSCDefinition::ReactiveCurvePoint& rhs) {
-                      return lhs.p == rhs.p && lhs.qmax == rhs.qmax && lhs.qmin == rhs.qmin;
-                    });
+  return lhs.id == rhs.id && lhs.qmax == rhs.qmax && lhs.qmin == rhs.qmin && lhs.curve == rhs.curve;
 }
 
 static void
@@ -518,58 +625,58 @@ TEST(hvdcLine, models) {
       dfl::inputs::Node::build("6", vl, 0.0, {}),  dfl::inputs::Node::build("7", vl, 0.0, {}),   dfl::inputs::Node::build("8", vl, 0.0, {}),
       dfl::inputs::Node::build("9", vl, 0.0, {}),  dfl::inputs::Node::build("10", vl, 0.0, {}),
   };
-  std::vector<dfl::inputs::VSCConverter::ReactiveCurvePoint> emptyPoints{};
+  const auto emptyCurve = dfl::inputs::ReactiveCurveStore::emptyCurve;
 
   auto activeControl = boost::optional<dfl::inputs::HvdcLine::ActivePowerControl>(dfl::inputs::HvdcLine::ActivePowerControl(10., 5.));
 
-  auto dummyStation = std::make_shared<dfl::inputs::LCCConverter>("StationN", "_BUS___99_TN", nullptr, 1.);
-  auto dummyStationVSC = std::make_shared<dfl::inputs::VSCConverter>("StationN", "_BUS___99_TN", nullptr, false, 0., 0., emptyPoints);
-  auto lccStation1 = std::make_shared<dfl::inputs::LCCConverter>("LCCStation1", "0", nullptr, 1.);
-  auto lccStation3 = std::make_shared<dfl::inputs::LCCConverter>("LCCStation3", "3", nullptr, 1.);
-  auto lccStation4 = std::make_shared<dfl::inputs::LCCConverter>("LCCStation4", "4", nullptr, 1.);
-  auto vscStation1 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation1", "1", nullptr, false, 1.1, 1., emptyPoints);
-  auto vscStation2 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation2", "2", nullptr, true, 2.1, 2., emptyPoints);
-  auto vscStation21 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation21", "2", nullptr, true, 2.1, 2., emptyPoints);
-  auto vscStation22 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation22", "2", nullptr, true, 2.1, 2., emptyPoints);
-  auto vscStation23 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation23", "2", nullptr, true, 2.1, 2., emptyPoints);
-  auto vscStation5 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation5", "5", nullptr, true, 5.1, 5., emptyPoints);
-  auto vscStation6 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation6", "6", nullptr, true, 6.1, 6., emptyPoints);
-  auto vscStation7 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation7", "7", nullptr, true, 7.1, 7., emptyPoints);
-  auto vscStation8 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation8", "8", nullptr, true, 8.1, 8., emptyPoints);
-  auto vscStation9 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation9", "9", nullptr, true, 9.1, 9., emptyPoints);
-  auto vscStation10 = std::make_shared<dfl::inputs::VSCConverter>("VSCStation10", "10", nullptr, true, 10.1, 10., emptyPoints);
-  auto hvdcLineLCC = dfl::inputs::HvdcLine::build("HVDCLCCLine", dfl::inputs::HvdcLine::ConverterType::LCC, lccStation1, dummyStation, boost::none,
+  auto dummyStation = std::make_shared<dfl::inputs::Converter>("StationN", "_BUS___99_TN", nullptr, dfl::inputs::LCCConverter(1.));
+  auto dummyStationVSC = std::make_shared<dfl::inputs::Converter>("StationN", "_BUS___99_TN", nullptr, dfl::inputs::VSCConverter(false, 0., 0., emptyCurve));
+  auto lccStation1 = std::make_shared<dfl::inputs::Converter>("LCCStation1", "0", nullptr, dfl::inputs::LCCConverter(1.));
+  auto lccStation3 = std::make_shared<dfl::inputs::Converter>("LCCStation3", "3", nullptr, dfl::inputs::LCCConverter(1.));
+  auto lccStation4 = std::make_shared<dfl::inputs::Converter>("LCCStation4", "4", nullptr, dfl::inputs::LCCConverter(1.));
+  auto vscStation1 = std::make_shared<dfl::inputs::Converter>("VSCStation1", "1", nullptr, dfl::inputs::VSCConverter(false, 1.1, 1., emptyCurve));
+  auto vscStation2 = std::make_shared<dfl::inputs::Converter>("VSCStation2", "2", nullptr, dfl::inputs::VSCConverter(true, 2.1, 2., emptyCurve));
+  auto vscStation21 = std::make_shared<dfl::inputs::Converter>("VSCStation21", "2", nullptr, dfl::inputs::VSCConverter(true, 2.1, 2., emptyCurve));
+  auto vscStation22 = std::make_shared<dfl::inputs::Converter>("VSCStation22", "2", nullptr, dfl::inputs::VSCConverter(true, 2.1, 2., emptyCurve));
+  auto vscStation23 = std::make_shared<dfl::inputs::Converter>("VSCStation23", "2", nullptr, dfl::inputs::VSCConverter(true, 2.1, 2., emptyCurve));
+  auto vscStation5 = std::make_shared<dfl::inputs::Converter>("VSCStation5", "5", nullptr, dfl::inputs::VSCConverter(true, 5.1, 5., emptyCurve));
+  auto vscStation6 = std::make_shared<dfl::inputs::Converter>("VSCStation6", "6", nullptr, dfl::inputs::VSCConverter(true, 6.1, 6., emptyCurve));
+  auto vscStation7 = std::make_shared<dfl::inputs::Converter>("VSCStation7", "7", nullptr, dfl::inputs::VSCConverter(true, 7.1, 7., emptyCurve));
+  auto vscStation8 = std::make_shared<dfl::inputs::Converter>("VSCStation8", "8", nullptr, dfl::inputs::VSCConverter(true, 8.1, 8., emptyCurve));
+  auto vscStation9 = std::make_shared<dfl::inputs::Converter>("VSCStation9", "9", nullptr, dfl::inputs::VSCConverter(true, 9.1, 9., emptyCurve));
+  auto vscStation10 = std::make_shared<dfl::inputs::Converter>("VSCStation10", "10", nullptr, dfl::inputs::VSCConverter(true, 10.1, 10., emptyCurve));
+  auto hvdcLineLCC = dfl::inputs::HvdcLine::build("HVDCLCCLine", dfl::inputs::HvdcLine::ConverterType::LCC, lccStation1.get(), dummyStation.get(), boost::none,
                                                   0);  // first is in main cc
-  auto hvdcLineVSC = dfl::inputs::HvdcLine::build("HVDCVSCLine", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation1, dummyStationVSC, boost::none,
-                                                  1);  // first in main cc
-  auto hvdcLineVSC2 = dfl::inputs::HvdcLine::build("HVDCVSCLine2", dfl::inputs::HvdcLine::ConverterType::VSC, dummyStationVSC, vscStation2, boost::none,
-                                                   2);  // second in main cc
-  auto hvdcLineVSC3 = dfl::inputs::HvdcLine::build("HVDCVSCLine3", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation21, dummyStationVSC, boost::none,
-                                                   2);  // first in main cc
-  auto hvdcLineBothInMainComponent = dfl::inputs::HvdcLine::build("HVDCLineBothInMain1", dfl::inputs::HvdcLine::ConverterType::LCC, lccStation3, lccStation4,
-                                                                  boost::none, 3.4);  // both in main cc
-  auto hvdcLineBothInMainComponent2 = dfl::inputs::HvdcLine::build("HVDCLineBothInMain2", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation5, vscStation6,
-                                                                   activeControl, 5.6);  // both in main cc
-  auto hvdcLineBothInMainComponent3 = dfl::inputs::HvdcLine::build("HVDCLineBothInMain3", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation22, vscStation7,
-                                                                   activeControl, 2.7);  // both in main cc
-  auto hvdcLineBothInMainComponent4 = dfl::inputs::HvdcLine::build("HVDCLineBothInMain4", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation9, vscStation10,
-                                                                   boost::none, 9.10);  // both in main cc
-  auto hvdcLineBothInMainComponent5 = dfl::inputs::HvdcLine::build("HVDCLineBothInMain5", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation23, vscStation8,
-                                                                   boost::none, 2.8);  // both in main cc
-  nodes[0]->converters.push_back(lccStation1);
-  nodes[1]->converters.push_back(vscStation1);
-  nodes[2]->converters.push_back(vscStation2);
-  nodes[2]->converters.push_back(vscStation21);
-  nodes[2]->converters.push_back(vscStation22);
-  nodes[2]->converters.push_back(vscStation23);
-  nodes[3]->converters.push_back(lccStation3);
-  nodes[4]->converters.push_back(lccStation4);
-  nodes[5]->converters.push_back(vscStation5);
-  nodes[6]->converters.push_back(vscStation6);
-  nodes[7]->converters.push_back(vscStation7);
-  nodes[8]->converters.push_back(vscStation8);
-  nodes[9]->converters.push_back(vscStation9);
-  nodes[10]->converters.push_back(vscStation10);
+  auto hvdcLineVSC = dfl::inputs::HvdcLine::build("HVDCVSCLine", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation1.get(), dummyStationVSC.get(),
+                                                  boost::none, 1);  // first in main cc
+  auto hvdcLineVSC2 = dfl::inputs::HvdcLine::build("HVDCVSCLine2", dfl::inputs::HvdcLine::ConverterType::VSC, dummyStationVSC.get(), vscStation2.get(),
+                                                   boost::none, 2);  // second in main cc
+  auto hvdcLineVSC3 = dfl::inputs::HvdcLine::build("HVDCVSCLine3", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation21.get(), dummyStationVSC.get(),
+                                                   boost::none, 2);  // first in main cc
+  auto hvdcLineBothInMainComponent = dfl::inputs::HvdcLine::build("HVDCLineBothInMain1", dfl::inputs::HvdcLine::ConverterType::LCC, lccStation3.get(),
+                                                                  lccStation4.get(), boost::none, 3.4);  // both in main cc
+  auto hvdcLineBothInMainComponent2 = dfl::inputs::HvdcLine::build("HVDCLineBothInMain2", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation5.get(),
+                                                                   vscStation6.get(), activeControl, 5.6);  // both in main cc
+  auto hvdcLineBothInMainComponent3 = dfl::inputs::HvdcLine::build("HVDCLineBothInMain3", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation22.get(),
+                                                                   vscStation7.get(), activeControl, 2.7);  // both in main cc
+  auto hvdcLineBothInMainComponent4 = dfl::inputs::HvdcLine::build("HVDCLineBothInMain4", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation9.get(),
+                                                                   vscStation10.get(), boost::none, 9.10);  // both in main cc
+  auto hvdcLineBothInMainComponent5 = dfl::inputs::HvdcLine::build("HVDCLineBothInMain5", dfl::inputs::HvdcLine::ConverterType::VSC, vscStation23.get(),
+                                                                   vscStation8.get(), boost::none, 2.8);  // both in main cc
+  nodes[0]->converters.push_back(lccStation1.get());
+  nodes[1]->converters.push_back(vscStation1.get());
+  nodes[2]->converters.push_back(vscStation2.get());
+  nodes[2]->converters.push_back(vscStation21.get());
+  nodes[2]->converters.push_back(vscStation22.get());
+  nodes[2]->converters.push_back(vscStation23.get());
+  nodes[3]->converters.push_back(lccStation3.get());
+  nodes[4]->converters.push_back(lccStation4.get());
+  nodes[5]->converters.push_back(vscStation5.get());
+  nodes[6]->converters.push_back(vscStation6.get());
+  nodes[7]->converters.push_back(vscStation7.get());
+  nodes[8]->converters.push_back(vscStation8.get());
+  nodes[9]->converters.push_back(vscStation9.get());
+  nodes[10]->converters.push_back(vscStation10.get());
 
   dfl::inputs::NetworkManager::BusMapRegulating busMap{std::make_pair("2", dfl::inputs::NetworkManager::NbOfRegulating::MULTIPLES)};
 
@@ -614,13 +721,13 @@ TEST(hvdcLine, models) {
 }
 
 static void
-testDiagramValidity(std::vector<dfl::inputs::Generator::ReactiveCurvePoint> points, bool isDiagramValid) {
-  using dfl::inputs::Generator;
+testDiagramValidity(std::vector<dfl::inputs::GeneratorTable::ReactiveCurvePoint> points, bool isDiagramValid) {
   auto testServiceManager = boost::make_shared<test::TestAlgoServiceManagerInterface>();
   const std::string bus1 = "BUS_1";
   const std::string bus2 = "BUS_2";
-  Generator generator("G1", points, 3., 30., 33., 330., 100, bus1, bus2);
-  dfl::algo::GeneratorDefinitionAlgorithm::Generators generators;
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
   auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
   std::shared_ptr<dfl::inputs::Node> node = dfl::inputs::Node::build("0", vl, 0.0, {});
 
@@ -628,7 +735,7 @@ testDiagramValidity(std::vector<dfl::inputs::Generator::ReactiveCurvePoint> poin
   dfl::algo::GeneratorDefinitionAlgorithm::BusGenMap busesWithDynamicModel;
   dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busesWithDynamicModel, busMap, false, testServiceManager);
 
-  node->generators.emplace_back(generator);
+  node->generators.push_back(table.add("G1", curves.add(points), 3., 30., 33., 330., 100, bus1, bus2));
   algo_infinite(node);
   if (isDiagramValid) {
     ASSERT_EQ(generators.size(), 1);
@@ -638,54 +745,54 @@ testDiagramValidity(std::vector<dfl::inputs::Generator::ReactiveCurvePoint> poin
 }
 
 TEST(Generators, validDiagram) {
-  using dfl::inputs::Generator;
-  std::vector<Generator::ReactiveCurvePoint> points({Generator::ReactiveCurvePoint(12., 44., 440.), Generator::ReactiveCurvePoint(65., 44., 440.)});
+  using ReactiveCurvePoint = dfl::inputs::GeneratorTable::ReactiveCurvePoint;
+  std::vector<ReactiveCurvePoint> points({ReactiveCurvePoint(12., 44., 440.), ReactiveCurvePoint(65., 44., 440.)});
   bool isDiagramValid = true;
   testDiagramValidity(points, isDiagramValid);
 }
 
 TEST(Generators, allPEqual) {
-  using dfl::inputs::Generator;
-  std::vector<Generator::ReactiveCurvePoint> points({Generator::ReactiveCurvePoint(65., 44., 450.), Generator::ReactiveCurvePoint(65., 24., 420.),
-                                                     Generator::ReactiveCurvePoint(65., 44., 250.), Generator::ReactiveCurvePoint(65., 45., 440.)});
+  using ReactiveCurvePoint = dfl::inputs::GeneratorTable::ReactiveCurvePoint;
+  std::vector<ReactiveCurvePoint> points({ReactiveCurvePoint(65., 44., 450.), ReactiveCurvePoint(65., 24., 420.),
+                                          ReactiveCurvePoint(65., 44., 250.), ReactiveCurvePoint(65., 45., 440.)});
   bool isDiagramValid = false;
   testDiagramValidity(points, isDiagramValid);
 }
 
 TEST(Generators, allQminEqualQmax) {
-  using dfl::inputs::Generator;
-  std::vector<Generator::ReactiveCurvePoint> points({Generator::ReactiveCurvePoint(1., 44., 44.), Generator::ReactiveCurvePoint(2., 420., 420.),
-                                                     Generator::ReactiveCurvePoint(3., 250., 250.), Generator::ReactiveCurvePoint(4., 440., 440.)});
+  using ReactiveCurvePoint = dfl::inputs::GeneratorTable::ReactiveCurvePoint;
+  std::vector<ReactiveCurvePoint> points({ReactiveCurvePoint(1., 44., 44.), ReactiveCurvePoint(2., 420., 420.),
+                                          ReactiveCurvePoint(3., 250., 250.), ReactiveCurvePoint(4., 440., 440.)});
   bool isDiagramValid = false;
   testDiagramValidity(points, isDiagramValid);
 }
 
 TEST(Generators, validDiagram2) {
-  using dfl::inputs::Generator;
-  std::vector<Generator::ReactiveCurvePoint> points({Generator::ReactiveCurvePoint(10., 44., 440.), Generator::ReactiveCurvePoint(12., 44., 440.),
-                                                     Generator::ReactiveCurvePoint(12., 44., 440.), Generator::ReactiveCurvePoint(65., 44., 440.)});
+  using ReactiveCurvePoint = dfl::inputs::GeneratorTable::ReactiveCurvePoint;
+  std::vector<ReactiveCurvePoint> points({ReactiveCurvePoint(10., 44., 440.), ReactiveCurvePoint(12., 44., 440.),
+                                          ReactiveCurvePoint(12., 44., 440.), ReactiveCurvePoint(65., 44., 440.)});
   bool isDiagramValid = true;
   testDiagramValidity(points, isDiagramValid);
 }
 
 TEST(Generators, validDiagram3) {
-  using dfl::inputs::Generator;
-  std::vector<Generator::ReactiveCurvePoint> points({Generator::ReactiveCurvePoint(10., 44., 44.), Generator::ReactiveCurvePoint(11., 44., 44.),
-                                                     Generator::ReactiveCurvePoint(12., 44., 44.), Generator::ReactiveCurvePoint(65., 1., 87.)});
+  using ReactiveCurvePoint = dfl::inputs::GeneratorTable::ReactiveCurvePoint;
+  std::vector<ReactiveCurvePoint> points({ReactiveCurvePoint(10., 44., 44.), ReactiveCurvePoint(11., 44., 44.),
+                                          ReactiveCurvePoint(12., 44., 44.), ReactiveCurvePoint(65., 1., 87.)});
   bool isDiagramValid = true;
   testDiagramValidity(points, isDiagramValid);
 }
 
 TEST(Generators, emptyDiagram) {
-  using dfl::inputs::Generator;
-  std::vector<Generator::ReactiveCurvePoint> points({});
+  using ReactiveCurvePoint = dfl::inputs::GeneratorTable::ReactiveCurvePoint;
+  std::vector<ReactiveCurvePoint> points({});
   bool isDiagramValid = true;
   testDiagramValidity(points, isDiagramValid);
 }
 
 TEST(Generators, oneReactiveCurvePoint) {
-  using dfl::inputs::Generator;
-  std::vector<Generator::ReactiveCurvePoint> points({Generator::ReactiveCurvePoint(12., 44., 440.)});
+  using ReactiveCurvePoint = dfl::inputs::GeneratorTable::ReactiveCurvePoint;
+  std::vector<ReactiveCurvePoint> points({ReactiveCurvePoint(12., 44., 440.)});
   bool isDiagramValid = false;
   testDiagramValidity(points, isDiagramValid);
 }
@@ -794,3 +901,70 @@ TEST(SVARC, base) {
   ASSERT_EQ(optSVarC2->id, "SVARC2");
   ASSERT_EQ(optSVarC2->bMax, 10.);
 }
+
+TEST(NodePipeline, order) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{dfl::inputs::Node::build("0", vl, 0.0, {}), dfl::inputs::Node::build("1", vl, 1.0, {})};
+
+  std::vector<std::string> calls;
+  auto first = [&calls](const std::shared_ptr<dfl::inputs::Node>& node) { calls.push_back("first " + node->id.str()); };
+  auto second = [&calls](const std::shared_ptr<dfl::inputs::Node>& node) { calls.push_back("second " + node->id.str()); };
+  std::for_each(nodes.begin(), nodes.end(), dfl::algo::makeNodePipeline(first, second));
+
+  std::vector<std::string> expected{"first 0", "second 0", "first 1", "second 1"};
+  ASSERT_EQ(expected, calls);
+}
+
+TEST(NodePipeline, equivalent) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  auto vl2 = std::make_shared<dfl::inputs::VoltageLevel>("VL2");
+  std::vector<dfl::inputs::Shunt> shunts1 = {dfl::inputs::Shunt("1.1")};
+  std::vector<dfl::inputs::Shunt> shunts2 = {dfl::inputs::Shunt("2.1"), dfl::inputs::Shunt("2.2")};
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{
+      dfl::inputs::Node::build("0", vl, 0.0, {}),      dfl::inputs::Node::build("1", vl, 1.0, shunts1), dfl::inputs::Node::build("2", vl, 2.0, {}),
+      dfl::inputs::Node::build("3", vl2, 3.0, shunts2), dfl::inputs::Node::build("4", vl2, 5.0, {}),
+  };
+  std::vector<std::shared_ptr<dfl::inputs::Line>> lines{
+      dfl::inputs::Line::build("0", nodes[0], nodes[1], "ETE"),
+      dfl::inputs::Line::build("1", nodes[1], nodes[2], "UNDEFINED"),
+      dfl::inputs::Line::build("2", nodes[3], nodes[4], "HIVER"),
+  };
+  nodes[4]->loads.emplace_back("L4");
+  auto graph = test::buildGraph(nodes, {{0, 1}, {1, 2}, {3, 4}});
+  auto islands = dfl::inputs::Islands::compute(graph);
+
+  // algorithms applied one after the other
+  std::shared_ptr<dfl::inputs::Node> slackNode;
+  dfl::algo::MainConnexComponentAlgorithm::ConnexGroup main;
+  dfl::algo::ShuntCounterDefinitions counters;
+  dfl::algo::LinesByIdDefinitions linesById;
+  dfl::algo::LoadDefinitionAlgorithm::Loads loads;
+  std::for_each(nodes.begin(), nodes.end(), dfl::algo::SlackNodeAlgorithm(slackNode, graph));
+  std::for_each(nodes.begin(), nodes.end(), dfl::algo::MainConnexComponentAlgorithm(main, graph, islands));
+  std::for_each(nodes.begin(), nodes.end(), dfl::algo::ShuntCounterAlgorithm(counters));
+  std::for_each(nodes.begin(), nodes.end(), dfl::algo::LinesByIdAlgorithm(linesById));
+  std::for_each(nodes.begin(), nodes.end(), dfl::algo::LoadDefinitionAlgorithm(loads, 0.));
+
+  // same algorithms in a pipeline, the load algorithm shared by reference
+  std::shared_ptr<dfl::inputs::Node> pipelineSlackNode;
+  dfl::algo::MainConnexComponentAlgorithm::ConnexGroup pipelineMain;
+  dfl::algo::ShuntCounterDefinitions pipelineCounters;
+  dfl::algo::LinesByIdDefinitions pipelineLinesById;
+  dfl::algo::LoadDefinitionAlgorithm::Loads pipelineLoads;
+  dfl::algo::LoadDefinitionAlgorithm loadAlgorithm(pipelineLoads, 0.);
+  auto pipeline = dfl::algo::makeNodePipeline(
+      dfl::algo::SlackNodeAlgorithm(pipelineSlackNode, graph), dfl::algo::MainConnexComponentAlgorithm(pipelineMain, graph, islands),
+      dfl::algo::ShuntCounterAlgorithm(pipelineCounters), dfl::algo::LinesByIdAlgorithm(pipelineLinesById), std::ref(loadAlgorithm));
+  for (const auto& node : nodes) {
+    pipeline(node);
+  }
+
+  ASSERT_EQ(slackNode, pipelineSlackNode);
+  ASSERT_EQ(main, pipelineMain);
+  ASSERT_EQ(counters.nbShunts, pipelineCounters.nbShunts);
+  ASSERT_EQ(linesById.linesMap.size(), pipelineLinesById.linesMap.size());
+  ASSERT_EQ(loads.size(), pipelineLoads.size());
+  ASSERT_EQ(1, pipelineLoads.size());
+  ASSERT_EQ(loads.front().id, pipelineLoads.front().id);
+  ASSERT_EQ(loads.front().nodeId, pipelineLoads.front().nodeId);
+}
@@ -0,0 +1,84 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "Arena.h"
+#include "Tests.h"
+
+#include <cstdint>
+#include <string>
+
+/// @brief Object counting its instances, to check that destructors are called
+struct Counted {
+  explicit Counted(const std::string& name) : name(name) {
+    ++instances;
+  }
+  ~Counted() {
+    --instances;
+  }
+
+  static int instances;  ///< number of living instances
+  std::string name;      ///< name of the object
+};
+
+int Counted::instances = 0;
+
+TEST(Arena, base) {
+  dfl::common::Arena arena(1024);
+  ASSERT_EQ(0, arena.nbBlocks());
+
+  auto first = arena.allocate(10, 1);
+  auto second = arena.allocate(sizeof(double), alignof(double));
+  ASSERT_EQ(1, arena.nbBlocks());
+  ASSERT_EQ(2, arena.nbAllocations());
+  ASSERT_EQ(10 + sizeof(double), arena.size());
+  ASSERT_EQ(0, reinterpret_cast<std::uintptr_t>(second) % alignof(double));
+  ASSERT_GE(static_cast<char*>(second), static_cast<char*>(first) + 10);
+
+  // requests not fitting in the current block use a new block
+  arena.allocate(1010, 1);
+  ASSERT_EQ(2, arena.nbBlocks());
+  // requests larger than the blocks get their own block
+  arena.allocate(4096, 1);
+  ASSERT_EQ(3, arena.nbBlocks());
+  ASSERT_EQ(4, arena.nbAllocations());
+}
+
+TEST(Arena, SharedObjects) {
+  auto arena = std::make_shared<dfl::common::Arena>();
+  {
+    auto object = dfl::common::makeShared<Counted>(arena, "OBJECT");
+    auto other = dfl::common::makeSharedWith<Counted>(arena, [](void* memory) { return new (memory) Counted("OTHER"); });
+    ASSERT_EQ(2, Counted::instances);
+    ASSERT_EQ("OBJECT", object->name);
+    ASSERT_EQ("OTHER", other->name);
+    // objects and their control blocks come from the arena
+    ASSERT_EQ(1, arena->nbBlocks());
+    ASSERT_GE(arena->nbAllocations(), 2);
+  }
+  ASSERT_EQ(0, Counted::instances);
+
+  // objects keep the arena alive
+  auto object = dfl::common::makeShared<Counted>(arena, "OBJECT");
+  std::weak_ptr<dfl::common::Arena> weakArena = arena;
+  arena.reset();
+  ASSERT_FALSE(weakArena.expired());
+  object.reset();
+  ASSERT_TRUE(weakArena.expired());
+  ASSERT_EQ(0, Counted::instances);
+}
+
+TEST(Arena, Heap) {
+  {
+    auto object = dfl::common::makeShared<Counted>(nullptr, "OBJECT");
+    auto other = dfl::common::makeSharedWith<Counted>(nullptr, [](void* memory) { return new (memory) Counted("OTHER"); });
+    ASSERT_EQ(2, Counted::instances);
+    ASSERT_EQ("OTHER", other->name);
+  }
+  ASSERT_EQ(0, Counted::instances);
+}
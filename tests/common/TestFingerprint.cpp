@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "Fingerprint.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+TEST(Fingerprint, base) {
+  dfl::common::Fingerprint empty;
+  ASSERT_EQ(0xcbf29ce484222325ULL, empty.value());
+  ASSERT_EQ("cbf29ce484222325", empty.str());
+
+  // FNV-1a reference value
+  dfl::common::Fingerprint bytes;
+  bytes.add("a", 1);
+  ASSERT_EQ(0xaf63dc4c8601ec8cULL, bytes.value());
+
+  dfl::common::Fingerprint fingerprint1;
+  fingerprint1.add("GEN_1").add(12.5).add(true);
+  dfl::common::Fingerprint fingerprint2;
+  fingerprint2.add(std::string("GEN_1")).add(12.5).add(true);
+  ASSERT_EQ(fingerprint1.value(), fingerprint2.value());
+
+  // length prefix: the boundaries between the strings are part of the fingerprint
+  dfl::common::Fingerprint split1;
+  split1.add("AB").add("C");
+  dfl::common::Fingerprint split2;
+  split2.add("A").add("BC");
+  ASSERT_NE(split1.value(), split2.value());
+
+  dfl::common::Fingerprint zero;
+  zero.add(0.);
+  dfl::common::Fingerprint negativeZero;
+  negativeZero.add(-0.);
+  ASSERT_EQ(zero.value(), negativeZero.value());
+
+  dfl::common::Fingerprint none;
+  none.add(boost::optional<double>());
+  dfl::common::Fingerprint some;
+  some.add(boost::optional<double>(0.));
+  ASSERT_NE(none.value(), some.value());
+}
+
+TEST(Fingerprint, unordered) {
+  std::unordered_map<std::string, double> values;
+  std::map<std::string, double> sortedValues;
+  for (unsigned int i = 0; i < 100; ++i) {
+    values["ID_" + std::to_string(i)] = i * 0.5;
+  }
+  // same content, inserted in the other order
+  for (unsigned int i = 100; i > 0; --i) {
+    sortedValues["ID_" + std::to_string(i - 1)] = (i - 1) * 0.5;
+  }
+  auto addValue = [](dfl::common::Fingerprint& fingerprint, const std::pair<const std::string, double>& value) {
+    fingerprint.add(value.first).add(value.second);
+  };
+
+  dfl::common::Fingerprint fingerprint1;
+  fingerprint1.addUnordered(values, addValue);
+  dfl::common::Fingerprint fingerprint2;
+  fingerprint2.addUnordered(sortedValues, addValue);
+  ASSERT_EQ(fingerprint1.value(), fingerprint2.value());
+
+  values["ID_0"] = 1.;
+  dfl::common::Fingerprint fingerprint3;
+  fingerprint3.addUnordered(values, addValue);
+  ASSERT_NE(fingerprint1.value(), fingerprint3.value());
+}
+
+TEST(Fingerprint, files) {
+  const boost::filesystem::path directory("results/TestFingerprint");
+  boost::filesystem::create_directories(directory);
+  const auto contentFile = directory / "content.par";
+  {
+    std::ofstream file(contentFile.c_str());
+    file << "<parametersSet/>" << std::endl;
+  }
+
+  dfl::common::Fingerprint fingerprint1;
+  fingerprint1.addFile(contentFile);
+  dfl::common::Fingerprint missing;
+  missing.addFile(directory / "missing.par");
+  ASSERT_NE(fingerprint1.value(), missing.value());
+
+  {
+    std::ofstream file(contentFile.c_str(), std::ios::app);
+    file << "<parametersSet/>" << std::endl;
+  }
+  dfl::common::Fingerprint fingerprint2;
+  fingerprint2.addFile(contentFile);
+  ASSERT_NE(fingerprint1.value(), fingerprint2.value());
+
+  const auto fingerprintFile = directory / "test.fingerprint";
+  boost::filesystem::remove(fingerprintFile);
+  ASSERT_FALSE(dfl::common::Fingerprint::load(fingerprintFile));
+  fingerprint2.save(fingerprintFile);
+  const auto loaded = dfl::common::Fingerprint::load(fingerprintFile);
+  ASSERT_TRUE(loaded);
+  ASSERT_EQ(fingerprint2.str(), *loaded);
+}
@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "MemoryFootprint.h"
+#include "Tests.h"
+
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+TEST(MemoryFootprint, base) {
+  dfl::common::MemoryFootprint footprint;
+  ASSERT_EQ(0, footprint.totalBytes());
+
+  footprint.add("network.nodes", 3, 120);
+  footprint.add("symbols", 2, 64);
+  ASSERT_EQ(2, footprint.entries().size());
+  ASSERT_EQ("network.nodes", footprint.entries()[0].name);
+  ASSERT_EQ(3, footprint.entries()[0].count);
+  ASSERT_EQ(184, footprint.totalBytes());
+
+  std::stringstream ss;
+  footprint.writeJson(ss);
+  ASSERT_EQ("{\n"
+            "  \"totalBytes\": 184,\n"
+            "  \"structures\": [\n"
+            "    {\"name\": \"network.nodes\", \"count\": 3, \"bytes\": 120},\n"
+            "    {\"name\": \"symbols\", \"count\": 2, \"bytes\": 64}\n"
+            "  ]\n"
+            "}\n",
+            ss.str());
+}
+
+TEST(MemoryFootprint, empty) {
+  dfl::common::MemoryFootprint footprint;
+
+  std::stringstream ss;
+  footprint.writeJson(ss);
+  ASSERT_EQ("{\n  \"totalBytes\": 0,\n  \"structures\": []\n}\n", ss.str());
+}
+
+TEST(MemoryFootprint, containers) {
+  using dfl::common::memory::hashBytes;
+  using dfl::common::memory::stringBytes;
+  using dfl::common::memory::vectorBytes;
+
+  ASSERT_EQ(0, stringBytes(""));
+  const std::string longString(100, 'a');
+  ASSERT_LE(101, stringBytes(longString));
+
+  std::vector<double> values;
+  ASSERT_EQ(0, vectorBytes(values));
+  values.reserve(10);
+  ASSERT_EQ(10 * sizeof(double), vectorBytes(values));
+
+  std::vector<std::string> strings{"", longString};
+  ASSERT_EQ(vectorBytes(strings) + stringBytes(longString), vectorBytes(strings, [](const std::string& str) { return stringBytes(str); }));
+
+  std::unordered_map<int, int> map;
+  const auto emptyBytes = hashBytes(map);
+  map.emplace(0, 1);
+  map.emplace(1, 2);
+  ASSERT_LE(emptyBytes + 2 * (sizeof(std::pair<const int, int>) + dfl::common::memory::hashNodeBytes), hashBytes(map));
+}
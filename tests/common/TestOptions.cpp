@@ -95,3 +95,18 @@ TEST(Options, wrongLogLevel) {
   ASSERT_FALSE(std::get<0>(status));
   ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION, std::get<1>(status));
 }
+
+TEST(Options, memoryReport) {
+  dfl::common::Options options;
+
+  char argv0[] = {"DynawoLauncher"};
+  char argv1[] = {"--network=test.iidm"};
+  char argv2[] = {"--config=test.json"};
+  char argv3[] = {"--memory-report=memory.json"};
+  char* argv[] = {argv0, argv1, argv2, argv3};
+  ASSERT_TRUE(options.config().memoryReportPath.empty());
+  auto status = options.parse(4, argv);
+  ASSERT_TRUE(std::get<0>(status));
+  ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION, std::get<1>(status));
+  ASSERT_EQ("memory.json", options.config().memoryReportPath);
+}
@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "SmallVector.h"
+#include "Tests.h"
+
+#include <string>
+#include <vector>
+
+/// @brief Non assignable object counting its instances, to check that destructors are called
+struct Counted {
+  explicit Counted(const std::string& name) : name(name) {
+    ++instances;
+  }
+  Counted(const Counted& other) : name(other.name) {
+    ++instances;
+  }
+  Counted(Counted&& other) : name(std::move(other.name)) {
+    ++instances;
+  }
+  ~Counted() {
+    --instances;
+  }
+
+  static int instances;    ///< number of living instances
+  const std::string name;  ///< name of the object
+};
+
+int Counted::instances = 0;
+
+TEST(SmallVector, base) {
+  dfl::common::SmallVector<int, 2> vector;
+  ASSERT_TRUE(vector.empty());
+  ASSERT_EQ(2, vector.capacity());
+  ASSERT_TRUE(vector.isInline());
+
+  vector.push_back(1);
+  vector.emplace_back(2);
+  ASSERT_EQ(2, vector.size());
+  ASSERT_TRUE(vector.isInline());
+
+  // exceeding the inline capacity moves the elements to the heap
+  vector.push_back(3);
+  ASSERT_FALSE(vector.isInline());
+  ASSERT_EQ(4, vector.capacity());
+  ASSERT_EQ((std::vector<int>{1, 2, 3}), std::vector<int>(vector.begin(), vector.end()));
+  ASSERT_EQ(1, vector.front());
+  ASSERT_EQ(3, vector.back());
+
+  // an element of the vector can be added while the vector grows
+  vector.push_back(vector[0]);
+  vector.push_back(vector[1]);
+  ASSERT_EQ((std::vector<int>{1, 2, 3, 1, 2}), std::vector<int>(vector.begin(), vector.end()));
+
+  vector.pop_back();
+  ASSERT_EQ(4, vector.size());
+  vector.clear();
+  ASSERT_TRUE(vector.empty());
+  ASSERT_FALSE(vector.isInline());
+}
+
+TEST(SmallVector, NoInlineStorage) {
+  dfl::common::SmallVector<int, 0> vector;
+  ASSERT_LT(sizeof(vector), sizeof(std::vector<int>));
+  ASSERT_EQ(0, vector.capacity());
+  ASSERT_TRUE(vector.isInline());
+
+  vector.push_back(1);
+  ASSERT_FALSE(vector.isInline());
+  ASSERT_EQ(1, vector.capacity());
+  ASSERT_EQ(1, vector[0]);
+}
+
+TEST(SmallVector, Erase) {
+  {
+    dfl::common::SmallVector<Counted, 2> vector(std::vector<Counted>{Counted("A"), Counted("B"), Counted("C"), Counted("D")});
+    ASSERT_EQ(4, Counted::instances);
+
+    auto it = vector.erase(vector.begin() + 1);
+    ASSERT_EQ("C", it->name);
+    ASSERT_EQ(3, Counted::instances);
+    it = vector.erase(vector.begin(), vector.begin() + 1);
+    ASSERT_EQ(vector.begin(), it);
+    ASSERT_EQ(2, vector.size());
+    ASSERT_EQ("C", vector[0].name);
+    ASSERT_EQ("D", vector[1].name);
+    ASSERT_EQ(2, Counted::instances);
+  }
+  ASSERT_EQ(0, Counted::instances);
+}
+
+TEST(SmallVector, CopyAndMove) {
+  {
+    dfl::common::SmallVector<Counted, 1> small;
+    small.emplace_back("A");
+    dfl::common::SmallVector<Counted, 1> large;
+    large.emplace_back("B");
+    large.emplace_back("C");
+
+    // inline elements are moved one by one
+    auto copy = small;
+    auto moved = std::move(small);
+    ASSERT_TRUE(small.empty());
+    ASSERT_TRUE(moved.isInline());
+    ASSERT_EQ("A", moved[0].name);
+    ASSERT_EQ("A", copy[0].name);
+
+    // heap storage is taken over
+    const auto* data = large.begin();
+    moved = std::move(large);
+    ASSERT_TRUE(large.empty());
+    ASSERT_TRUE(large.isInline());
+    ASSERT_EQ(data, moved.begin());
+    ASSERT_EQ(2, moved.size());
+    ASSERT_EQ("B", moved[0].name);
+
+    copy = moved;
+    ASSERT_EQ(2, copy.size());
+    ASSERT_EQ("C", copy[1].name);
+    ASSERT_EQ(4, Counted::instances);
+  }
+  ASSERT_EQ(0, Counted::instances);
+}
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "Parallel.h"
+#include "Symbol.h"
+#include "Tests.h"
+
+#include <set>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+TEST(Symbol, base) {
+  dfl::common::Symbol empty;
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty, dfl::common::Symbol(""));
+
+  dfl::common::Symbol bus("BUS_1");
+  dfl::common::Symbol same(std::string("BUS_") + "1");
+  dfl::common::Symbol other("BUS_2");
+  ASSERT_EQ(bus, same);
+  ASSERT_EQ(bus.handle(), same.handle());
+  ASSERT_EQ(&bus.str(), &same.str());
+  ASSERT_NE(bus, other);
+  ASSERT_EQ("BUS_1", bus.str());
+  ASSERT_FALSE(bus.empty());
+
+  std::stringstream ss;
+  ss << bus;
+  ASSERT_EQ("BUS_1", ss.str());
+
+  std::unordered_map<dfl::common::Symbol, int> map;
+  map[bus] = 1;
+  map["BUS_2"] = 2;
+  ASSERT_EQ(1, map.at("BUS_1"));
+  ASSERT_EQ(2, map.at(other));
+}
+
+TEST(Symbol, Order) {
+  // symbols are ordered by their strings, not by their handles
+  dfl::common::Symbol last("ZZZ_ORDER");
+  dfl::common::Symbol first("AAA_ORDER");
+  ASSERT_LT(last.handle(), first.handle());
+  ASSERT_TRUE(first < last);
+  ASSERT_FALSE(last < first);
+  ASSERT_FALSE(first < first);
+  ASSERT_TRUE(last > first);
+
+  std::set<dfl::common::Symbol> symbols{"C_ORDER", "A_ORDER", "B_ORDER"};
+  std::vector<std::string> expected{"A_ORDER", "B_ORDER", "C_ORDER"};
+  std::vector<std::string> strings;
+  for (const auto& symbol : symbols) {
+    strings.push_back(symbol.str());
+  }
+  ASSERT_EQ(expected, strings);
+}
+
+TEST(Symbol, Concurrent) {
+  const std::size_t nbStrings = 1000;
+  const unsigned int nbThreads = 4;
+  std::vector<std::vector<dfl::common::Symbol>> symbols(nbThreads);
+  dfl::common::parallelFor(nbThreads, nbThreads, [&symbols, nbStrings](std::size_t begin, std::size_t end) {
+    for (auto thread = begin; thread < end; ++thread) {
+      for (std::size_t i = 0; i < nbStrings; ++i) {
+        symbols[thread].emplace_back("CONCURRENT_" + std::to_string(i));
+      }
+    }
+  });
+
+  for (unsigned int thread = 1; thread < nbThreads; ++thread) {
+    ASSERT_EQ(symbols[0], symbols[thread]);
+  }
+  for (std::size_t i = 0; i < nbStrings; ++i) {
+    ASSERT_EQ("CONCURRENT_" + std::to_string(i), symbols[0][i].str());
+  }
+}
@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "SymbolIndex.h"
+#include "Tests.h"
+
+#include <string>
+
+TEST(SymbolIndex, base) {
+  dfl::common::SymbolIndex index;
+  ASSERT_EQ(0, index.size());
+  ASSERT_EQ(dfl::common::SymbolIndex::npos, index.find("INDEX_0"));
+
+  ASSERT_TRUE(index.insert("INDEX_0", 0));
+  ASSERT_TRUE(index.insert("INDEX_1", 1));
+  ASSERT_EQ(2, index.size());
+  ASSERT_EQ(0, index.find("INDEX_0"));
+  ASSERT_EQ(1, index.find(std::string("INDEX_") + "1"));
+  ASSERT_TRUE(index.contains("INDEX_1"));
+  ASSERT_FALSE(index.contains("INDEX_2"));
+
+  // duplicated symbols keep their first position
+  ASSERT_FALSE(index.insert("INDEX_0", 3));
+  ASSERT_EQ(2, index.size());
+  ASSERT_EQ(0, index.find("INDEX_0"));
+}
+
+TEST(SymbolIndex, Growth) {
+  const dfl::common::SymbolIndex::Position nbSymbols = 10000;
+
+  dfl::common::SymbolIndex index;
+  index.reserve(10);
+  for (dfl::common::SymbolIndex::Position i = 0; i < nbSymbols; i++) {
+    ASSERT_TRUE(index.insert("GROWTH_" + std::to_string(i), i));
+  }
+  ASSERT_EQ(nbSymbols, index.size());
+  for (dfl::common::SymbolIndex::Position i = 0; i < nbSymbols; i++) {
+    ASSERT_EQ(i, index.find("GROWTH_" + std::to_string(i)));
+  }
+  ASSERT_FALSE(index.contains("GROWTH_" + std::to_string(nbSymbols)));
+}
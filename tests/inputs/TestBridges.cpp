@@ -0,0 +1,114 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "Bridges.h"
+#include "Islands.h"
+#include "Node.h"
+#include "Tests.h"
+
+#include <string>
+#include <vector>
+
+TEST(TestBridges, base) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < 8; ++i) {
+    builder.addNode(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+  }
+  // loop 0-1-2, bridge 2-3, parallel lines 3-4, bridge 4-5 with loop 5-6-7, open edge 0-7
+  builder.addEdge(0, 1, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(1, 2, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(2, 0, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(2, 3, dfl::inputs::Graph::EdgeType::TFO);
+  builder.addEdge(3, 4, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(3, 4, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(4, 5, dfl::inputs::Graph::EdgeType::SWITCH);
+  builder.addEdge(5, 6, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(6, 7, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(7, 5, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(0, 7, dfl::inputs::Graph::EdgeType::SWITCH, true);
+  auto graph = builder.build();
+
+  auto bridges = dfl::inputs::Bridges::compute(graph);
+
+  std::vector<bool> expected_bridges{false, false, false, true, false, false, true, false, false, false, false};
+  for (dfl::inputs::Graph::EdgeIndex edge = 0; edge < graph.nbEdges(); ++edge) {
+    ASSERT_EQ(expected_bridges[edge], bridges.isBridge(edge)) << "edge " << edge;
+  }
+  std::vector<bool> expected_articulationPoints{false, false, true, true, true, true, false, false};
+  for (dfl::inputs::Graph::NodeIndex index = 0; index < graph.nbNodes(); ++index) {
+    ASSERT_EQ(expected_articulationPoints[index], bridges.isArticulationPoint(index)) << "node " << index;
+  }
+
+  // the transformer splits nodes 3 to 7 from the loop
+  auto root = bridges.subtreeRoot(graph, 3);
+  ASSERT_EQ(root, 3);
+  ASSERT_EQ(bridges.subtreeSize(root), 5);
+  ASSERT_EQ(bridges.orderedNodes().size(), graph.nbNodes());
+  ASSERT_EQ(bridges.orderedNodes()[bridges.order(root)], root);
+}
+
+TEST(TestBridges, Random) {
+  const unsigned int nbNodes = 300;
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < nbNodes; ++i) {
+    builder.addNode(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+  }
+  std::uint32_t seed = 42;
+  for (unsigned int i = 0; i < nbNodes; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    auto node1 = seed % nbNodes;
+    seed = seed * 1664525u + 1013904223u;
+    auto node2 = seed % nbNodes;
+    builder.addEdge(node1, node2, dfl::inputs::Graph::EdgeType::LINE);
+  }
+  auto graph = builder.build();
+  auto bridges = dfl::inputs::Bridges::compute(graph);
+  auto islands = dfl::inputs::Islands::compute(graph);
+
+  // an edge is a bridge if opening it adds an island, and its subtree is the island split
+  for (dfl::inputs::Graph::EdgeIndex edge = 0; edge < graph.nbEdges(); ++edge) {
+    graph.setEdgeOpen(edge, true);
+    auto split = dfl::inputs::Islands::compute(graph);
+    graph.setEdgeOpen(edge, false);
+    ASSERT_EQ(split.nbIslands() > islands.nbIslands(), bridges.isBridge(edge)) << "edge " << edge;
+    if (bridges.isBridge(edge)) {
+      auto root = bridges.subtreeRoot(graph, edge);
+      ASSERT_EQ(split.size(split.labels()[root]), bridges.subtreeSize(root));
+      for (auto order = bridges.order(root); order < bridges.order(root) + bridges.subtreeSize(root); ++order) {
+        ASSERT_EQ(split.labels()[bridges.orderedNodes()[order]], split.labels()[root]);
+      }
+    }
+  }
+}
+
+TEST(TestBridges, LongChain) {
+  // radial chain long enough to overflow the stack of a recursive search
+  const unsigned int nbNodes = 200000;
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < nbNodes; ++i) {
+    builder.addNode(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+  }
+  for (unsigned int i = 1; i < nbNodes; ++i) {
+    builder.addEdge(i - 1, i, dfl::inputs::Graph::EdgeType::LINE);
+  }
+  auto graph = builder.build();
+
+  auto bridges = dfl::inputs::Bridges::compute(graph);
+
+  for (dfl::inputs::Graph::EdgeIndex edge = 0; edge < graph.nbEdges(); ++edge) {
+    ASSERT_TRUE(bridges.isBridge(edge));
+  }
+  ASSERT_FALSE(bridges.isArticulationPoint(0));
+  ASSERT_TRUE(bridges.isArticulationPoint(1));
+  ASSERT_EQ(bridges.subtreeSize(bridges.subtreeRoot(graph, nbNodes - 2)), 1);
+}
@@ -19,10 +19,13 @@ TEST(Config, Nominal) {
   ASSERT_FALSE(config.isSVCRegulationOn());
   ASSERT_FALSE(config.isShuntRegulationOn());
   ASSERT_FALSE(config.isAutomaticSlackBusOn());
+  ASSERT_TRUE(config.isNetworkPrescanOn());
   ASSERT_EQ(config.settingFilePath().generic_string(), "res/setting.xml");
   ASSERT_EQ(config.assemblingFilePath().generic_string(), "res/assembling.xml");
   ASSERT_EQ("/tmp", config.outputDir());
   ASSERT_EQ(63.0, config.getDsoVoltageLevel());
+  ASSERT_EQ(4, config.getNbThreads());
+  ASSERT_EQ("/tmp/dfl-cache", config.getNetworkCacheDir().generic_string());
   ASSERT_EQ(dfl::inputs::Configuration::ActivePowerCompensation::P, config.getActivePowerCompensation());
 }
 
@@ -34,9 +37,12 @@ TEST(Config, Default) {
   ASSERT_TRUE(config.isSVCRegulationOn());
   ASSERT_TRUE(config.isShuntRegulationOn());
   ASSERT_TRUE(config.isAutomaticSlackBusOn());
+  ASSERT_FALSE(config.isNetworkPrescanOn());
   ASSERT_EQ(config.settingFilePath().generic_string(), "");
   ASSERT_EQ(config.assemblingFilePath().generic_string(), "");
   ASSERT_EQ(boost::filesystem::current_path().generic_string(), config.outputDir());
   ASSERT_EQ(45.0, config.getDsoVoltageLevel());
+  ASSERT_EQ(1, config.getNbThreads());
+  ASSERT_TRUE(config.getNetworkCacheDir().empty());
   ASSERT_EQ(dfl::inputs::Configuration::ActivePowerCompensation::PMAX, config.getActivePowerCompensation());
 }
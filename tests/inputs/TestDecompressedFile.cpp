@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "DecompressedFile.h"
+#include "Tests.h"
+
+#include <fstream>
+#include <iterator>
+
+static std::string
+readFile(const boost::filesystem::path& filepath) {
+  std::ifstream file(filepath.generic_string(), std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+TEST(DecompressedFile, base) {
+  using dfl::inputs::DecompressedFile;
+
+  ASSERT_FALSE(DecompressedFile::isCompressed("res/IEEE14.iidm"));
+  DecompressedFile file("res/IEEE14.iidm");
+  ASSERT_EQ("res/IEEE14.iidm", file.filepath().generic_string());
+}
+
+TEST(DecompressedFile, formats) {
+  using dfl::inputs::DecompressedFile;
+
+  for (const std::string& filepath : {"res/IEEE14.iidm", "res/Generators.iidm", "res/HvdcDangling.iidm"}) {
+    const std::string compressedFilepath = filepath + (filepath == "res/IEEE14.iidm" ? ".gz" : filepath == "res/Generators.iidm" ? ".xz" : ".zst");
+    ASSERT_TRUE(DecompressedFile::isCompressed(compressedFilepath));
+
+    boost::filesystem::path decompressedFilepath;
+    {
+      DecompressedFile file(compressedFilepath);
+      decompressedFilepath = file.filepath();
+      ASSERT_EQ(boost::filesystem::path(filepath).filename(), decompressedFilepath.filename());
+      ASSERT_FALSE(boost::filesystem::is_regular_file(decompressedFilepath));
+      ASSERT_EQ(readFile(filepath), readFile(decompressedFilepath));
+      ASSERT_NO_THROW(file.close());
+    }
+    ASSERT_FALSE(boost::filesystem::exists(decompressedFilepath));
+  }
+}
+
+TEST(DecompressedFile, truncated) {
+  using dfl::inputs::DecompressedFile;
+
+  ASSERT_TRUE(DecompressedFile::isCompressed("res/Truncated.iidm.gz"));
+  DecompressedFile file("res/Truncated.iidm.gz");
+  readFile(file.filepath());
+  ASSERT_THROW(file.close(), std::runtime_error);
+}
+
+TEST(DecompressedFile, unread) {
+  using dfl::inputs::DecompressedFile;
+
+  {
+    DecompressedFile file("res/IEEE14.iidm.gz");
+    ASSERT_NO_THROW(file.close());
+  }
+  {
+    DecompressedFile file("res/IEEE14.iidm.gz");
+    {
+      std::ifstream stream(file.filepath().generic_string(), std::ios::binary);
+      char header[5] = {};
+      stream.read(header, sizeof(header));
+      ASSERT_EQ("<?xml", std::string(header, sizeof(header)));
+    }
+    ASSERT_NO_THROW(file.close());
+  }
+  {
+    // destroyed without being closed
+    DecompressedFile file("res/IEEE14.iidm.gz");
+  }
+}
+
+TEST(DecompressedFile, decompress) {
+  using dfl::inputs::DecompressedFile;
+
+  const boost::filesystem::path decompressedFilepath = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+  DecompressedFile::decompress("res/IEEE14.iidm.gz", decompressedFilepath);
+  ASSERT_EQ(readFile("res/IEEE14.iidm"), readFile(decompressedFilepath));
+  boost::filesystem::remove(decompressedFilepath);
+}
+
+TEST(DecompressedFile, uncompressedFilename) {
+  using dfl::inputs::DecompressedFile;
+
+  ASSERT_EQ("network.iidm", DecompressedFile::uncompressedFilename("dir/network.iidm.gz").generic_string());
+  ASSERT_EQ("network.iidm", DecompressedFile::uncompressedFilename("dir/network.iidm.zst").generic_string());
+  ASSERT_EQ("network.iidm", DecompressedFile::uncompressedFilename("dir/network.iidm").generic_string());
+}
@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "GeneratorTable.h"
+#include "Tests.h"
+
+#include <vector>
+
+TEST(TestGeneratorTable, base) {
+  using dfl::inputs::GeneratorTable;
+  dfl::inputs::ReactiveCurveStore curves;
+  GeneratorTable table(curves);
+
+  std::vector<GeneratorTable::ReactiveCurvePoint> points{GeneratorTable::ReactiveCurvePoint(3., 33., 330.), GeneratorTable::ReactiveCurvePoint(1., 11., 110.),
+                                                         GeneratorTable::ReactiveCurvePoint(2., 22., 220.)};
+  auto row0 = table.add("G0", curves.add(points), 1., 10., 11., 110., 100., "BUS_1", "BUS_2");
+  auto row1 = table.add("G1", dfl::inputs::ReactiveCurveStore::emptyCurve, 2., 20., 22., 220., 0., "BUS_2", "BUS_2");
+  auto row2 = table.add("G2", curves.add({GeneratorTable::ReactiveCurvePoint(5., 55., 550.)}), 3., 30., 33., 330., 50., "BUS_3", "BUS_3");
+
+  ASSERT_EQ(table.size(), 3);
+  ASSERT_EQ(row0, 0);
+  ASSERT_EQ(row1, 1);
+  ASSERT_EQ(row2, 2);
+  ASSERT_EQ(table.ids()[row1], "G1");
+  ASSERT_EQ(table.qmin()[row2], 3.);
+  ASSERT_EQ(table.qmax()[row2], 30.);
+  ASSERT_EQ(table.pmin()[row2], 33.);
+  ASSERT_EQ(table.pmax()[row2], 330.);
+  ASSERT_EQ(table.targetP()[row0], 100.);
+  ASSERT_EQ(table.regulatedBusIds()[row0], "BUS_1");
+  ASSERT_EQ(table.connectedBusIds()[row0], "BUS_2");
+
+  // points are sorted by active power
+  auto points0 = table.points(row0);
+  ASSERT_EQ(points0.size(), 3);
+  ASSERT_EQ(points0[0].p, 1.);
+  ASSERT_EQ(points0[1].p, 2.);
+  ASSERT_EQ(points0[2].p, 3.);
+  ASSERT_EQ(points0.front().qmax, 110.);
+
+  ASSERT_EQ(table.curveIds()[row1], dfl::inputs::ReactiveCurveStore::emptyCurve);
+  ASSERT_TRUE(table.points(row1).empty());
+  ASSERT_EQ(table.points(row2).size(), 1);
+  ASSERT_EQ(table.points(row2).front().p, 5.);
+
+  // generators with the same curve share it
+  auto row3 = table.add("G3", curves.add(points), 4., 40., 44., 440., 0., "BUS_4", "BUS_4");
+  ASSERT_EQ(table.curveIds()[row3], table.curveIds()[row0]);
+
+  table.clear();
+  ASSERT_EQ(table.size(), 0);
+  auto row = table.add("G4", curves.add(points), 1., 10., 11., 110., 100., "BUS_1", "BUS_1");
+  ASSERT_EQ(row, 0);
+  ASSERT_EQ(table.points(row).size(), 3);
+}
@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "Graph.h"
+#include "Node.h"
+#include "Tests.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+TEST(TestGraph, empty) {
+  dfl::inputs::Graph::Builder builder;
+  auto graph = builder.build();
+
+  ASSERT_EQ(graph.nbNodes(), 0);
+  ASSERT_EQ(graph.nbEdges(), 0);
+}
+
+TEST(TestGraph, base) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  auto vl2 = std::make_shared<dfl::inputs::VoltageLevel>("VL2");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{dfl::inputs::Node::build("0", vl, 0.0, {}), dfl::inputs::Node::build("1", vl, 0.0, {}),
+                                                        dfl::inputs::Node::build("2", vl2, 0.0, {}), dfl::inputs::Node::build("3", vl2, 0.0, {}),
+                                                        dfl::inputs::Node::build("4", vl2, 0.0, {})};
+
+  dfl::inputs::Graph::Builder builder;
+  for (const auto& node : nodes) {
+    builder.addNode(node);
+  }
+  ASSERT_EQ(nodes[3]->index, 3);
+
+  builder.addEdge(0, 1, dfl::inputs::Graph::EdgeType::SWITCH);
+  builder.addEdge(1, 2, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(2, 3, dfl::inputs::Graph::EdgeType::TFO);
+  builder.addEdge(2, 4, dfl::inputs::Graph::EdgeType::TFO);
+  builder.addEdge(3, 4, dfl::inputs::Graph::EdgeType::TFO);
+  auto graph = builder.build();
+
+  ASSERT_EQ(graph.nbNodes(), 5);
+  ASSERT_EQ(graph.nbEdges(), 5);
+  ASSERT_EQ(graph.node(2), nodes[2]);
+  ASSERT_EQ(graph.degree(0), 1);
+  ASSERT_EQ(graph.degree(1), 2);
+  ASSERT_EQ(graph.degree(2), 3);
+  ASSERT_EQ(graph.degree(3), 2);
+  ASSERT_EQ(graph.degree(4), 2);
+
+  // adjacency keeps the insertion order of the edges
+  auto neighbours = graph.neighbours(2);
+  std::vector<dfl::inputs::Graph::NodeIndex> expected_neighbours{1, 3, 4};
+  ASSERT_EQ(expected_neighbours, std::vector<dfl::inputs::Graph::NodeIndex>(neighbours.begin(), neighbours.end()));
+
+  auto edges = graph.incidentEdges(2);
+  std::vector<dfl::inputs::Graph::EdgeIndex> expected_edges{1, 2, 3};
+  ASSERT_EQ(expected_edges, std::vector<dfl::inputs::Graph::EdgeIndex>(edges.begin(), edges.end()));
+
+  ASSERT_EQ(graph.edgeType(0), dfl::inputs::Graph::EdgeType::SWITCH);
+  ASSERT_EQ(graph.edgeType(1), dfl::inputs::Graph::EdgeType::LINE);
+  ASSERT_EQ(graph.edgeType(4), dfl::inputs::Graph::EdgeType::TFO);
+  ASSERT_EQ(graph.edgeNode1(1), 1);
+  ASSERT_EQ(graph.edgeNode2(1), 2);
+}
+
+TEST(TestGraph, openEdges) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < 3; ++i) {
+    builder.addNode(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+  }
+  ASSERT_EQ(builder.addEdge(0, 1, dfl::inputs::Graph::EdgeType::SWITCH, true), 0);
+  ASSERT_EQ(builder.addEdge(1, 2, dfl::inputs::Graph::EdgeType::LINE), 1);
+  auto graph = builder.build();
+
+  // open edges stay in the adjacency but not in the degree
+  ASSERT_TRUE(graph.isEdgeOpen(0));
+  ASSERT_FALSE(graph.isEdgeOpen(1));
+  ASSERT_EQ(graph.degree(0), 0);
+  ASSERT_EQ(graph.degree(1), 1);
+  ASSERT_EQ(graph.neighbours(1).size(), 2);
+
+  ASSERT_TRUE(graph.setEdgeOpen(0, false));
+  ASSERT_FALSE(graph.setEdgeOpen(0, false));
+  ASSERT_EQ(graph.degree(0), 1);
+  ASSERT_EQ(graph.degree(1), 2);
+  ASSERT_TRUE(graph.setEdgeOpen(1, true));
+  ASSERT_EQ(graph.degree(1), 1);
+  ASSERT_EQ(graph.degree(2), 0);
+}
+
+TEST(TestGraph, copy) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < 3; ++i) {
+    builder.addNode(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+  }
+  builder.addEdge(0, 1, dfl::inputs::Graph::EdgeType::SWITCH, true);
+  builder.addEdge(1, 2, dfl::inputs::Graph::EdgeType::LINE);
+  auto graph = builder.build();
+
+  // the copy keeps the nodes, the edges and their states, a fictitious node having no node data
+  dfl::inputs::Graph::Builder copyBuilder(graph);
+  ASSERT_EQ(copyBuilder.addFictitiousNode(), 3);
+  ASSERT_EQ(copyBuilder.addEdge(2, 3, dfl::inputs::Graph::EdgeType::TFO), 2);
+  auto copy = copyBuilder.build();
+  ASSERT_EQ(copy.nbNodes(), 4);
+  ASSERT_EQ(copy.nbEdges(), 3);
+  ASSERT_EQ(copy.node(1), graph.node(1));
+  ASSERT_EQ(copy.node(1)->index, 1);
+  ASSERT_EQ(copy.node(3), nullptr);
+  ASSERT_TRUE(copy.isEdgeOpen(0));
+  ASSERT_EQ(copy.edgeType(1), dfl::inputs::Graph::EdgeType::LINE);
+  ASSERT_EQ(copy.degree(2), 2);
+  ASSERT_EQ(copy.degree(3), 1);
+  ASSERT_EQ(graph.nbNodes(), 3);
+}
+
+/**
+ * @brief Build a chain of voltage levels A - B - C - D and an isolated voltage level E, then renumber its nodes
+ *
+ * @param vls the voltage levels, in the order of insertion of their nodes
+ * @returns the ids of the nodes in the order of their new indexes
+ */
+static std::vector<std::string>
+renumberedIds(const std::vector<std::string>& vls) {
+  std::vector<std::shared_ptr<dfl::inputs::VoltageLevel>> levels;
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes;
+  dfl::inputs::Graph::Builder builder;
+  std::map<std::string, dfl::inputs::Graph::NodeIndex> indexes;
+  for (const auto& vl : vls) {
+    levels.push_back(std::make_shared<dfl::inputs::VoltageLevel>(vl));
+    // nodes of a voltage level added in decreasing id order
+    for (const auto& id : {vl + "2", vl + "1"}) {
+      nodes.push_back(dfl::inputs::Node::build(id, levels.back(), 0.0, {}));
+      indexes[id] = builder.addNode(nodes.back());
+    }
+  }
+  for (const auto& vl : vls) {
+    builder.addEdge(indexes[vl + "1"], indexes[vl + "2"], dfl::inputs::Graph::EdgeType::SWITCH);
+  }
+  builder.addEdge(indexes["C1"], indexes["D2"], dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(indexes["A2"], indexes["B1"], dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(indexes["B2"], indexes["C2"], dfl::inputs::Graph::EdgeType::TFO);
+  builder.addEdge(indexes["B1"], indexes["C1"], dfl::inputs::Graph::EdgeType::LINE);
+
+  auto newIndexes = builder.renumber();
+  auto graph = builder.build();
+  std::vector<std::string> ids;
+  for (dfl::inputs::Graph::NodeIndex index = 0; index < graph.nbNodes(); ++index) {
+    EXPECT_EQ(graph.node(index)->index, index);
+    ids.push_back(graph.node(index)->id.str());
+  }
+  for (const auto& node : indexes) {
+    EXPECT_EQ(graph.node(newIndexes[node.second])->id.str(), node.first);
+  }
+  // the edges keep their indexes with renumbered extremities
+  EXPECT_EQ(graph.node(graph.edgeNode1(vls.size()))->id.str(), "C1");
+  EXPECT_EQ(graph.node(graph.edgeNode2(vls.size()))->id.str(), "D2");
+  EXPECT_EQ(graph.degree(newIndexes[indexes["B1"]]), 3);
+  return ids;
+}
+
+TEST(TestGraph, renumber) {
+  // isolated voltage level first, then the chain from its end of lowest id
+  std::vector<std::string> expected{"E1", "E2", "A1", "A2", "B1", "B2", "C1", "C2", "D1", "D2"};
+  ASSERT_EQ(renumberedIds({"D", "B", "E", "A", "C"}), expected);
+  ASSERT_EQ(renumberedIds({"A", "B", "C", "D", "E"}), expected);
+  ASSERT_EQ(renumberedIds({"C", "E", "D", "A", "B"}), expected);
+}
@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "Islands.h"
+#include "Node.h"
+#include "Tests.h"
+
+#include <string>
+#include <vector>
+
+TEST(TestIslands, base) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < 7; ++i) {
+    builder.addNode(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+  }
+  builder.addEdge(0, 1, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(4, 5, dfl::inputs::Graph::EdgeType::SWITCH);
+  builder.addEdge(5, 6, dfl::inputs::Graph::EdgeType::TFO);
+  builder.addEdge(6, 4, dfl::inputs::Graph::EdgeType::LINE);
+  auto graph = builder.build();
+
+  auto islands = dfl::inputs::Islands::compute(graph);
+
+  ASSERT_EQ(islands.nbIslands(), 4);
+  std::vector<dfl::inputs::Islands::IslandId> expected_labels{0, 0, 1, 2, 3, 3, 3};
+  ASSERT_EQ(expected_labels, islands.labels());
+  std::vector<std::size_t> expected_sizes{2, 1, 1, 3};
+  ASSERT_EQ(expected_sizes, islands.sizes());
+  ASSERT_EQ(islands.mainIsland(), 3);
+  ASSERT_TRUE(islands.isInMainIsland(6));
+  ASSERT_FALSE(islands.isInMainIsland(0));
+}
+
+TEST(TestIslands, SameSize) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  // the island of node "A" is met first when walking by id, even if its nodes are added last
+  builder.addNode(dfl::inputs::Node::build("C", vl, 0.0, {}));
+  builder.addNode(dfl::inputs::Node::build("D", vl, 0.0, {}));
+  builder.addNode(dfl::inputs::Node::build("B", vl, 0.0, {}));
+  builder.addNode(dfl::inputs::Node::build("A", vl, 0.0, {}));
+  builder.addEdge(0, 1, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(2, 3, dfl::inputs::Graph::EdgeType::LINE);
+  auto graph = builder.build();
+
+  auto islands = dfl::inputs::Islands::compute(graph);
+
+  ASSERT_EQ(islands.nbIslands(), 2);
+  ASSERT_EQ(islands.mainIsland(), 1);
+  ASSERT_TRUE(islands.isInMainIsland(3));
+}
+
+TEST(TestIslands, LongChain) {
+  // radial chain long enough to overflow the stack of a recursive traversal
+  const unsigned int nbNodes = 200000;
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < nbNodes; ++i) {
+    builder.addNode(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+  }
+  for (unsigned int i = 1; i < nbNodes; ++i) {
+    builder.addEdge(i - 1, i, dfl::inputs::Graph::EdgeType::LINE);
+  }
+  auto graph = builder.build();
+
+  auto islands = dfl::inputs::Islands::compute(graph);
+
+  ASSERT_EQ(islands.nbIslands(), 1);
+  ASSERT_EQ(islands.size(0), nbNodes);
+  ASSERT_TRUE(islands.isInMainIsland(nbNodes - 1));
+}
+
+TEST(TestIslands, Parallel) {
+  const unsigned int nbNodes = 20000;
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < nbNodes; ++i) {
+    builder.addNode(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+  }
+  // pseudo-random sparse graph, with enough edges to get one large island and many small ones
+  std::uint32_t seed = 42;
+  for (unsigned int i = 0; i < nbNodes; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    auto node1 = seed % nbNodes;
+    seed = seed * 1664525u + 1013904223u;
+    auto node2 = seed % nbNodes;
+    builder.addEdge(node1, node2, dfl::inputs::Graph::EdgeType::LINE);
+  }
+  auto graph = builder.build();
+
+  auto islands = dfl::inputs::Islands::compute(graph);
+  for (unsigned int nbThreads = 2; nbThreads <= 8; nbThreads *= 2) {
+    auto islandsParallel = dfl::inputs::Islands::compute(graph, nbThreads);
+    ASSERT_EQ(islands.labels(), islandsParallel.labels());
+    ASSERT_EQ(islands.sizes(), islandsParallel.sizes());
+    ASSERT_EQ(islands.mainIsland(), islandsParallel.mainIsland());
+  }
+}
+
+TEST(TestIslands, update) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < 7; ++i) {
+    builder.addNode(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+  }
+  builder.addEdge(0, 1, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(1, 2, dfl::inputs::Graph::EdgeType::SWITCH);
+  builder.addEdge(2, 3, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(3, 0, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(3, 4, dfl::inputs::Graph::EdgeType::TFO);
+  builder.addEdge(5, 6, dfl::inputs::Graph::EdgeType::LINE);
+  builder.addEdge(4, 5, dfl::inputs::Graph::EdgeType::SWITCH, true);
+  auto graph = builder.build();
+
+  auto islands = dfl::inputs::Islands::compute(graph);
+  ASSERT_EQ(islands.nbIslands(), 2);
+  ASSERT_EQ(islands.size(islands.mainIsland()), 5);
+
+  // opening an edge of a loop does not split the island
+  graph.setEdgeOpen(1, true);
+  islands.update(graph, 1);
+  ASSERT_EQ(islands.nbIslands(), 2);
+  ASSERT_EQ(islands.size(islands.mainIsland()), 5);
+
+  // opening the transformer splits node 4 from the main island
+  graph.setEdgeOpen(4, true);
+  islands.update(graph, 4);
+  ASSERT_EQ(islands.nbIslands(), 3);
+  ASSERT_EQ(islands.size(islands.mainIsland()), 4);
+  ASSERT_FALSE(islands.isInMainIsland(4));
+  ASSERT_EQ(islands.size(islands.labels()[4]), 1);
+
+  // closing the switch merges node 4 with nodes 5 and 6
+  graph.setEdgeOpen(6, false);
+  islands.update(graph, 6);
+  ASSERT_EQ(islands.nbIslands(), 2);
+  ASSERT_EQ(islands.labels()[4], islands.labels()[6]);
+  ASSERT_EQ(islands.size(islands.labels()[4]), 3);
+
+  // closing the transformer merges everything
+  graph.setEdgeOpen(4, false);
+  islands.update(graph, 4);
+  ASSERT_EQ(islands.nbIslands(), 1);
+  ASSERT_EQ(islands.size(islands.mainIsland()), 7);
+}
+
+TEST(TestIslands, updateRandom) {
+  const unsigned int nbNodes = 2000;
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  dfl::inputs::Graph::Builder builder;
+  for (unsigned int i = 0; i < nbNodes; ++i) {
+    builder.addNode(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+  }
+  std::uint32_t seed = 42;
+  for (unsigned int i = 0; i < nbNodes; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    auto node1 = seed % nbNodes;
+    seed = seed * 1664525u + 1013904223u;
+    auto node2 = seed % nbNodes;
+    builder.addEdge(node1, node2, dfl::inputs::Graph::EdgeType::LINE);
+  }
+  auto graph = builder.build();
+  auto islands = dfl::inputs::Islands::compute(graph);
+
+  // the updated islands are the same partition, with the same main island, as the ones computed from scratch
+  for (unsigned int i = 0; i < 500; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    const auto edge = static_cast<dfl::inputs::Graph::EdgeIndex>(seed % graph.nbEdges());
+    graph.setEdgeOpen(edge, !graph.isEdgeOpen(edge));
+    islands.update(graph, edge);
+
+    auto expected = dfl::inputs::Islands::compute(graph);
+    ASSERT_EQ(expected.nbIslands(), islands.nbIslands());
+    std::vector<dfl::inputs::Islands::IslandId> expectedIslands(islands.sizes().size(), nbNodes);
+    for (dfl::inputs::Graph::NodeIndex index = 0; index < nbNodes; ++index) {
+      auto& expectedIsland = expectedIslands[islands.labels()[index]];
+      if (expectedIsland == nbNodes) {
+        expectedIsland = expected.labels()[index];
+      }
+      ASSERT_EQ(expectedIsland, expected.labels()[index]);
+      ASSERT_EQ(expected.size(expected.labels()[index]), islands.size(islands.labels()[index]));
+    }
+    ASSERT_EQ(expectedIslands[islands.mainIsland()], expected.mainIsland());
+  }
+}
@@ -0,0 +1,49 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "NetworkCache.h"
+#include "Tests.h"
+
+TEST(NetworkCache, base) {
+  using dfl::inputs::NetworkCache;
+  boost::filesystem::path cacheDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+  const auto filepath = NetworkCache::cacheFilepath(cacheDir, 42);
+
+  NetworkCache::Writer writer;
+  writer.writeString("BUS_1");
+  writer.write(63.5);
+  writer.writeSymbol(dfl::common::Symbol("BUS_2"));
+  writer.writeString("BUS_1");
+  writer.write(static_cast<std::uint8_t>(2));
+  writer.save(filepath, 42);
+
+  NetworkCache::Reader invalid(filepath, 43);
+  ASSERT_FALSE(invalid.isValid());
+
+  NetworkCache::Reader reader(filepath, 42);
+  ASSERT_TRUE(reader.isValid());
+  ASSERT_EQ("BUS_1", reader.readSymbol().str());
+  ASSERT_DOUBLE_EQ(63.5, reader.read<double>());
+  ASSERT_EQ(dfl::common::Symbol("BUS_2"), reader.readSymbol());
+  ASSERT_EQ("BUS_1", reader.readSymbol().str());
+  ASSERT_FALSE(reader.isAtEnd());
+  ASSERT_EQ(2, reader.read<std::uint8_t>());
+  ASSERT_TRUE(reader.isAtEnd());
+  ASSERT_THROW(reader.read<double>(), std::runtime_error);
+
+  boost::filesystem::remove_all(cacheDir);
+}
+
+TEST(NetworkCache, missingFile) {
+  using dfl::inputs::NetworkCache;
+  NetworkCache::Reader reader(NetworkCache::cacheFilepath("res", 42), 42);
+  ASSERT_FALSE(reader.isValid());
+  ASSERT_THROW(reader.readSymbol(), std::runtime_error);
+}
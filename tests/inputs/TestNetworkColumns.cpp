@@ -0,0 +1,68 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "NetworkColumns.h"
+#include "Tests.h"
+
+#include <DYNDataInterfaceFactory.h>
+#include <algorithm>
+
+static boost::shared_ptr<DYN::DataInterface>
+buildDataInterface(const std::string& filepath) {
+  return DYN::DataInterfaceFactory::build(DYN::DataInterfaceFactory::DATAINTERFACE_IIDM, filepath);
+}
+
+static std::size_t
+count(const std::vector<std::uint8_t>& flags) {
+  return std::count(flags.begin(), flags.end(), 1);
+}
+
+TEST(NetworkColumns, extract) {
+  using dfl::inputs::NetworkColumns;
+  auto dataInterface = buildDataInterface("res/IEEE14.iidm");
+  auto columns = NetworkColumns::extract(*dataInterface->getNetwork());
+
+  ASSERT_EQ(14, columns.nbVoltageLevels());
+  ASSERT_EQ(15, columns.buses.offsets.size());
+  ASSERT_EQ(14, columns.buses.offsets.back());
+  ASSERT_EQ(0, count(columns.voltageLevels.isNodeBreaker));
+  // 1 VL <=> 1 bus in this example
+  for (std::size_t vl = 0; vl < columns.nbVoltageLevels(); ++vl) {
+    ASSERT_EQ(vl, columns.buses.offsets[vl]);
+  }
+
+  ASSERT_EQ(11, columns.loads.offsets.back());
+  ASSERT_EQ(11, count(columns.loads.connected));
+  auto it = std::find(columns.loads.ids.begin(), columns.loads.ids.end(), dfl::common::Symbol("_LOAD___2_EC"));
+  ASSERT_NE(columns.loads.ids.end(), it);
+  auto load = static_cast<std::size_t>(std::distance(columns.loads.ids.begin(), it));
+  ASSERT_DOUBLE_EQ(21.7, columns.loads.activePowers[load]);
+  ASSERT_EQ("_BUS____2_TN", columns.buses.ids[columns.loads.buses[load]].str());
+  // 1 bus per VL: the bus index is the voltage level index
+  ASSERT_EQ("_BUS____2_VL", columns.voltageLevels.ids[columns.loads.buses[load]].str());
+
+  ASSERT_EQ(1, columns.shunts.offsets.back());
+  ASSERT_EQ(0, columns.switches.offsets.back());
+  ASSERT_EQ(5, columns.generators.offsets.back());
+  ASSERT_EQ(5, count(columns.generators.connected));
+  ASSERT_EQ(0, columns.svarcs.offsets.back());
+
+  ASSERT_EQ(17, columns.lines.ids.size());
+  ASSERT_EQ(17, count(columns.lines.connected));
+  ASSERT_EQ(3, columns.twoWTransformers.ids.size());
+  ASSERT_EQ(3, count(columns.twoWTransformers.connected));
+  ASSERT_TRUE(columns.twoWTransformers.seasons.empty());
+  ASSERT_EQ(0, columns.threeWTransformers.ids.size());
+  for (std::size_t i = 0; i < columns.lines.ids.size(); ++i) {
+    ASSERT_NE(NetworkColumns::noBus, columns.lines.buses1[i]);
+    ASSERT_NE(NetworkColumns::noBus, columns.lines.buses2[i]);
+    ASSERT_NE(columns.lines.buses1[i], columns.lines.buses2[i]);
+  }
+}
@@ -11,27 +11,31 @@
 #include "NetworkManager.h"
 #include "Tests.h"
 
+#include <algorithm>
+#include <stdexcept>
+
 static size_t count = 0;
 
 static void
 checkNode(const std::shared_ptr<dfl::inputs::Node>& node) {
   // Pattern = _BUS_+[0-9]+_TN
-  ASSERT_EQ(0, node->id.compare(0, 5, "_BUS_"));
+  const auto& id = node->id.str();
+  ASSERT_EQ(0, id.compare(0, 5, "_BUS_"));
 
-  size_t index = node->id.find_first_not_of('_', 5);
+  size_t index = id.find_first_not_of('_', 5);
   ASSERT_NE(index, std::string::npos);
-  size_t index2 = node->id.find_first_of('_', index + 1);
-  ASSERT_TRUE(index2 == node->id.length() - 3);
+  size_t index2 = id.find_first_of('_', index + 1);
+  ASSERT_TRUE(index2 == id.length() - 3);
   for (size_t i = index + 1; i < index2; i++) {
-    ASSERT_TRUE(std::isdigit(node->id.at(i)));
+    ASSERT_TRUE(std::isdigit(id.at(i)));
   }
 
-  ASSERT_EQ(0, node->id.compare(node->id.length() - 3, 3, "_TN"));
+  ASSERT_EQ(0, id.compare(id.length() - 3, 3, "_TN"));
   ++count;
 
   // 1 VL <=> 1 node in this example
-  ASSERT_FALSE(node->voltageLevel.expired());
-  auto vl = node->voltageLevel.lock();
+  ASSERT_NE(nullptr, node->voltageLevel);
+  const auto& vl = node->voltageLevel;
   ASSERT_EQ(1, vl->nodes.size());
   ASSERT_EQ(node->id, vl->nodes.front()->id);
 }
@@ -41,10 +45,18 @@ TEST(NetworkManager, walk) {
 
   NetworkManager manager("res/IEEE14.iidm");
 
-  manager.onNode(&checkNode);
+  count = 0;
+  manager.walkNodes(&checkNode);
+  ASSERT_EQ(14, count);
+}
+
+TEST(NetworkManager, walkCompressed) {
+  using dfl::inputs::NetworkManager;
+
+  NetworkManager manager("res/IEEE14.iidm.gz");
 
   count = 0;
-  manager.walkNodes();
+  manager.walkNodes(&checkNode);
   ASSERT_EQ(14, count);
 }
 
@@ -55,12 +67,13 @@ hvdcLineEqual(const dfl::inputs::HvdcLine& lhs, const dfl::inputs::HvdcLine& rhs
 
 TEST(NetworkManager, hvdcLines) {
   using dfl::inputs::NetworkManager;
-  auto dummyStation = std::make_shared<dfl::inputs::LCCConverter>("StationN", "_BUS___99_TN", nullptr, 99.);
-  auto dummyStationVSC = std::make_shared<dfl::inputs::VSCConverter>("StationN", "_BUS___99_TN", nullptr, false, 0., 0.,
-                                                                     std::vector<dfl::inputs::VSCConverter::ReactiveCurvePoint>{});
+  auto dummyStation = std::make_shared<dfl::inputs::Converter>("StationN", "_BUS___99_TN", nullptr, dfl::inputs::LCCConverter(99.));
+  auto dummyStationVSC =
+      std::make_shared<dfl::inputs::Converter>("StationN", "_BUS___99_TN", nullptr,
+                                               dfl::inputs::VSCConverter(false, 0., 0., dfl::inputs::ReactiveCurveStore::emptyCurve));
   std::vector<std::shared_ptr<dfl::inputs::HvdcLine>> expected_hvdcLines = {
-      dfl::inputs::HvdcLine::build("HVDCLCCLine", dfl::inputs::HvdcLine::ConverterType::LCC, dummyStation, dummyStation, boost::none, 2000),
-      dfl::inputs::HvdcLine::build("HVDCVSCLine", dfl::inputs::HvdcLine::ConverterType::VSC, dummyStationVSC, dummyStationVSC, boost::none, 2000)};
+      dfl::inputs::HvdcLine::build("HVDCLCCLine", dfl::inputs::HvdcLine::ConverterType::LCC, dummyStation.get(), dummyStation.get(), boost::none, 2000),
+      dfl::inputs::HvdcLine::build("HVDCVSCLine", dfl::inputs::HvdcLine::ConverterType::VSC, dummyStationVSC.get(), dummyStationVSC.get(), boost::none, 2000)};
 
   NetworkManager manager("res/HvdcDangling.iidm");
   const auto& hvdcLines = manager.getHvdcLine();
@@ -88,7 +101,231 @@ TEST(NetworkManager, shunts) {
   NetworkManager manager("res/IEEE14.iidm");
 
   unsigned int nbShunts = 0;
-  manager.onNode([&nbShunts](const std::shared_ptr<dfl::inputs::Node>& node) { nbShunts += node->shunts.size(); });
-  manager.walkNodes();
+  manager.walkNodes([&nbShunts](const std::shared_ptr<dfl::inputs::Node>& node) { nbShunts += node->shunts.size(); });
   ASSERT_EQ(nbShunts, 1);
 }
+
+TEST(NetworkManager, topologyUpdate) {
+  using dfl::inputs::NetworkManager;
+  NetworkManager manager("res/IEEE14.iidm");
+  ASSERT_EQ(manager.getIslands().nbIslands(), 1);
+
+  // bus 8 is only connected through the line from bus 7
+  ASSERT_TRUE(manager.disconnectBranch("_BUS____7-BUS____8-1_AC"));
+  ASSERT_FALSE(manager.disconnectBranch("_BUS____7-BUS____8-1_AC"));
+  ASSERT_EQ(manager.getIslands().nbIslands(), 2);
+  ASSERT_EQ(manager.getIslands().size(manager.getIslands().mainIsland()), 13);
+  ASSERT_TRUE(manager.disconnectBranch("_BUS____4-BUS____9-1_PT"));
+  ASSERT_EQ(manager.getIslands().nbIslands(), 2);
+
+  ASSERT_TRUE(manager.disconnectInjection("_LOAD___2_EC"));
+  ASSERT_FALSE(manager.disconnectInjection("_LOAD___2_EC"));
+
+  std::size_t nbLines = 0;
+  std::size_t nbLoads = 0;
+  manager.walkNodes([&nbLines, &nbLoads](const std::shared_ptr<dfl::inputs::Node>& node) {
+    nbLines += node->lines.size();
+    nbLoads += node->loads.size();
+    if (node->id.str() == "_BUS____8_TN") {
+      ASSERT_TRUE(node->lines.empty());
+    }
+  });
+  ASSERT_EQ(nbLines, 2 * 16);
+  ASSERT_EQ(nbLoads, 10);
+
+  ASSERT_THROW(manager.disconnectBranch("unknown"), std::out_of_range);
+  ASSERT_THROW(manager.disconnectInjection("unknown"), std::out_of_range);
+  ASSERT_THROW(manager.openSwitch("_BUS____7-BUS____9-1_AC"), std::out_of_range);
+}
+
+TEST(NetworkManager, walkOrder) {
+  using dfl::inputs::NetworkManager;
+  NetworkManager manager("res/IEEE14.iidm");
+
+  // the nodes are walked in the locality-aware order of their storage, or in the order of their ids
+  std::vector<dfl::inputs::Graph::NodeIndex> indexes;
+  manager.walkNodes([&indexes](const std::shared_ptr<dfl::inputs::Node>& node) { indexes.push_back(node->index); });
+  ASSERT_EQ(indexes.size(), 14);
+  for (std::size_t index = 0; index < indexes.size(); ++index) {
+    ASSERT_EQ(indexes[index], index);
+  }
+
+  std::vector<dfl::common::Symbol> ids;
+  manager.walkNodesById([&ids](const std::shared_ptr<dfl::inputs::Node>& node) { ids.push_back(node->id); });
+  ASSERT_EQ(ids.size(), 14);
+  ASSERT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+}
+
+TEST(NetworkManager, pendingEquipment) {
+  using dfl::inputs::NetworkManager;
+  // bus 8 and its generator are isolated, the line from bus 7 being disconnected
+  NetworkManager manager("res/IEEE14Islanded.iidm");
+  ASSERT_EQ(manager.getIslands().nbIslands(), 2);
+  ASSERT_EQ(manager.getGenerators().size(), 4);
+  ASSERT_EQ(manager.nbPendingEquipment(), 1);
+
+  manager.extractAllEquipment();
+  ASSERT_EQ(manager.getGenerators().size(), 5);
+  ASSERT_EQ(manager.nbPendingEquipment(), 0);
+  manager.extractAllEquipment();
+  ASSERT_EQ(manager.getGenerators().size(), 5);
+
+  NetworkManager other("res/IEEE14Islanded.iidm");
+  ASSERT_TRUE(other.disconnectInjection("_GEN____8_SM"));
+  ASSERT_FALSE(other.disconnectInjection("_GEN____8_SM"));
+  ASSERT_EQ(other.nbPendingEquipment(), 0);
+  other.extractAllEquipment();
+  ASSERT_EQ(other.getGenerators().size(), 4);
+}
+
+TEST(NetworkManager, disconnectUnmodelledGenerator) {
+  using dfl::inputs::NetworkManager;
+  // the generator of VL2 is connected, but without voltage regulation: it is not part of the node tree
+  NetworkManager manager("res/PrescanNoRegulating.iidm");
+  manager.extractAllEquipment();
+  const auto& generators = manager.getGenerators().ids();
+  ASSERT_EQ(std::find(generators.begin(), generators.end(), dfl::common::Symbol("GEN_VL2")), generators.end());
+
+  ASSERT_TRUE(manager.disconnectInjection("GEN_VL2"));
+  ASSERT_FALSE(manager.disconnectInjection("GEN_VL2"));
+  ASSERT_THROW(manager.disconnectInjection("GEN_UNKNOWN"), std::out_of_range);
+}
+
+TEST(NetworkManager, nodeBreaker) {
+  using dfl::inputs::NetworkManager;
+  NetworkManager manager("res/PrescanNodeBreaker.iidm");
+
+  // the closed switches, retained or not, are merged: the generator is on the node of the busbar sections
+  ASSERT_THROW(manager.openSwitch("SW_GEN"), std::out_of_range);
+  ASSERT_THROW(manager.openSwitch("COUPLER"), std::out_of_range);
+  ASSERT_EQ(manager.getGenerators().size(), 1);
+  const auto& nodes = manager.getGraph().nodes();
+  // busbar sections, generator and transformer on one node, the line behind the open switch on another
+  ASSERT_EQ(std::count_if(nodes.begin(), nodes.end(), [](const std::shared_ptr<dfl::inputs::Node>& node) { return node->voltageLevel->id == "VL1"; }),
+            2);
+
+  // the open switch is kept, so that it can be closed
+  const auto nbIslands = manager.getIslands().nbIslands();
+  ASSERT_TRUE(manager.closeSwitch("SW_LINE"));
+  ASSERT_FALSE(manager.closeSwitch("SW_LINE"));
+  ASSERT_EQ(manager.getIslands().nbIslands(), nbIslands - 1);
+}
+
+TEST(NetworkManager, detachedParts) {
+  using dfl::inputs::NetworkManager;
+  NetworkManager manager("res/IEEE14.iidm");
+
+  // bus 8 is only connected through the line from bus 7
+  auto parts = manager.computeDetachedParts();
+  ASSERT_EQ(parts.size(), 1);
+  ASSERT_EQ(parts[0].branchId.str(), "_BUS____7-BUS____8-1_AC");
+  ASSERT_EQ(parts[0].branchType, dfl::inputs::Graph::EdgeType::LINE);
+  ASSERT_EQ(parts[0].nbNodes, 1);
+  ASSERT_DOUBLE_EQ(parts[0].load, 0.);
+
+  // once the loop through bus 9 is open, the transformer from bus 4 to bus 7 detaches buses 7 and 8
+  manager.disconnectBranch("_BUS____7-BUS____9-1_AC");
+  parts = manager.computeDetachedParts();
+  ASSERT_EQ(parts.size(), 2);
+  ASSERT_EQ(parts[0].branchId.str(), "_BUS____4-BUS____7-1_PT");
+  ASSERT_EQ(parts[0].nbNodes, 2);
+}
+
+TEST(NetworkManager, detachedPartsThreeWindings) {
+  using dfl::inputs::NetworkManager;
+  NetworkManager manager("res/ThreeWindings.iidm");
+
+  // the 225 kV and 63 kV sides are only connected through the three windings transformer: its outage splits the main island in three parts,
+  // the 400 kV side remaining the main island as the largest one
+  auto parts = manager.computeDetachedParts();
+  ASSERT_EQ(parts.size(), 2);
+  ASSERT_EQ(parts[0].branchId.str(), "LINE");
+  ASSERT_EQ(parts[0].nbNodes, 1);
+  ASSERT_DOUBLE_EQ(parts[0].load, 5.);
+  ASSERT_EQ(parts[1].branchId.str(), "TFO3");
+  ASSERT_EQ(parts[1].branchType, dfl::inputs::Graph::EdgeType::TFO);
+  ASSERT_EQ(parts[1].nbNodes, 2);
+  ASSERT_DOUBLE_EQ(parts[1].generation, 0.);
+  ASSERT_DOUBLE_EQ(parts[1].load, 30.);
+
+  // once the line is disconnected, the three parts have one node each: the one with the lowest id remains the main island
+  manager.disconnectBranch("LINE");
+  parts = manager.computeDetachedParts();
+  ASSERT_EQ(parts.size(), 1);
+  ASSERT_EQ(parts[0].branchId.str(), "TFO3");
+  ASSERT_EQ(parts[0].nbNodes, 2);
+  ASSERT_DOUBLE_EQ(parts[0].generation, 40.);
+  ASSERT_DOUBLE_EQ(parts[0].load, 10.);
+}
+
+TEST(NetworkManager, cache) {
+  using dfl::inputs::NetworkManager;
+  boost::filesystem::path cacheDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+
+  NetworkManager parsed("res/HvdcDangling.iidm", 1, cacheDir);
+  ASSERT_FALSE(parsed.isLoadedFromCache());
+  NetworkManager cached("res/HvdcDangling.iidm", 1, cacheDir);
+  ASSERT_TRUE(cached.isLoadedFromCache());
+
+  std::vector<std::string> parsedIds;
+  parsed.walkNodes([&parsedIds](const std::shared_ptr<dfl::inputs::Node>& node) { parsedIds.push_back(node->id.str()); });
+  std::vector<std::string> cachedIds;
+  cached.walkNodes([&cachedIds](const std::shared_ptr<dfl::inputs::Node>& node) { cachedIds.push_back(node->id.str()); });
+  ASSERT_EQ(parsedIds, cachedIds);
+
+  ASSERT_EQ(parsed.getHvdcLine().size(), cached.getHvdcLine().size());
+  for (std::size_t index = 0; index < parsed.getHvdcLine().size(); ++index) {
+    ASSERT_TRUE(hvdcLineEqual(*parsed.getHvdcLine()[index], *cached.getHvdcLine()[index]));
+  }
+  ASSERT_EQ(parsed.getIslands().nbIslands(), cached.getIslands().nbIslands());
+  ASSERT_EQ(parsed.getGraph().nbEdges(), cached.getGraph().nbEdges());
+
+  boost::filesystem::remove_all(cacheDir);
+}
+
+TEST(NetworkManager, cacheRegulatedBuses) {
+  using dfl::inputs::NetworkManager;
+  boost::filesystem::path cacheDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+
+  // the generator of bus 8 is outside the main island: its regulated bus is counted only once it is extracted
+  NetworkManager manager("res/IEEE14Islanded.iidm");
+  NetworkManager parsed("res/IEEE14Islanded.iidm", 1, cacheDir);
+  ASSERT_FALSE(parsed.isLoadedFromCache());
+  NetworkManager cached("res/IEEE14Islanded.iidm", 1, cacheDir);
+  ASSERT_TRUE(cached.isLoadedFromCache());
+  ASSERT_EQ(manager.getMapBusGeneratorsBusId(), parsed.getMapBusGeneratorsBusId());
+  ASSERT_EQ(manager.getMapBusGeneratorsBusId(), cached.getMapBusGeneratorsBusId());
+  ASSERT_EQ(manager.getMapBusVSCConvertersBusId(), cached.getMapBusVSCConvertersBusId());
+
+  manager.extractAllEquipment();
+  cached.extractAllEquipment();
+  ASSERT_EQ(manager.getMapBusGeneratorsBusId(), cached.getMapBusGeneratorsBusId());
+
+  boost::filesystem::remove_all(cacheDir);
+}
+
+TEST(NetworkManager, cacheNodeBreaker) {
+  using dfl::inputs::NetworkManager;
+  boost::filesystem::path cacheDir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+
+  NetworkManager parsed("res/PrescanNodeBreaker.iidm", 1, cacheDir);
+  ASSERT_FALSE(parsed.isLoadedFromCache());
+  NetworkManager cached("res/PrescanNodeBreaker.iidm", 1, cacheDir);
+  ASSERT_TRUE(cached.isLoadedFromCache());
+
+  // the buses merged into another node are resolved the same way from the cache
+  ASSERT_EQ(parsed.getNodeAliases().size(), cached.getNodeAliases().size());
+  auto parsedServiceManager = parsed.serviceManager();
+  auto cachedServiceManager = cached.serviceManager();
+  for (std::size_t index = 0; index < parsed.getNodeAliases().size(); ++index) {
+    const auto& parsedAlias = parsed.getNodeAliases()[index];
+    const auto& cachedAlias = cached.getNodeAliases()[index];
+    ASSERT_EQ(parsedAlias.first, cachedAlias.first);
+    ASSERT_EQ(parsed.getGraph().node(parsedAlias.second)->id, cached.getGraph().node(cachedAlias.second)->id);
+    const auto& vlId = parsed.getGraph().node(parsedAlias.second)->voltageLevel->id.str();
+    ASSERT_EQ(parsedServiceManager->getBusesConnectedBySwitch(parsedAlias.first.str(), vlId),
+              cachedServiceManager->getBusesConnectedBySwitch(cachedAlias.first.str(), vlId));
+  }
+
+  boost::filesystem::remove_all(cacheDir);
+}
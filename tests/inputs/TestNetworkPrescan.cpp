@@ -0,0 +1,70 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "NetworkPrescan.h"
+#include "Tests.h"
+
+#include <algorithm>
+
+TEST(NetworkPrescan, base) {
+  using dfl::inputs::NetworkPrescan;
+
+  NetworkPrescan prescan("res/IEEE14.iidm");
+  const auto& graph = prescan.getGraph();
+  ASSERT_EQ(14, graph.nbNodes());
+  ASSERT_EQ(1, prescan.getIslands().nbIslands());
+  ASSERT_TRUE(prescan.hasRegulatingGeneratorInMainIsland());
+  for (const auto& node : graph.nodes()) {
+    ASSERT_EQ(0, node->id.str().compare(0, 5, "_BUS_"));
+  }
+
+  NetworkPrescan compressed("res/IEEE14.iidm.gz");
+  ASSERT_EQ(graph.nbNodes(), compressed.getGraph().nbNodes());
+  ASSERT_EQ(graph.nbEdges(), compressed.getGraph().nbEdges());
+}
+
+TEST(NetworkPrescan, topology) {
+  using dfl::inputs::NetworkPrescan;
+
+  NetworkPrescan prescan("res/PrescanNodeBreaker.iidm", 2);
+  const auto& graph = prescan.getGraph();
+  std::vector<std::string> ids;
+  for (const auto& node : graph.nodes()) {
+    ids.push_back(node->id.str());
+  }
+  ASSERT_EQ((std::vector<std::string>{"VL1_0", "VL1_3", "VL2_BUS1", "VL2_BUS2", "VL3_BUS1", "VL3_BUS2", "VL3_BUS3", "VL3_BUS4"}), ids);
+  ASSERT_EQ(3, graph.nbEdges());
+
+  const auto& islands = prescan.getIslands();
+  ASSERT_EQ(5, islands.nbIslands());
+  ASSERT_TRUE(islands.isInMainIsland(0));
+  ASSERT_TRUE(islands.isInMainIsland(2));
+  ASSERT_TRUE(islands.isInMainIsland(3));
+  ASSERT_FALSE(islands.isInMainIsland(1));
+  ASSERT_EQ(islands.islandOf(5), islands.islandOf(6));
+
+  ASSERT_TRUE(prescan.hasRegulatingGenerator(0));
+  ASSERT_EQ(1, std::count_if(graph.nodes().begin(), graph.nodes().end(), [&prescan](const std::shared_ptr<dfl::inputs::Node>& node) {
+              return prescan.hasRegulatingGenerator(node->index);
+            }));
+  ASSERT_TRUE(prescan.hasRegulatingGeneratorInMainIsland());
+  ASSERT_TRUE(prescan.hasAnyRegulatingGenerator());
+
+  NetworkPrescan noRegulating("res/PrescanNoRegulating.iidm");
+  ASSERT_FALSE(noRegulating.hasRegulatingGeneratorInMainIsland());
+  ASSERT_FALSE(noRegulating.hasAnyRegulatingGenerator());
+}
+
+TEST(NetworkPrescan, errors) {
+  using dfl::inputs::NetworkPrescan;
+
+  ASSERT_THROW(NetworkPrescan("res/Truncated.iidm.gz"), std::runtime_error);
+  ASSERT_THROW(NetworkPrescan("res/config.json"), std::runtime_error);
+}
@@ -42,9 +42,9 @@ TEST(TestNode, line) {
   ASSERT_EQ(node0->shunts.size(), 0);
   ASSERT_EQ(node1->shunts.size(), 1);
   ASSERT_EQ(node2->shunts.size(), 2);
-  ASSERT_EQ(node0->neighbours.size(), 1);
-  ASSERT_EQ(node1->neighbours.size(), 2);
-  ASSERT_EQ(node2->neighbours.size(), 1);
+  ASSERT_EQ(node0->lines.size(), 1);
+  ASSERT_EQ(node1->lines.size(), 2);
+  ASSERT_EQ(node2->lines.size(), 1);
 }
 
 TEST(TestNode, Tfo) {
@@ -59,9 +59,10 @@ TEST(TestNode, Tfo) {
   auto node02 = dfl::inputs::Node::build("2", vl, 4.5, {});
 
   auto tfo = dfl::inputs::Tfo::build("TFO", node0, node1);
-  ASSERT_EQ(node0->neighbours.size(), 1);
+  ASSERT_EQ(node0->tfos.size(), 1);
+  ASSERT_EQ(node1->tfos.size(), 1);
   auto tfo2 = dfl::inputs::Tfo::build("TFO", node00, node01, node02);
-  ASSERT_EQ(node00->neighbours.size(), 2);
-  ASSERT_EQ(node01->neighbours.size(), 2);
-  ASSERT_EQ(node02->neighbours.size(), 2);
+  ASSERT_EQ(node00->tfos.size(), 1);
+  ASSERT_EQ(node01->tfos.size(), 1);
+  ASSERT_EQ(node02->tfos.size(), 1);
 }
@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "ReactiveCurveStore.h"
+#include "Tests.h"
+
+#include <vector>
+
+TEST(TestReactiveCurveStore, base) {
+  using dfl::inputs::ReactiveCurveStore;
+  using ReactiveCurvePoint = ReactiveCurveStore::ReactiveCurvePoint;
+  ReactiveCurveStore curves;
+
+  ASSERT_EQ(curves.size(), 1);
+  ASSERT_TRUE(curves.points(ReactiveCurveStore::emptyCurve).empty());
+  ASSERT_EQ(curves.add(std::vector<ReactiveCurvePoint>{}), ReactiveCurveStore::emptyCurve);
+
+  auto curve0 = curves.add({ReactiveCurvePoint(3., 33., 330.), ReactiveCurvePoint(1., 11., 110.), ReactiveCurvePoint(2., 22., 220.)});
+  auto curve1 = curves.add({ReactiveCurvePoint(5., 55., 550.)});
+  ASSERT_NE(curve0, ReactiveCurveStore::emptyCurve);
+  ASSERT_NE(curve0, curve1);
+  ASSERT_EQ(curves.size(), 3);
+
+  // points are sorted by active power
+  auto points0 = curves.points(curve0);
+  ASSERT_EQ(points0.size(), 3);
+  ASSERT_EQ(points0[0].p, 1.);
+  ASSERT_EQ(points0[1].p, 2.);
+  ASSERT_EQ(points0[2].p, 3.);
+  ASSERT_EQ(points0.front().qmax, 110.);
+
+  // identical curves are stored once, whatever the order of the points
+  ASSERT_EQ(curves.add({ReactiveCurvePoint(2., 22., 220.), ReactiveCurvePoint(3., 33., 330.), ReactiveCurvePoint(1., 11., 110.)}), curve0);
+  ASSERT_EQ(curves.add({ReactiveCurvePoint(5., 55., 550.)}), curve1);
+  ASSERT_EQ(curves.size(), 3);
+
+  // a single different value makes a different curve
+  auto curve2 = curves.add({ReactiveCurvePoint(1., 11., 110.), ReactiveCurvePoint(2., 22., 220.), ReactiveCurvePoint(3., 33., 331.)});
+  ASSERT_NE(curve2, curve0);
+  ASSERT_EQ(curves.size(), 4);
+  ASSERT_EQ(curves.points(curve2)[2].qmax, 331.);
+
+  curves.clear();
+  ASSERT_EQ(curves.size(), 1);
+  ASSERT_TRUE(curves.points(ReactiveCurveStore::emptyCurve).empty());
+  auto curve = curves.add({ReactiveCurvePoint(5., 55., 550.)});
+  ASSERT_EQ(curve, 1);
+  ASSERT_EQ(curves.points(curve).size(), 1);
+}
@@ -10,30 +10,34 @@
 
 #include "Constants.h"
 #include "Diagram.h"
+#include "TestGenerators.h"
 #include "Tests.h"
 
+#include <algorithm>
 #include <boost/filesystem.hpp>
 
-static void
-testMultiplesFilesEquality(const std::vector<dfl::algo::GeneratorDefinition>& generators, const boost::filesystem::path& outputDirectory,
-                           const std::string& basename, const std::string& prefixDir) {
-  using dfl::algo::GeneratorDefinition;
+using ReactiveCurvePoint = dfl::inputs::GeneratorTable::ReactiveCurvePoint;
+using dfl::test::addGenerator;
 
+static void
+testMultiplesFilesEquality(const dfl::algo::GeneratorDefinitions& generators, const boost::filesystem::path& outputDirectory, const std::string& basename,
+                           const std::string& prefixDir) {
   boost::filesystem::path reference("reference");
   reference.append(basename);
   reference.append(prefixDir + dfl::outputs::constants::diagramDirectorySuffix);
-  for (const GeneratorDefinition& gen : generators) {
-    if (!gen.isUsingDiagram())
+  for (std::size_t i = 0; i < generators.size(); ++i) {
+    if (!dfl::algo::GeneratorDefinitions::isUsingDiagram(generators.models[i]))
       continue;
+    const auto& id = generators.table.ids()[generators.rows[i]];
     boost::filesystem::path ref(reference);
     boost::filesystem::path outputDir(outputDirectory);
-    dfl::test::checkFilesEqual(outputDir.append(dfl::outputs::constants::diagramFilename(gen.id)).generic_string(),
-                               ref.append(dfl::outputs::constants::diagramFilename(gen.id)).generic_string());
+    dfl::test::checkFilesEqual(outputDir.append(dfl::outputs::constants::diagramFilename(id.str())).generic_string(),
+                               ref.append(dfl::outputs::constants::diagramFilename(id.str())).generic_string());
   }
 }
 
 TEST(Diagram, writeWithCurvePoint) {
-  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::GeneratorDefinitions;
 
   std::string basename = "TestDiagram";
   std::string prefixDir = "WithCurvePoint";
@@ -45,34 +49,29 @@ TEST(Diagram, writeWithCurvePoint) {
   }
   outputDirectory.append(prefixDir + dfl::outputs::constants::diagramDirectorySuffix);
   const std::string bus1 = "BUS_1";
-  std::vector<GeneratorDefinition> generators = {GeneratorDefinition("G0", GeneratorDefinition::ModelType::SIGNALN, "00",
-                                                                     {
-                                                                         GeneratorDefinition::ReactiveCurvePoint(1., 11., 110.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(2., 22., 220.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(3., 33., 330.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(4., 44., 440.),
-                                                                     },
-                                                                     1., 10., 11., 110., 100, bus1),
-                                                 GeneratorDefinition("G2", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "02",
-                                                                     {
-                                                                         GeneratorDefinition::ReactiveCurvePoint(1., 11., 110.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(2., 22., 220.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(3., 33., 330.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(4., 44., 440.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(2.7, 22., 220.),
-                                                                     },
-                                                                     3., 30., 33., 330., 100, bus1)};
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  addGenerator(curves, table, generators, "G0", GeneratorDefinitions::ModelType::SIGNALN, "00",
+               {ReactiveCurvePoint(1., 11., 110.), ReactiveCurvePoint(2., 22., 220.),
+                ReactiveCurvePoint(3., 33., 330.), ReactiveCurvePoint(4., 44., 440.)},
+               1., 10., 11., 110., 100, bus1);
+  addGenerator(curves, table, generators, "G2", GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN, "02",
+               {ReactiveCurvePoint(1., 11., 110.), ReactiveCurvePoint(2., 22., 220.),
+                ReactiveCurvePoint(3., 33., 330.), ReactiveCurvePoint(4., 44., 440.),
+                ReactiveCurvePoint(2.7, 22., 220.)},
+               3., 30., 33., 330., 100, bus1);
 
   dfl::algo::HVDCLineDefinitions defs;
 
-  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs));
+  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs, curves));
 
   DiagramWriter.write();
   testMultiplesFilesEquality(generators, outputDirectory, basename, prefixDir);
 }
 
 TEST(Diagram, writeWithCurveAndDefaultPoints) {
-  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::GeneratorDefinitions;
 
   std::string basename = "TestDiagram";
   std::string prefixDir = "Mixed";
@@ -85,39 +84,31 @@ TEST(Diagram, writeWithCurveAndDefaultPoints) {
   outputDirectory.append(prefixDir + dfl::outputs::constants::diagramDirectorySuffix);
   const std::string bus1 = "BUS_1";
 
-  std::vector<GeneratorDefinition> generators = {GeneratorDefinition("G0", GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "00",
-                                                                     {
-                                                                         GeneratorDefinition::ReactiveCurvePoint(1., 11., 110.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(3., 33., 330.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(4., 44., 440.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(2., 22., 220.),
-                                                                     },
-                                                                     1., 10., -11., 110., 100, bus1),
-                                                 GeneratorDefinition("G2", GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "02",
-                                                                     {
-                                                                         GeneratorDefinition::ReactiveCurvePoint(8., 44., 440.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(7., 44., 440.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(10., 987., 2394.43),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(6., 44., 31.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(5., 42., 49.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(59.8, 484., 440.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(1., 11., 110.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(2., 22., 220.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(3., 33., 330.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(4., 44., 440.),
-                                                                         GeneratorDefinition::ReactiveCurvePoint(2.7, 22., 220.),
-                                                                     },
-                                                                     3., 30., 33., 330., 100, bus1)};
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  addGenerator(curves, table, generators, "G0", GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "00",
+               {ReactiveCurvePoint(1., 11., 110.), ReactiveCurvePoint(3., 33., 330.),
+                ReactiveCurvePoint(4., 44., 440.), ReactiveCurvePoint(2., 22., 220.)},
+               1., 10., -11., 110., 100, bus1);
+  addGenerator(curves, table, generators, "G2", GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "02",
+               {ReactiveCurvePoint(8., 44., 440.), ReactiveCurvePoint(7., 44., 440.),
+                ReactiveCurvePoint(10., 987., 2394.43), ReactiveCurvePoint(6., 44., 31.),
+                ReactiveCurvePoint(5., 42., 49.), ReactiveCurvePoint(59.8, 484., 440.),
+                ReactiveCurvePoint(1., 11., 110.), ReactiveCurvePoint(2., 22., 220.),
+                ReactiveCurvePoint(3., 33., 330.), ReactiveCurvePoint(4., 44., 440.),
+                ReactiveCurvePoint(2.7, 22., 220.)},
+               3., 30., 33., 330., 100, bus1);
 
   dfl::algo::HVDCLineDefinitions defs;
-  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs));
+  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs, curves));
 
   DiagramWriter.write();
   testMultiplesFilesEquality(generators, outputDirectory, basename, prefixDir);
 }
 
 TEST(Diagram, writeEmpty) {
-  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::GeneratorDefinitions;
 
   std::string basename = "TestDiagram";
   std::string prefixDir = "Empty";
@@ -130,13 +121,15 @@ TEST(Diagram, writeEmpty) {
   outputDirectory.append(prefixDir + dfl::outputs::constants::diagramDirectorySuffix);
   const std::string bus1 = "BUS_1";
 
-  std::vector<GeneratorDefinition> generators = {
-      GeneratorDefinition("G1", GeneratorDefinition::ModelType::SIGNALN, "01", {}, -20., -2., 22., 220., 100, bus1),
-      GeneratorDefinition("G6", GeneratorDefinition::ModelType::REMOTE_SIGNALN, "63", {}, 4., 40., 44., 440., 100, bus1),
-      GeneratorDefinition("G4", GeneratorDefinition::ModelType::PROP_SIGNALN, "04", {}, -20., -2., 22., 220., 100, bus1)};
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  addGenerator(curves, table, generators, "G1", GeneratorDefinitions::ModelType::SIGNALN, "01", {}, -20., -2., 22., 220., 100, bus1);
+  addGenerator(curves, table, generators, "G6", GeneratorDefinitions::ModelType::REMOTE_SIGNALN, "63", {}, 4., 40., 44., 440., 100, bus1);
+  addGenerator(curves, table, generators, "G4", GeneratorDefinitions::ModelType::PROP_SIGNALN, "04", {}, -20., -2., 22., 220., 100, bus1);
 
   dfl::algo::HVDCLineDefinitions defs;
-  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs));
+  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs, curves));
 
   DiagramWriter.write();
   std::string directoryPath = outputDirectory.generic_string();
@@ -161,6 +154,7 @@ TEST(Diagram, writeVSC) {
   }
   outputDirectory.append(prefixDir + dfl::outputs::constants::diagramDirectorySuffix);
 
+  dfl::inputs::ReactiveCurveStore curves;
   dfl::algo::HVDCLineDefinitions::HvdcLineMap map{
       std::make_pair(
           "0", HVDCDefinition("HVDCVSCLine", dfl::inputs::HvdcLine::ConverterType::VSC, "VSCStation1", "_BUS___11_TN", false, "VSCStation99", "_BUS___99_TN",
@@ -170,12 +164,12 @@ TEST(Diagram, writeVSC) {
                                          "_BUS___12_TN", false, HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT,
                                          HVDCDefinition::HVDCModel::HvdcPQPropDiagramPQEmulation, {}, 0., boost::none,
                                          dfl::algo::VSCDefinition("VSCStation2", 52, -52, 22,
-                                                                  {
-                                                                      dfl::algo::VSCDefinition::ReactiveCurvePoint(1., 11., 110.),
-                                                                      dfl::algo::VSCDefinition::ReactiveCurvePoint(3., 33., 330.),
-                                                                      dfl::algo::VSCDefinition::ReactiveCurvePoint(4., 44., 440.),
-                                                                      dfl::algo::VSCDefinition::ReactiveCurvePoint(2., 22., 220.),
-                                                                  }),
+                                                                  curves.add(std::vector<ReactiveCurvePoint>{
+                                                                      ReactiveCurvePoint(1., 11., 110.),
+                                                                      ReactiveCurvePoint(3., 33., 330.),
+                                                                      ReactiveCurvePoint(4., 44., 440.),
+                                                                      ReactiveCurvePoint(2., 22., 220.),
+                                                                  })),
                                          boost::none)),
       std::make_pair(
           "2", HVDCDefinition("HVDCVSCLine2", dfl::inputs::HvdcLine::ConverterType::VSC, "VSCStation3", "_BUS___13_TN", false, "VSCStation4", "_BUS___14_TN",
@@ -184,9 +178,10 @@ TEST(Diagram, writeVSC) {
   };
   dfl::algo::HVDCLineDefinitions::BusVSCMap vscIds{};
   dfl::algo::HVDCLineDefinitions defs{map, vscIds};
-  std::vector<dfl::algo::GeneratorDefinition> generators;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
 
-  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs));
+  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs, curves));
 
   DiagramWriter.write();
 
@@ -197,8 +192,8 @@ TEST(Diagram, writeVSC) {
   for (const auto& vscPair : vscIds) {
     boost::filesystem::path ref(reference);
     boost::filesystem::path outputDir(outputDirectory);
-    dfl::test::checkFilesEqual(outputDir.append(dfl::outputs::constants::diagramFilename(vscPair.second.id)).generic_string(),
-                               ref.append(dfl::outputs::constants::diagramFilename(vscPair.second.id)).generic_string());
+    dfl::test::checkFilesEqual(outputDir.append(dfl::outputs::constants::diagramFilename(vscPair.second.id.str())).generic_string(),
+                               ref.append(dfl::outputs::constants::diagramFilename(vscPair.second.id.str())).generic_string());
   }
 }
 
@@ -231,9 +226,11 @@ TEST(Diagram, writeLCC) {
 
   dfl::algo::HVDCLineDefinitions::BusVSCMap vscIds{};
   dfl::algo::HVDCLineDefinitions defs{map, vscIds};
-  std::vector<dfl::algo::GeneratorDefinition> generators;
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
 
-  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs));
+  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs, curves));
 
   DiagramWriter.write();
 
@@ -247,4 +244,12 @@ TEST(Diagram, writeLCC) {
     dfl::test::checkFilesEqual(outputDir.append(dfl::outputs::constants::diagramFilename(id)).generic_string(),
                                ref.append(dfl::outputs::constants::diagramFilename(id)).generic_string());
   }
+
+  // the files listed by the writer are the ones written
+  auto filepaths = DiagramWriter.filepaths();
+  ASSERT_EQ(lccIds.size(), filepaths.size());
+  for (const auto& id : lccIds) {
+    boost::filesystem::path outputDir(outputDirectory);
+    ASSERT_NE(filepaths.end(), std::find(filepaths.begin(), filepaths.end(), outputDir.append(dfl::outputs::constants::diagramFilename(id))));
+  }
 }
@@ -9,16 +9,19 @@
 //
 
 #include "Dyd.h"
+#include "TestGenerators.h"
 #include "Tests.h"
 
 #include <boost/filesystem.hpp>
 
+using dfl::test::addGenerator;
+
 testing::Environment* initXmlEnvironment();
 
 testing::Environment* const env = initXmlEnvironment();
 
 TEST(Dyd, write) {
-  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::GeneratorDefinitions;
   using dfl::algo::LoadDefinition;
   using dfl::inputs::StaticVarCompensator;
 
@@ -36,10 +39,12 @@ TEST(Dyd, write) {
   std::vector<LoadDefinition> loads = {LoadDefinition("L0", "00"), LoadDefinition("L1", "01"), LoadDefinition("L2", "02"), LoadDefinition("L3", "03")};
 
   const std::string bus1 = "BUS_1";
-  std::vector<GeneratorDefinition> generators = {
-      GeneratorDefinition("G0", GeneratorDefinition::ModelType::SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1),
-      GeneratorDefinition("G2", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1),
-      GeneratorDefinition("G4", GeneratorDefinition::ModelType::SIGNALN, "00", {}, 1., 10., -11., 110., 0., bus1)};
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  addGenerator(curves, table, generators, "G0", GeneratorDefinitions::ModelType::SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1);
+  addGenerator(curves, table, generators, "G2", GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1);
+  addGenerator(curves, table, generators, "G4", GeneratorDefinitions::ModelType::SIGNALN, "00", {}, 1., 10., -11., 110., 0., bus1);
 
   std::vector<StaticVarCompensator> svarcs{
       StaticVarCompensator("SVARC0", 0., 10., 100, 230, 215, 230, 235, 245, 0., 10.),
@@ -67,7 +72,7 @@ TEST(Dyd, write) {
 }
 
 TEST(Dyd, writeRemote) {
-  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::GeneratorDefinitions;
   using dfl::algo::LoadDefinition;
 
   std::string basename = "TestDydRemote";
@@ -83,13 +88,15 @@ TEST(Dyd, writeRemote) {
 
   const std::string bus1 = "BUS_1";
   const std::string bus2 = "BUS_2";
-  std::vector<GeneratorDefinition> generators = {
-      GeneratorDefinition("G0", GeneratorDefinition::ModelType::REMOTE_SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1),
-      GeneratorDefinition("G1", GeneratorDefinition::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus1),
-      GeneratorDefinition("G2", GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1),
-      GeneratorDefinition("G3", GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "03", {}, 4., 40., 44., 440., 100, bus1),
-      GeneratorDefinition("G4", GeneratorDefinition::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus2),
-      GeneratorDefinition("G5", GeneratorDefinition::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus2)};
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  addGenerator(curves, table, generators, "G0", GeneratorDefinitions::ModelType::REMOTE_SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1);
+  addGenerator(curves, table, generators, "G1", GeneratorDefinitions::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus1);
+  addGenerator(curves, table, generators, "G2", GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1);
+  addGenerator(curves, table, generators, "G3", GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "03", {}, 4., 40., 44., 440., 100, bus1);
+  addGenerator(curves, table, generators, "G4", GeneratorDefinitions::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus2);
+  addGenerator(curves, table, generators, "G5", GeneratorDefinitions::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus2);
 
   auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
   auto node = dfl::inputs::Node::build("Slack", vl, 100., {});
@@ -140,7 +147,10 @@ TEST(Dyd, writeHvdc) {
 
   outputPath.append(filename);
 
-  dfl::outputs::Dyd dydWriter(dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), {}, {}, node, hvdcDefs, {}, manager, {}, {}));
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  dfl::outputs::Dyd dydWriter(dfl::outputs::Dyd::DydDefinition(basename, outputPath.generic_string(), generators, {}, node, hvdcDefs, {}, manager, {}, {}));
 
   dydWriter.write();
 
@@ -152,7 +162,7 @@ TEST(Dyd, writeHvdc) {
 }
 
 TEST(Dyd, writeDynamicModel) {
-  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::GeneratorDefinitions;
   using dfl::algo::LoadDefinition;
 
   std::string basename = "TestDydDynModel";
@@ -183,10 +193,12 @@ TEST(Dyd, writeDynamicModel) {
   std::vector<LoadDefinition> loads = {LoadDefinition("L0", "00"), LoadDefinition("L1", "01"), LoadDefinition("L2", "02"), LoadDefinition("L3", "03")};
 
   const std::string bus1 = "BUS_1";
-  std::vector<GeneratorDefinition> generators = {
-      GeneratorDefinition("G0", GeneratorDefinition::ModelType::SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1),
-      GeneratorDefinition("G2", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1),
-      GeneratorDefinition("G4", GeneratorDefinition::ModelType::SIGNALN, "00", {}, 1., 10., -11., 110., 0., bus1)};
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  addGenerator(curves, table, generators, "G0", GeneratorDefinitions::ModelType::SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1);
+  addGenerator(curves, table, generators, "G2", GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1);
+  addGenerator(curves, table, generators, "G4", GeneratorDefinitions::ModelType::SIGNALN, "00", {}, 1., 10., -11., 110., 0., bus1);
 
   auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
   auto node = dfl::inputs::Node::build("Slack", vl, 100., {});
@@ -0,0 +1,39 @@
+//
+// Copyright (c) 2020, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "Constants.h"
+#include "Islanding.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+
+TEST(Islanding, write) {
+  using dfl::inputs::NetworkManager;
+
+  std::string basename = "TestIslanding";
+  boost::filesystem::path outputPath("results");
+  outputPath.append(basename);
+  if (!boost::filesystem::exists(outputPath)) {
+    boost::filesystem::create_directories(outputPath);
+  }
+  outputPath.append(basename + dfl::outputs::constants::islandingFileSuffix);
+
+  std::vector<NetworkManager::DetachedPart> parts = {{"L0", dfl::inputs::Graph::EdgeType::LINE, 1, 0., 12.5},
+                                                     {"T1", dfl::inputs::Graph::EdgeType::TFO, 3, 250., 100.},
+                                                     {"L2", dfl::inputs::Graph::EdgeType::LINE, 2, 0., 0.}};
+
+  dfl::outputs::Islanding islandingWriter(dfl::outputs::Islanding::IslandingDefinition(outputPath.generic_string(), parts));
+  islandingWriter.write();
+
+  boost::filesystem::path reference("reference");
+  reference.append(basename);
+  reference.append(basename + dfl::outputs::constants::islandingFileSuffix);
+  dfl::test::checkFilesEqual(outputPath.generic_string(), reference.generic_string());
+}
@@ -9,16 +9,19 @@
 //
 
 #include "Par.h"
+#include "TestGenerators.h"
 #include "Tests.h"
 
 #include <boost/filesystem.hpp>
 
+using dfl::test::addGenerator;
+
 testing::Environment* initXmlEnvironment();
 
 testing::Environment* const env = initXmlEnvironment();
 
 TEST(TestPar, write) {
-  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::GeneratorDefinitions;
   using dfl::algo::LoadDefinition;
   using dfl::inputs::StaticVarCompensator;
 
@@ -36,10 +39,12 @@ TEST(TestPar, write) {
   }
 
   const std::string bus1 = "BUS_1";
-  std::vector<GeneratorDefinition> generators = {
-      GeneratorDefinition("G0", GeneratorDefinition::ModelType::SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1),
-      GeneratorDefinition("G2", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1),
-      GeneratorDefinition("G4", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "04", {}, 3., 30., -33., 330., 0, bus1)};
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  addGenerator(curves, table, generators, "G0", GeneratorDefinitions::ModelType::SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1);
+  addGenerator(curves, table, generators, "G2", GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1);
+  addGenerator(curves, table, generators, "G4", GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN, "04", {}, 3., 30., -33., 330., 0, bus1);
   std::vector<StaticVarCompensator> svarcs{
       StaticVarCompensator("SVARC0", 0., 10., 100, 230, 215, 230, 235, 245, 0., 10.),
       StaticVarCompensator("SVARC01", 10, 100., 1000, 2300, 2150, 2300, 2350, 2450, 0., 10.),
@@ -64,7 +69,7 @@ TEST(TestPar, write) {
 }
 
 TEST(TestPar, writeRemote) {
-  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::GeneratorDefinitions;
   using dfl::algo::LoadDefinition;
 
   dfl::inputs::DynamicDataBaseManager manager("", "");
@@ -82,13 +87,15 @@ TEST(TestPar, writeRemote) {
 
   std::string bus1 = "BUS_1";
   std::string bus2 = "BUS_2";
-  std::vector<GeneratorDefinition> generators = {
-      GeneratorDefinition("G0", GeneratorDefinition::ModelType::REMOTE_SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1),
-      GeneratorDefinition("G1", GeneratorDefinition::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus1),
-      GeneratorDefinition("G2", GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1),
-      GeneratorDefinition("G3", GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "03", {}, 4., 40., 44., 440., 100, bus1),
-      GeneratorDefinition("G4", GeneratorDefinition::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus2),
-      GeneratorDefinition("G5", GeneratorDefinition::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus2)};
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  addGenerator(curves, table, generators, "G0", GeneratorDefinitions::ModelType::REMOTE_SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1);
+  addGenerator(curves, table, generators, "G1", GeneratorDefinitions::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus1);
+  addGenerator(curves, table, generators, "G2", GeneratorDefinitions::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1);
+  addGenerator(curves, table, generators, "G3", GeneratorDefinitions::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "03", {}, 4., 40., 44., 440., 100, bus1);
+  addGenerator(curves, table, generators, "G4", GeneratorDefinitions::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus2);
+  addGenerator(curves, table, generators, "G5", GeneratorDefinitions::ModelType::PROP_SIGNALN, "01", {}, 2., 20., 22., 220., 100, bus2);
 
   outputPath.append(filename);
   dfl::inputs::Configuration::ActivePowerCompensation activePowerCompensation(dfl::inputs::Configuration::ActivePowerCompensation::P);
@@ -157,8 +164,11 @@ TEST(TestPar, writeHdvc) {
 
   outputPath.append(filename);
   dfl::inputs::Configuration::ActivePowerCompensation activePowerCompensation(dfl::inputs::Configuration::ActivePowerCompensation::P);
-  dfl::outputs::Par parWriter(
-      dfl::outputs::Par::ParDefinition(basename, dirname, outputPath.generic_string(), {}, hvdcDefs, activePowerCompensation, {}, manager, {}, {}, {}, {}));
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, dirname, outputPath.generic_string(), generators, hvdcDefs, activePowerCompensation,
+                                                               {}, manager, {}, {}, {}, {}));
 
   parWriter.write();
 
@@ -170,7 +180,7 @@ TEST(TestPar, writeHdvc) {
 }
 
 TEST(TestPar, DynModel) {
-  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::GeneratorDefinitions;
   using dfl::algo::LoadDefinition;
 
   dfl::inputs::DynamicDataBaseManager manager("res/setting.xml", "res/assembling.xml");
@@ -197,10 +207,12 @@ TEST(TestPar, DynModel) {
   defs.models.insert({dynModel.id, dynModel});
 
   const std::string bus1 = "BUS_1";
-  std::vector<GeneratorDefinition> generators = {
-      GeneratorDefinition("G0", GeneratorDefinition::ModelType::SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1),
-      GeneratorDefinition("G2", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1),
-      GeneratorDefinition("G4", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "04", {}, 3., 30., -33., 330., 0, bus1)};
+  dfl::inputs::ReactiveCurveStore curves;
+  dfl::inputs::GeneratorTable table(curves);
+  dfl::algo::GeneratorDefinitions generators(table);
+  addGenerator(curves, table, generators, "G0", GeneratorDefinitions::ModelType::SIGNALN, "00", {}, 1., 10., 11., 110., 100, bus1);
+  addGenerator(curves, table, generators, "G2", GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., 33., 330., 100, bus1);
+  addGenerator(curves, table, generators, "G4", GeneratorDefinitions::ModelType::DIAGRAM_PQ_SIGNALN, "04", {}, 3., 30., -33., 330., 0, bus1);
 
   outputPath.append(filename);
   dfl::inputs::Configuration::ActivePowerCompensation activePowerCompensation(dfl::inputs::Configuration::ActivePowerCompensation::P);